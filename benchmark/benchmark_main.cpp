@@ -3,6 +3,7 @@
 #include "common/cpu_info.h"
 #include "logging/logger.h"
 #include "sql/catalog.h"
+#include "sql/vector_calibration.h"
 #include "vm/llvm_engine.h"
 
 int main(int argc, char **argv) {
@@ -13,6 +14,7 @@ int main(int argc, char **argv) {
   // TODO(pmenon): Pull all initialization/shutdown logic into single function.
   tpl::CpuInfo::Instance();
   tpl::sql::Catalog::Instance();
+  tpl::sql::VectorCalibration::LoadCached();
   tpl::vm::LLVMEngine::Initialize();
 
   benchmark::RunSpecifiedBenchmarks();
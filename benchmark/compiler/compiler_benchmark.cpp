@@ -0,0 +1,187 @@
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "ast/context.h"
+#include "common/exception.h"
+#include "compiler/compiler.h"
+#include "sema/error_reporter.h"
+#include "vm/llvm_engine.h"
+#include "vm/module.h"
+
+namespace tpl::compiler {
+
+/**
+ * Measures the latency of each phase of compiling large, synthetic TPL programs. Programs are
+ * generated in the style of test/gen_random_tpl.py: a chain of functions, each declaring and
+ * reassigning integer locals using bitwise expressions over constants, earlier locals and calls to
+ * earlier functions. Generation is deterministic, so every run compiles the same program.
+ *
+ * Benchmarks are parameterized by the number of functions, the number of statements per function
+ * and whether to also JIT compile the bytecode to machine code. The time of each phase, averaged
+ * per iteration, is reported in milliseconds:
+ *
+ * - parse_ms, sema_ms, bytecode_gen_ms, module_gen_ms: Compiling source to bytecode.
+ * - llvm_ir_gen_ms, llvm_verify_ms, llvm_optimize_ms, llvm_codegen_ms, llvm_load_ms: JIT compiling
+ *                                                                         bytecode, if enabled.
+ *
+ * Along with the memory consumed by the results, in kilobytes: source_kb, ast_kb, bytecode_kb and,
+ * if JIT compiling, object_kb. The iteration time is the sum of all phases.
+ */
+class CompilerBenchmark : public benchmark::Fixture {
+ protected:
+  // Generate a random TPL program with 'num_functions' functions of 'num_statements' statements.
+  static std::string GenerateProgram(uint32_t num_functions, uint32_t num_statements) {
+    std::mt19937 gen(num_functions * 31 + num_statements);
+    std::ostringstream os;
+    for (uint32_t f = 0; f <= num_functions; f++) {
+      const auto name = f == num_functions ? std::string("main") : "f" + std::to_string(f);
+      os << "fun " << name << "() -> int32 {\n";
+      uint32_t num_vars = 0;
+      for (uint32_t s = 0; s < num_statements; s++) {
+        // Declare at least one local before assigning to any.
+        if (num_vars == 0 || gen() % 2 == 0) {
+          os << "  var x" << num_vars++ << ": int32 = ";
+        } else {
+          os << "  x" << gen() % num_vars << " = ";
+        }
+        GenerateExpression(&gen, f, num_vars - 1, 3, &os);
+        os << "\n";
+      }
+      // Return a combination of the most recent locals.
+      os << "  return x" << num_vars - 1;
+      for (uint32_t v = num_vars - 1; v > 0 && v + 4 > num_vars; v--) {
+        os << " ^ x" << v - 1;
+      }
+      os << "\n}\n";
+    }
+    return os.str();
+  }
+
+  // Generate an expression of at most 'depth' levels. Expressions may reference the first
+  // 'num_vars' locals and call the first 'num_functions' functions.
+  static void GenerateExpression(std::mt19937 *gen, uint32_t num_functions, uint32_t num_vars,
+                                 uint32_t depth, std::ostringstream *os) {
+    static constexpr const char *kOps[] = {" | ", " & ", " ^ "};
+    switch (depth == 0 ? (*gen)() % 3 : (*gen)() % 4) {
+      case 0:
+        *os << (*gen)() % 1000 + 1;
+        break;
+      case 1:
+        if (num_vars == 0) {
+          *os << (*gen)() % 1000 + 1;
+        } else {
+          *os << "x" << (*gen)() % num_vars;
+        }
+        break;
+      case 2:
+        if (num_functions == 0) {
+          *os << (*gen)() % 1000 + 1;
+        } else {
+          *os << "f" << (*gen)() % num_functions << "()";
+        }
+        break;
+      default:
+        *os << "(";
+        GenerateExpression(gen, num_functions, num_vars, depth - 1, os);
+        *os << kOps[(*gen)() % 3];
+        GenerateExpression(gen, num_functions, num_vars, depth - 1, os);
+        *os << ")";
+        break;
+    }
+  }
+
+  // Forwards the generated module, failing on any compilation error.
+  class Callbacks : public Compiler::Callbacks {
+   public:
+    void OnError(Compiler::Phase phase, Compiler *compiler) override {
+      std::ostringstream ss;
+      compiler->GetErrorReporter()->PrintErrors(ss);
+      throw Exception(ExceptionType::CodeGen, "Error compiling synthetic program: " + ss.str());
+    }
+
+    void TakeOwnership(std::unique_ptr<vm::Module> module) override { module_ = std::move(module); }
+
+    std::unique_ptr<vm::Module> ReleaseModule() { return std::move(module_); }
+
+   private:
+    std::unique_ptr<vm::Module> module_;
+  };
+};
+
+BENCHMARK_DEFINE_F(CompilerBenchmark, Synthetic)(benchmark::State &state) {
+  const auto num_functions = static_cast<uint32_t>(state.range(0));
+  const auto num_statements = static_cast<uint32_t>(state.range(1));
+  const bool jit = state.range(2) != 0;
+
+  const std::string source = GenerateProgram(num_functions, num_statements);
+
+  double parse_ms = 0, sema_ms = 0, bytecode_gen_ms = 0, module_gen_ms = 0;
+  double ast_bytes = 0, bytecode_bytes = 0;
+  vm::LLVMEngine::CompileStats llvm_totals;
+  for (auto _ : state) {
+    // Each iteration compiles into a fresh context, so its memory usage can be measured.
+    sema::ErrorReporter error_reporter;
+    ast::Context context(&error_reporter);
+
+    Callbacks callbacks;
+    TimePasses timer(&callbacks);
+    Compiler::RunCompilation(Compiler::Input("synthetic", &context, &source), &timer);
+    const auto module = callbacks.ReleaseModule();
+
+    parse_ms += timer.GetParseTimeMs();
+    sema_ms += timer.GetSemaTimeMs();
+    bytecode_gen_ms += timer.GetBytecodeGenTimeMs();
+    module_gen_ms += timer.GetModuleGenTimeMs();
+    ast_bytes += context.GetRegion()->allocated();
+    bytecode_bytes += module->GetBytecodeModule()->GetCodeSize();
+    double iteration_ms = timer.GetParseTimeMs() + timer.GetSemaTimeMs() +
+                          timer.GetBytecodeGenTimeMs() + timer.GetModuleGenTimeMs();
+
+    if (jit) {
+      vm::LLVMEngine::CompileStats llvm_stats;
+      vm::LLVMEngine::Compile(*module->GetBytecodeModule(), vm::LLVMEngine::CompilerOptions(),
+                              &llvm_stats);
+      llvm_totals.ir_gen_ms += llvm_stats.ir_gen_ms;
+      llvm_totals.verify_ms += llvm_stats.verify_ms;
+      llvm_totals.optimize_ms += llvm_stats.optimize_ms;
+      llvm_totals.codegen_ms += llvm_stats.codegen_ms;
+      llvm_totals.load_ms += llvm_stats.load_ms;
+      llvm_totals.object_code_bytes += llvm_stats.object_code_bytes;
+      iteration_ms += llvm_stats.ir_gen_ms + llvm_stats.verify_ms + llvm_stats.optimize_ms +
+                      llvm_stats.codegen_ms + llvm_stats.load_ms;
+    }
+
+    state.SetIterationTime(iteration_ms / 1000.0);
+  }
+
+  const auto avg = [](double value) {
+    return benchmark::Counter(value, benchmark::Counter::kAvgIterations);
+  };
+  state.counters["parse_ms"] = avg(parse_ms);
+  state.counters["sema_ms"] = avg(sema_ms);
+  state.counters["bytecode_gen_ms"] = avg(bytecode_gen_ms);
+  state.counters["module_gen_ms"] = avg(module_gen_ms);
+  state.counters["source_kb"] = source.size() / 1024.0;
+  state.counters["ast_kb"] = avg(ast_bytes / 1024.0);
+  state.counters["bytecode_kb"] = avg(bytecode_bytes / 1024.0);
+  if (jit) {
+    state.counters["llvm_ir_gen_ms"] = avg(llvm_totals.ir_gen_ms);
+    state.counters["llvm_verify_ms"] = avg(llvm_totals.verify_ms);
+    state.counters["llvm_optimize_ms"] = avg(llvm_totals.optimize_ms);
+    state.counters["llvm_codegen_ms"] = avg(llvm_totals.codegen_ms);
+    state.counters["llvm_load_ms"] = avg(llvm_totals.load_ms);
+    state.counters["object_kb"] = avg(llvm_totals.object_code_bytes / 1024.0);
+  }
+}
+
+BENCHMARK_REGISTER_F(CompilerBenchmark, Synthetic)
+    ->ArgNames({"functions", "statements", "jit"})
+    ->ArgsProduct({{10, 100, 1000}, {20, 200}, {0, 1}})
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tpl::compiler
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+#include "benchmark/benchmark.h"
+
+#include "common/exception.h"
+#include "sql/codegen/compilation_context.h"
+#include "sql/codegen/executable_query.h"
+#include "sql/execution_context.h"
+#include "sql/memory_pool.h"
+#include "sql/planner/plannodes/abstract_plan_node.h"
+#include "sql/result_consumer.h"
+#include "util/perf_counters.h"
+#include "util/timer.h"
+#include "vm/llvm_engine.h"
+#include "vm/module.h"
+#include "vm/vm_defs.h"
+
+namespace tpl::sql::codegen {
+
+/**
+ * The configuration of a query benchmark sweep. A sweep runs every query at one scale factor over
+ * the cross product of a set of thread counts and execution modes. The configuration is read once
+ * from the environment:
+ *
+ * - TPL_BENCHMARK_SCALE_FACTOR: The scale factor to generate data for (default: suite-specific).
+ * - TPL_BENCHMARK_THREADS: Comma-separated thread counts. Zero uses TBB's default (default: 0).
+ * - TPL_BENCHMARK_MODES: Comma-separated execution modes, any of 'interpret', 'adaptive' or
+ *                        'compiled' (default: interpret).
+ * - TPL_BENCHMARK_COMPILE_ONLY: If set to a non-zero value, time query compilation rather than
+ *                               execution (default: 0). See QueryBenchmark.
+ *
+ * Scale factors are not swept within a single process since regenerating tables per benchmark is
+ * prohibitively expensive. build-support/run_benchmark_sweep.py runs one process per scale factor.
+ */
+class QuerySweep {
+ public:
+  /**
+   * @return The sweep configuration for this process.
+   */
+  static const QuerySweep &Get() {
+    static const QuerySweep kSweep;
+    return kSweep;
+  }
+
+  /**
+   * Register all (thread count, execution mode) pairs in the sweep as arguments to @em bench.
+   * Intended to be used as: BENCHMARK_REGISTER_F(Fixture, Name)->Apply(QuerySweep::Apply).
+   */
+  static void Apply(benchmark::internal::Benchmark *bench) {
+    bench->ArgNames({"threads", "mode"});
+    for (const auto threads : Get().threads_) {
+      for (const auto mode : Get().modes_) {
+        bench->Args({threads, static_cast<int64_t>(mode)});
+      }
+    }
+  }
+
+  /**
+   * @return The scale factor to run at, or @em default_val if none was configured.
+   */
+  double GetScaleFactor(double default_val) const {
+    return scale_factor_ > 0.0 ? scale_factor_ : default_val;
+  }
+
+  /**
+   * @return True if queries are only compiled, not executed; false otherwise.
+   */
+  bool IsCompileOnly() const { return compile_only_; }
+
+ private:
+  QuerySweep() {
+    if (const char *sf = std::getenv("TPL_BENCHMARK_SCALE_FACTOR")) {
+      scale_factor_ = std::stod(sf);
+    }
+    if (const char *compile_only = std::getenv("TPL_BENCHMARK_COMPILE_ONLY")) {
+      compile_only_ = std::stoi(compile_only) != 0;
+    }
+    for (const auto &threads : Split(std::getenv("TPL_BENCHMARK_THREADS"), "0")) {
+      threads_.push_back(std::stoll(threads));
+    }
+    for (const auto &mode : Split(std::getenv("TPL_BENCHMARK_MODES"), "interpret")) {
+      if (mode == "interpret") {
+        modes_.push_back(vm::ExecutionMode::Interpret);
+      } else if (mode == "adaptive") {
+        modes_.push_back(vm::ExecutionMode::Adaptive);
+      } else if (mode == "compiled") {
+        modes_.push_back(vm::ExecutionMode::Compiled);
+      } else {
+        throw Exception(ExceptionType::Execution, "Unknown execution mode '" + mode + "'");
+      }
+    }
+  }
+
+  // Split the comma-separated list in 'str', or in 'default_val' if 'str' is NULL.
+  static std::vector<std::string> Split(const char *str, const char *default_val) {
+    std::vector<std::string> result;
+    std::stringstream ss(str != nullptr ? str : default_val);
+    for (std::string item; std::getline(ss, item, ',');) {
+      if (!item.empty()) result.push_back(item);
+    }
+    return result;
+  }
+
+ private:
+  double scale_factor_{0.0};
+  bool compile_only_{false};
+  std::vector<int64_t> threads_;
+  std::vector<vm::ExecutionMode> modes_;
+};
+
+/**
+ * Base fixture for full-query benchmarks. Each benchmark is run with the thread count and execution
+ * mode given by its sweep arguments. Beyond the execution time measured by the framework, the
+ * following counters are reported per run:
+ *
+ * - compile_ms: Time to generate and compile the query's bytecode.
+ * - first_run_ms: Time of the first (untimed) execution. In compiled mode, this includes
+ *                 generating machine code. In adaptive mode, it only includes the compiles that
+ *                 finish while the query runs.
+ * - scale_factor: The scale factor of the data.
+ *
+ * If hardware counters are available (see util::PerfCounters), the following are also reported:
+ *
+ * - cycles, instructions, llc_misses, branch_misses, dtlb_misses: Counts per timed iteration,
+ *                                                                 measured on the benchmark thread.
+ * - ipc: Instructions retired per cycle over all timed iterations.
+ *
+ * In compile-only mode (see QuerySweep), the query is never executed. Instead, each iteration
+ * generates and compiles the query's bytecode and, in adaptive and compiled modes, JIT compiles it
+ * to machine code. The time of each phase, averaged per iteration, is reported in milliseconds:
+ *
+ * - codegen_ms, sema_ms, bytecode_gen_ms, module_gen_ms: Generating and compiling bytecode.
+ * - llvm_ir_gen_ms, llvm_verify_ms, llvm_optimize_ms, llvm_codegen_ms, llvm_load_ms: Generating
+ *                                                                         machine code, if any.
+ *
+ * Along with the memory consumed by the results, in kilobytes: ast_kb, bytecode_kb, object_kb.
+ *
+ * In adaptive mode, compilations started by the first run are finished before timing starts. A
+ * module whose profile isn't warm after the first run is interpreted until it is, and compiled in
+ * the background during the timed runs. Adaptive numbers can thus mix interpreted and compiled
+ * runs.
+ */
+class QueryBenchmark : public benchmark::Fixture {
+ public:
+  /**
+   * Create a fixture whose data is generated at the given default scale factor.
+   */
+  explicit QueryBenchmark(double default_scale_factor)
+      : scale_factor_(QuerySweep::Get().GetScaleFactor(default_scale_factor)) {}
+
+  void SetUp(benchmark::State &st) override {
+    Fixture::SetUp(st);
+    if (const auto threads = st.range(0); threads > 0) {
+      thread_limit_ = std::make_unique<tbb::global_control>(
+          tbb::global_control::max_allowed_parallelism, threads);
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    thread_limit_.reset();
+    Fixture::TearDown(st);
+  }
+
+ protected:
+  /**
+   * @return The scale factor of the data this benchmark runs on.
+   */
+  double GetScaleFactor() const { return scale_factor_; }
+
+  /**
+   * Compile the query plan rooted at @em plan, then time its execution.
+   */
+  void RunQuery(benchmark::State &state, const planner::AbstractPlanNode &plan) {
+    const auto mode = static_cast<vm::ExecutionMode>(state.range(1));
+    if (QuerySweep::Get().IsCompileOnly()) {
+      CompileQuery(state, plan, mode);
+      return;
+    }
+    NoOpResultConsumer consumer;
+
+    const auto run_once = [&](ExecutableQuery *query) {
+      sql::MemoryPool memory(nullptr);
+      sql::ExecutionContext exec_ctx(&memory, plan.GetOutputSchema(), &consumer);
+      query->Run(&exec_ctx, mode);
+    };
+
+    // Generate code, but exclude it from the measured time.
+    std::unique_ptr<ExecutableQuery> query;
+    const double compile_ms =
+        util::Time<std::milli>([&] { query = CompilationContext::Compile(plan); });
+
+    // Run once to force machine-code generation, if any.
+    const double first_run_ms = util::Time<std::milli>([&] { run_once(query.get()); });
+
+    // Don't time compilations the first run left in the background.
+    query->WaitForCompilation();
+
+    // Only time execution. Hardware counters are sampled across all timed iterations.
+    util::PerfCounters perf_counters;
+    perf_counters.Start();
+    for (auto _ : state) {
+      run_once(query.get());
+    }
+    perf_counters.Stop();
+
+    state.counters["compile_ms"] = compile_ms;
+    state.counters["first_run_ms"] = first_run_ms;
+    state.counters["scale_factor"] = scale_factor_;
+    if (perf_counters.IsAvailable()) {
+      ReportPerfCounters(state, perf_counters.Read());
+    }
+  }
+
+ private:
+  // Time each phase of compiling the query plan rooted at 'plan' for the given execution mode.
+  void CompileQuery(benchmark::State &state, const planner::AbstractPlanNode &plan,
+                    vm::ExecutionMode mode) {
+    ExecutableQuery::CompileStats totals;
+    vm::LLVMEngine::CompileStats llvm_totals;
+    for (auto _ : state) {
+      const auto query = CompilationContext::Compile(plan);
+      const auto &stats = query->GetCompileStats();
+      totals.codegen_ms += stats.codegen_ms;
+      totals.sema_ms += stats.sema_ms;
+      totals.bytecode_gen_ms += stats.bytecode_gen_ms;
+      totals.module_gen_ms += stats.module_gen_ms;
+      totals.ast_bytes += stats.ast_bytes;
+      totals.bytecode_bytes += stats.bytecode_bytes;
+      if (mode == vm::ExecutionMode::Interpret) {
+        continue;
+      }
+      for (const auto &module : query->GetModules()) {
+        vm::LLVMEngine::CompileStats llvm_stats;
+        vm::LLVMEngine::Compile(*module->GetBytecodeModule(), vm::LLVMEngine::CompilerOptions(),
+                                &llvm_stats);
+        llvm_totals.ir_gen_ms += llvm_stats.ir_gen_ms;
+        llvm_totals.verify_ms += llvm_stats.verify_ms;
+        llvm_totals.optimize_ms += llvm_stats.optimize_ms;
+        llvm_totals.codegen_ms += llvm_stats.codegen_ms;
+        llvm_totals.load_ms += llvm_stats.load_ms;
+        llvm_totals.object_code_bytes += llvm_stats.object_code_bytes;
+      }
+    }
+
+    const auto avg = [](double value) {
+      return benchmark::Counter(value, benchmark::Counter::kAvgIterations);
+    };
+    state.counters["codegen_ms"] = avg(totals.codegen_ms);
+    state.counters["sema_ms"] = avg(totals.sema_ms);
+    state.counters["bytecode_gen_ms"] = avg(totals.bytecode_gen_ms);
+    state.counters["module_gen_ms"] = avg(totals.module_gen_ms);
+    state.counters["ast_kb"] = avg(totals.ast_bytes / 1024.0);
+    state.counters["bytecode_kb"] = avg(totals.bytecode_bytes / 1024.0);
+    if (mode != vm::ExecutionMode::Interpret) {
+      state.counters["llvm_ir_gen_ms"] = avg(llvm_totals.ir_gen_ms);
+      state.counters["llvm_verify_ms"] = avg(llvm_totals.verify_ms);
+      state.counters["llvm_optimize_ms"] = avg(llvm_totals.optimize_ms);
+      state.counters["llvm_codegen_ms"] = avg(llvm_totals.codegen_ms);
+      state.counters["llvm_load_ms"] = avg(llvm_totals.load_ms);
+      state.counters["object_kb"] = avg(llvm_totals.object_code_bytes / 1024.0);
+    }
+    state.counters["scale_factor"] = scale_factor_;
+  }
+
+  // Report the given hardware counters, averaged per iteration, and the IPC.
+  static void ReportPerfCounters(benchmark::State &state,
+                                 const util::PerfCounters::Sample &sample) {
+    using Event = util::PerfCounters::Event;
+    for (const auto event : {Event::Cycles, Event::Instructions, Event::LLCMisses,
+                             Event::BranchMisses, Event::DTLBMisses}) {
+      state.counters[util::PerfCounters::GetEventName(event)] = benchmark::Counter(
+          static_cast<double>(sample.Get(event)), benchmark::Counter::kAvgIterations);
+    }
+    state.counters["ipc"] = sample.GetIPC();
+  }
+
+ private:
+  // The scale factor.
+  double scale_factor_;
+  // Limits TBB's parallelism for the duration of a run, if requested.
+  std::unique_ptr<tbb::global_control> thread_limit_;
+};
+
+}  // namespace tpl::sql::codegen
@@ -0,0 +1,87 @@
+#include <charconv>
+#include <random>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "spdlog/fmt/fmt.h"
+
+#include "sql/vector.h"
+#include "sql/vector_operations/vector_operations.h"
+
+namespace tpl::sql {
+
+/**
+ * Measures casting a vector of strings into numbers and dates. The "Baseline" benchmarks parse each
+ * string with the generic routines the cast used to rely on (std::from_chars() for integers, and
+ * the general date parser), while the others go through VectorOps::Cast().
+ */
+class CastBenchmark : public benchmark::Fixture {
+ protected:
+  // Fill a string vector with strings produced by the given generator.
+  template <typename F>
+  static void FillStrings(Vector *vec, F &&gen) {
+    vec->Resize(kDefaultVectorSize);
+    auto data = reinterpret_cast<VarlenEntry *>(vec->GetData());
+    for (uint32_t i = 0; i < kDefaultVectorSize; i++) {
+      data[i] = vec->GetMutableStringHeap()->AddVarlen(gen());
+    }
+  }
+
+  void SetUp(const benchmark::State &state) override {
+    std::mt19937 gen(13);
+    // Order keys and amounts, mostly: five to fifteen digits.
+    std::uniform_int_distribution<int64_t> int_dist(10000, 999999999999999);
+    FillStrings(&integers_, [&] { return std::to_string(int_dist(gen)); });
+
+    std::uniform_int_distribution<int32_t> year(1992, 1998), month(1, 12), day(1, 28);
+    FillStrings(&dates_, [&] {
+      return fmt::format("{:04}-{:02}-{:02}", year(gen), month(gen), day(gen));
+    });
+    // Same dates, without zero-padding, to force the general parser.
+    FillStrings(&unpadded_dates_,
+                [&] { return fmt::format("{}-{}-{}", year(gen), month(gen), day(gen)); });
+  }
+
+  Vector integers_{TypeId::Varchar, true, false};
+  Vector dates_{TypeId::Varchar, true, false};
+  Vector unpadded_dates_{TypeId::Varchar, true, false};
+};
+
+BENCHMARK_F(CastBenchmark, BaselineBigInt)(benchmark::State &state) {
+  Vector result(TypeId::BigInt, true, false);
+  for (auto _ : state) {
+    auto input = reinterpret_cast<const VarlenEntry *>(integers_.GetData());
+    auto output = reinterpret_cast<int64_t *>(result.GetData());
+    for (uint32_t i = 0; i < kDefaultVectorSize; i++) {
+      const auto str = input[i].GetStringView();
+      std::from_chars(str.data(), str.data() + str.size(), output[i]);
+    }
+    benchmark::DoNotOptimize(result.GetData());
+  }
+}
+
+BENCHMARK_F(CastBenchmark, BigInt)(benchmark::State &state) {
+  Vector result(TypeId::BigInt, true, false);
+  for (auto _ : state) {
+    VectorOps::Cast(integers_, &result);
+    benchmark::DoNotOptimize(result.GetData());
+  }
+}
+
+BENCHMARK_F(CastBenchmark, BaselineDate)(benchmark::State &state) {
+  Vector result(TypeId::Date, true, false);
+  for (auto _ : state) {
+    VectorOps::Cast(unpadded_dates_, &result);
+    benchmark::DoNotOptimize(result.GetData());
+  }
+}
+
+BENCHMARK_F(CastBenchmark, Date)(benchmark::State &state) {
+  Vector result(TypeId::Date, true, false);
+  for (auto _ : state) {
+    VectorOps::Cast(dates_, &result);
+    benchmark::DoNotOptimize(result.GetData());
+  }
+}
+
+}  // namespace tpl::sql
@@ -0,0 +1,79 @@
+#include <memory>
+#include <random>
+
+#include "benchmark/benchmark.h"
+
+#include "sql/constant_vector.h"
+#include "sql/fused_vector_expression.h"
+#include "sql/tuple_id_list.h"
+#include "sql/vector.h"
+#include "sql/vector_operations/vector_operations.h"
+#include "sql/vector_projection.h"
+
+// For expression construction.
+#include "sql/planner/expression_maker.h"
+
+namespace tpl::sql {
+
+/**
+ * Compares evaluating the TPC-H Q1 charge, price * (1 - discount) * (1 + tax), through a chain of
+ * VectorOps calls against a single fused expression. The argument is the percentage of tuples
+ * selected in the input projection.
+ */
+class FusedVectorExpressionBenchmark : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    vp_.Initialize({TypeId::Double, TypeId::Double, TypeId::Double});
+    vp_.Reset(kDefaultVectorSize);
+
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<double> price(900.0, 100000.0), rate(0.0, 0.1);
+    auto price_data = reinterpret_cast<double *>(vp_.GetColumn(0)->GetData());
+    auto discount_data = reinterpret_cast<double *>(vp_.GetColumn(1)->GetData());
+    auto tax_data = reinterpret_cast<double *>(vp_.GetColumn(2)->GetData());
+    TupleIdList tids(kDefaultVectorSize);
+    for (uint32_t i = 0; i < kDefaultVectorSize; i++) {
+      price_data[i] = price(gen);
+      discount_data[i] = rate(gen);
+      tax_data[i] = rate(gen);
+      if (gen() % 100 < static_cast<uint64_t>(state.range(0))) tids.Add(i);
+    }
+    vp_.SetFilteredSelections(tids);
+  }
+
+  VectorProjection vp_;
+};
+
+BENCHMARK_DEFINE_F(FusedVectorExpressionBenchmark, VectorOps)(benchmark::State &state) {
+  ConstantVector one(GenericValue::CreateDouble(1.0));
+  Vector t1(TypeId::Double, true, false), t2(TypeId::Double, true, false);
+  Vector t3(TypeId::Double, true, false), result(TypeId::Double, true, false);
+  for (auto _ : state) {
+    VectorOps::Subtract(one, *vp_.GetColumn(1), &t1);
+    VectorOps::Add(one, *vp_.GetColumn(2), &t2);
+    VectorOps::Multiply(*vp_.GetColumn(0), t1, &t3);
+    VectorOps::Multiply(t3, t2, &result);
+    benchmark::DoNotOptimize(result.GetData());
+  }
+}
+
+BENCHMARK_DEFINE_F(FusedVectorExpressionBenchmark, Fused)(benchmark::State &state) {
+  planner::ExpressionMaker expr_maker;
+  auto one = expr_maker.Constant(1.0f);
+  auto expr = expr_maker.OpMul(
+      expr_maker.OpMul(expr_maker.CVE(0, Type::DoubleType(false)),
+                       expr_maker.OpMin(one, expr_maker.CVE(1, Type::DoubleType(false)))),
+      expr_maker.OpSum(one, expr_maker.CVE(2, Type::DoubleType(false))));
+  auto fused =
+      FusedVectorExpression::Compile(*expr, {TypeId::Double, TypeId::Double, TypeId::Double});
+  Vector result(TypeId::Double, true, false);
+  for (auto _ : state) {
+    fused->Evaluate(vp_, &result);
+    benchmark::DoNotOptimize(result.GetData());
+  }
+}
+
+BENCHMARK_REGISTER_F(FusedVectorExpressionBenchmark, VectorOps)->DenseRange(10, 100, 30);
+BENCHMARK_REGISTER_F(FusedVectorExpressionBenchmark, Fused)->DenseRange(10, 100, 30);
+
+}  // namespace tpl::sql
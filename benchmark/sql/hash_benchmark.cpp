@@ -123,6 +123,26 @@ BENCHMARK_DEFINE_F(HashBenchmark, VaaT_Hash_4)(benchmark::State &state) {
   }
 }
 
+BENCHMARK_DEFINE_F(HashBenchmark, VaaT_FusedHash_2)(benchmark::State &state) {
+  auto vp = MakeInput(state.range(0));
+  for (auto _ : state) {
+    auto hashes = sql::Vector(sql::TypeId::Hash, true, false);
+    sql::VectorOps::Hash({vp->GetColumn(Col::Tiny), vp->GetColumn(Col::Small)}, &hashes);
+    benchmark::DoNotOptimize(hashes.GetValue(44).IsNull());
+  }
+}
+
+BENCHMARK_DEFINE_F(HashBenchmark, VaaT_FusedHash_4)(benchmark::State &state) {
+  auto vp = MakeInput(state.range(0));
+  for (auto _ : state) {
+    auto hashes = sql::Vector(sql::TypeId::Hash, true, false);
+    sql::VectorOps::Hash({vp->GetColumn(Col::Tiny), vp->GetColumn(Col::Small),
+                          vp->GetColumn(Col::Int), vp->GetColumn(Col::Big)},
+                         &hashes);
+    benchmark::DoNotOptimize(hashes.GetValue(44).IsNull());
+  }
+}
+
 BENCHMARK_DEFINE_F(HashBenchmark, VaaT_Hash_ShortString)(benchmark::State &state) {
   auto vec_projection = MakeInput(state.range(0));
   for (auto _ : state) {
@@ -253,6 +273,8 @@ BENCHMARK_REGISTER_F(HashBenchmark, VaaT_Hash_1)->DenseRange(0, 100, 10);
 BENCHMARK_REGISTER_F(HashBenchmark, VaaT_Hash_2)->DenseRange(0, 100, 10);
 BENCHMARK_REGISTER_F(HashBenchmark, VaaT_Hash_3)->DenseRange(0, 100, 10);
 BENCHMARK_REGISTER_F(HashBenchmark, VaaT_Hash_4)->DenseRange(0, 100, 10);
+BENCHMARK_REGISTER_F(HashBenchmark, VaaT_FusedHash_2)->DenseRange(0, 100, 10);
+BENCHMARK_REGISTER_F(HashBenchmark, VaaT_FusedHash_4)->DenseRange(0, 100, 10);
 BENCHMARK_REGISTER_F(HashBenchmark, VaaT_Hash_ShortString)->DenseRange(0, 100, 10);
 BENCHMARK_REGISTER_F(HashBenchmark, VaaT_Hash_LongString)->DenseRange(0, 100, 10);
 
@@ -10,6 +10,7 @@
 #include "sql/codegen/compilation_context.h"
 #include "sql/codegen/executable_query.h"
 #include "sql/codegen/output_checker.h"
+#include "sql/codegen/query_benchmark.h"
 #include "sql/execution_context.h"
 #include "sql/planner/expression_maker.h"
 #include "sql/planner/output_schema_util.h"
@@ -30,23 +31,22 @@ namespace tpl::sql::codegen {
 
 namespace {
 
-// The execution mode.
-constexpr auto kExecutionMode = vm::ExecutionMode::Interpret;
-
-// Change this path to where your SSBM data is.
-constexpr char kSSBMDataDir[] = "/home/pmenon/tools/SSBM/data/sf-0.1";
+// The SSBM scale factor to generate data for, unless overridden by the sweep.
+constexpr double kSSBMScaleFactor = 0.1;
 
 // Flag used to ensure the SSBM database is only loaded once.
 std::once_flag kLoadSSBMDatabaseOnce{};
 
 }  // namespace
 
-class StarSchemaBenchmark : public benchmark::Fixture {
+class StarSchemaBenchmark : public QueryBenchmark {
  public:
+  StarSchemaBenchmark() : QueryBenchmark(kSSBMScaleFactor) {}
+
   void SetUp(benchmark::State &st) override {
-    Fixture::SetUp(st);
-    std::call_once(kLoadSSBMDatabaseOnce, []() {
-      tablegen::TableGenerator::GenerateSSBMTables(Catalog::Instance(), kSSBMDataDir);
+    QueryBenchmark::SetUp(st);
+    std::call_once(kLoadSSBMDatabaseOnce, [this]() {
+      tablegen::TableGenerator::GenerateSSBMTables(Catalog::Instance(), GetScaleFactor());
     });
   }
 };
@@ -151,23 +151,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q1_1)(benchmark::State &state) {
               .Build();
   }
 
-  // Compile plan!
-  auto query = CompilationContext::Compile(*agg);
-
-  // Run Once to force compilation
-  NoOpResultConsumer consumer;
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, agg->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, agg->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *agg);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q1_2)(benchmark::State &state) {
@@ -269,23 +253,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q1_2)(benchmark::State &state) {
               .Build();
   }
 
-  // Compile plan!
-  auto query = CompilationContext::Compile(*agg);
-
-  // Run Once to force compilation
-  NoOpResultConsumer consumer;
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, agg->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, agg->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *agg);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q1_3)(benchmark::State &state) {
@@ -390,23 +358,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q1_3)(benchmark::State &state) {
               .Build();
   }
 
-  // Compile plan!
-  auto query = CompilationContext::Compile(*agg);
-
-  // Run Once to force compilation
-  NoOpResultConsumer consumer;
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, agg->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, agg->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *agg);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q2_1)(benchmark::State &state) {
@@ -634,25 +586,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q2_1)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q2_2)(benchmark::State &state) {
@@ -880,25 +814,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q2_2)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q2_3)(benchmark::State &state) {
@@ -1125,25 +1041,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q2_3)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_1)(benchmark::State &state) {
@@ -1386,25 +1284,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_1)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_2)(benchmark::State &state) {
@@ -1647,25 +1527,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_2)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_3)(benchmark::State &state) {
@@ -1910,25 +1772,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_3)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_4)(benchmark::State &state) {
@@ -2173,25 +2017,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q3_4)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q4_1)(benchmark::State &state) {
@@ -2484,25 +2310,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q4_1)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q4_2)(benchmark::State &state) {
@@ -2814,25 +2622,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q4_2)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q4_3)(benchmark::State &state) {
@@ -3142,25 +2932,7 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q4_3)(benchmark::State &state) {
                .Build();
   }
 
-  // Compile plan
-  auto query = CompilationContext::Compile(*sort);
-
-  // Consumer.
-  NoOpResultConsumer consumer;
-
-  // Run Once to force compilation
-  {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
-
-  // Only time execution.
-  for (auto _ : state) {
-    sql::MemoryPool memory(nullptr);
-    sql::ExecutionContext exec_ctx(&memory, sort->GetOutputSchema(), &consumer);
-    query->Run(&exec_ctx, kExecutionMode);
-  }
+  RunQuery(state, *sort);
 }
 
 // ---------------------------------------------------------
@@ -3169,18 +2941,44 @@ BENCHMARK_DEFINE_F(StarSchemaBenchmark, Q4_3)(benchmark::State &state) {
 //
 // ---------------------------------------------------------
 
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q1_1)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q1_2)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q1_3)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q2_1)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q2_2)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q2_3)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_1)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_2)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_3)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_4)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q4_1)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q4_2)->Unit(benchmark::kMillisecond);
-BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q4_3)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q1_1)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q1_2)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q1_3)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q2_1)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q2_2)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q2_3)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_1)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_2)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_3)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q3_4)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q4_1)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q4_2)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(StarSchemaBenchmark, Q4_3)
+    ->Apply(QuerySweep::Apply)
+    ->Unit(benchmark::kMillisecond);
 
 }  // namespace tpl::sql::codegen
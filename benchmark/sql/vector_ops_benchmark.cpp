@@ -0,0 +1,400 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "spdlog/fmt/fmt.h"
+
+#include "sql/constant_vector.h"
+#include "sql/generic_value.h"
+#include "sql/tuple_id_list.h"
+#include "sql/vector.h"
+#include "sql/vector_operations/vector_operations.h"
+#include "util/perf_counters.h"
+#include "util/timer.h"
+
+namespace tpl::sql {
+
+/**
+ * A systematic benchmark of the VectorOps kernels. Every kernel is registered once per SQL type it
+ * supports, as VectorOps/<Kernel>/<Type>, and swept over:
+ *
+ * - selectivity: The percentage of input tuples in the input's selection vector (TID list).
+ * - nulls: The percentage of NULL input values.
+ * - dense: If 1, inputs are dense vectors without a TID list; the selectivity is always 100%.
+ *
+ * Input values are uniformly distributed over 100 distinct values, and comparisons are made
+ * against the median, so a selection kernel retains about half of its input. Costs are reported
+ * per tuple in the input vector, selected or not, so costs at different selectivities compare
+ * directly:
+ *
+ * - ns_per_tuple: Wall time per tuple.
+ * - cycles_per_tuple: Core cycles per tuple. Only reported if hardware counters are available (see
+ *                     util::PerfCounters).
+ *
+ * The full matrix is large. Use --benchmark_filter to restrict it, e.g., to a single kernel with
+ * --benchmark_filter=VectorOps/SelectLessThan/.
+ */
+class VectorOpsBenchmark {
+ public:
+  // All types with vector kernels.
+  static constexpr TypeId kAllTypes[] = {
+      TypeId::Boolean, TypeId::TinyInt, TypeId::SmallInt, TypeId::Integer, TypeId::BigInt,
+      TypeId::Float,   TypeId::Double,  TypeId::Date,     TypeId::Timestamp, TypeId::Varchar};
+
+  // Types supporting arithmetic.
+  static constexpr TypeId kNumericTypes[] = {TypeId::TinyInt, TypeId::SmallInt, TypeId::Integer,
+                                             TypeId::BigInt,  TypeId::Float,    TypeId::Double};
+
+  // Types supporting modulo.
+  static constexpr TypeId kIntegralTypes[] = {TypeId::TinyInt, TypeId::SmallInt, TypeId::Integer,
+                                              TypeId::BigInt};
+
+  /**
+   * Computes the type of a kernel's result vector from its input type.
+   */
+  using ResultTypeFn = TypeId (*)(TypeId);
+
+  /**
+   * The inputs to a kernel, generated from a benchmark's arguments. All input vectors are filtered
+   * by the same TID list, unless the benchmark uses dense inputs.
+   */
+  struct Input {
+    Input(benchmark::State &state, TypeId type, TypeId result_type)
+        : type(type), tids(kDefaultVectorSize), dense(state.range(2) != 0) {
+      std::mt19937 gen(kSeed);
+      a = MakeRandomVector(type, state.range(1), 0, &gen);
+      b = MakeRandomVector(type, state.range(1), 1, &gen);
+
+      // The input selection.
+      std::vector<uint32_t> all(kDefaultVectorSize);
+      std::iota(all.begin(), all.end(), 0u);
+      std::shuffle(all.begin(), all.end(), gen);
+      const auto count = dense ? kDefaultVectorSize : state.range(0) * kDefaultVectorSize / 100;
+      for (uint32_t i = 0; i < count; i++) {
+        tids.Add(all[i]);
+      }
+
+      // Pointers to the elements of 'b', in random order. A pointer is NULL if its element is.
+      std::shuffle(all.begin(), all.end(), gen);
+      pointers = std::make_unique<Vector>(TypeId::Pointer, true, true);
+      pointers->Resize(kDefaultVectorSize);
+      const auto elem_size = GetTypeIdSize(type);
+      for (uint32_t i = 0; i < kDefaultVectorSize; i++) {
+        reinterpret_cast<byte **>(pointers->GetData())[i] = b->GetData() + all[i] * elem_size;
+        pointers->SetNull(i, b->IsNull(all[i]));
+      }
+
+      Filter(a.get());
+      Filter(b.get());
+      Filter(pointers.get());
+
+      result = std::make_unique<Vector>(result_type, true, true);
+      result->Resize(kDefaultVectorSize);
+    }
+
+    // Apply the input selection to the given vector, unless inputs are dense.
+    void Filter(Vector *vector) const {
+      if (!dense) vector->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+    }
+
+    // The input type.
+    TypeId type;
+    // Two random input vectors.
+    std::unique_ptr<Vector> a, b;
+    // Pointers to the elements of 'b'.
+    std::unique_ptr<Vector> pointers;
+    // The kernel's result, if it produces a vector.
+    std::unique_ptr<Vector> result;
+    // The input selection.
+    TupleIdList tids;
+    // Whether inputs are dense.
+    bool dense;
+  };
+
+  /**
+   * A kernel invocation. Invoked once per iteration with the input. Selection kernels also receive
+   * a scratch TID list that holds the input selection on entry; other kernels receive NULL.
+   */
+  using Kernel = std::function<void(const Input &, TupleIdList *)>;
+
+  /**
+   * Register the kernel @em kernel for each type in @em types. The kernel's result vector has the
+   * type computed by @em result_type, which defaults to the input type.
+   */
+  template <std::size_t N>
+  static void Register(const char *name, const TypeId (&types)[N], Kernel kernel,
+                       ResultTypeFn result_type = [](TypeId type) { return type; }) {
+    RegisterImpl(name, types, false, std::move(kernel), result_type);
+  }
+
+  /**
+   * Register the selection kernel @em kernel for each type in @em types. Selection kernels filter
+   * a copy of the input selection in place.
+   */
+  template <std::size_t N>
+  static void RegisterSelection(const char *name, const TypeId (&types)[N], Kernel kernel) {
+    RegisterImpl(name, types, true, std::move(kernel), [](TypeId type) { return type; });
+  }
+
+  /**
+   * @return A constant vector of the given type holding the input value @em value.
+   */
+  static ConstantVector Constant(TypeId type, int64_t value) {
+    return ConstantVector(MakeValue(type, value));
+  }
+
+ private:
+  // The seed for all random inputs, so inputs are repeatable.
+  static constexpr uint32_t kSeed = 42;
+
+  template <std::size_t N>
+  static void RegisterImpl(const char *name, const TypeId (&types)[N], bool selection,
+                           Kernel kernel, ResultTypeFn result_type) {
+    for (const auto type : types) {
+      const auto full_name = fmt::format("VectorOps/{}/{}", name, TypeIdToString(type));
+      benchmark::RegisterBenchmark(full_name.c_str(), Run, type, result_type(type), selection,
+                                   kernel)
+          ->ArgNames({"selectivity", "nulls", "dense"})
+          ->Apply(SweepArgs);
+    }
+  }
+
+  static void SweepArgs(benchmark::internal::Benchmark *bench) {
+    for (const int64_t nulls : {0, 10, 50}) {
+      bench->Args({100, nulls, 1});
+      for (int64_t selectivity = 0; selectivity <= 100; selectivity += 10) {
+        bench->Args({selectivity, nulls, 0});
+      }
+    }
+  }
+
+  // Create a value of the given type from the integer 'value'.
+  static GenericValue MakeValue(TypeId type, int64_t value) {
+    switch (type) {
+      case TypeId::Boolean:
+        return GenericValue::CreateBoolean(value >= 50);
+      case TypeId::TinyInt:
+        return GenericValue::CreateTinyInt(value);
+      case TypeId::SmallInt:
+        return GenericValue::CreateSmallInt(value);
+      case TypeId::Integer:
+        return GenericValue::CreateInteger(value);
+      case TypeId::BigInt:
+        return GenericValue::CreateBigInt(value);
+      case TypeId::Float:
+        return GenericValue::CreateFloat(value);
+      case TypeId::Double:
+        return GenericValue::CreateDouble(value);
+      case TypeId::Date:
+        return GenericValue::CreateDate(1950 + value, 1, 1);
+      case TypeId::Timestamp:
+        return GenericValue::CreateTimestamp(1950 + value, 1, 1, 0, 0, 0);
+      case TypeId::Varchar:
+        // Numeric strings, so they can be cast.
+        return GenericValue::CreateVarchar(std::to_string(value));
+      default:
+        UNREACHABLE("Type not benchmarked");
+    }
+  }
+
+  // Create a full vector of the given type with random values in [min, 100), and 'null_pct'
+  // percent NULLs.
+  static std::unique_ptr<Vector> MakeRandomVector(TypeId type, int64_t null_pct, int64_t min,
+                                                  std::mt19937 *gen) {
+    std::uniform_int_distribution<int64_t> dist(min, 99), null_dist(0, 99);
+    auto vec = std::make_unique<Vector>(type, true, true);
+    vec->Resize(kDefaultVectorSize);
+    for (uint32_t i = 0; i < kDefaultVectorSize; i++) {
+      vec->SetValue(i, MakeValue(type, dist(*gen)));
+      vec->SetNull(i, null_dist(*gen) < null_pct);
+    }
+    return vec;
+  }
+
+  static void Run(benchmark::State &state, TypeId type, TypeId result_type, bool selection,
+                  const Kernel &kernel) {
+    const Input input(state, type, result_type);
+    TupleIdList scratch(kDefaultVectorSize);
+
+    // Only selection kernels modify the selection, and so pay for restoring it. Timing the copy
+    // for every other kernel would inflate their costs at low selectivity.
+    TupleIdList *const scratch_tids = selection ? &scratch : nullptr;
+
+    util::PerfCounters perf_counters;
+    util::Timer<std::nano> timer;
+    perf_counters.Start();
+    timer.Start();
+    for (auto _ : state) {
+      if (selection) scratch.AssignFrom(input.tids);
+      kernel(input, scratch_tids);
+      benchmark::ClobberMemory();
+    }
+    timer.Stop();
+    perf_counters.Stop();
+
+    const double num_tuples = static_cast<double>(state.iterations()) * kDefaultVectorSize;
+    state.counters["ns_per_tuple"] = timer.GetElapsed() / num_tuples;
+    if (perf_counters.IsAvailable()) {
+      const auto sample = perf_counters.Read();
+      state.counters["cycles_per_tuple"] = sample.GetPer(util::PerfCounters::Event::Cycles,
+                                                         static_cast<uint64_t>(num_tuples));
+    }
+  }
+};
+
+namespace {
+
+// Register a selection kernel comparing the input against the median.
+#define REGISTER_SELECT(NAME)                                                                      \
+  VectorOpsBenchmark::RegisterSelection(                                                           \
+      #NAME, VectorOpsBenchmark::kAllTypes, [](const auto &input, TupleIdList *tids) {             \
+        VectorOps::NAME(*input.a, VectorOpsBenchmark::Constant(input.type, 50), tids);             \
+      });
+
+// Register a fused gather-and-select kernel comparing the input against the pointed-to values.
+#define REGISTER_GATHER_SELECT(NAME)                                                               \
+  VectorOpsBenchmark::RegisterSelection(                                                           \
+      #NAME, VectorOpsBenchmark::kAllTypes, [](const auto &input, TupleIdList *tids) {             \
+        VectorOps::NAME(*input.a, *input.pointers, 0, tids);                                       \
+      });
+
+// Register an arithmetic kernel over the two inputs, for the given types.
+#define REGISTER_ARITHMETIC(NAME, TYPES)                                                           \
+  VectorOpsBenchmark::Register(#NAME, TYPES, [](const auto &input, TupleIdList *tids) {            \
+    VectorOps::NAME(*input.a, *input.b, input.result.get());                                       \
+  });
+
+// The target type of the Cast kernel for each source type.
+TypeId GetCastTarget(TypeId type) {
+  switch (type) {
+    case TypeId::Boolean:
+    case TypeId::TinyInt:
+    case TypeId::SmallInt:
+    case TypeId::Varchar:
+      return TypeId::Integer;
+    case TypeId::Integer:
+    case TypeId::Double:
+      return TypeId::BigInt;
+    case TypeId::BigInt:
+    case TypeId::Float:
+      return TypeId::Double;
+    case TypeId::Date:
+      return TypeId::Timestamp;
+    case TypeId::Timestamp:
+      return TypeId::Date;
+    default:
+      UNREACHABLE("Type not benchmarked");
+  }
+}
+
+TypeId GetHashType(TypeId) { return TypeId::Hash; }
+
+bool RegisterAll() {
+  REGISTER_SELECT(SelectEqual)
+  REGISTER_SELECT(SelectGreaterThan)
+  REGISTER_SELECT(SelectGreaterThanEqual)
+  REGISTER_SELECT(SelectLessThan)
+  REGISTER_SELECT(SelectLessThanEqual)
+  REGISTER_SELECT(SelectNotEqual)
+
+  VectorOpsBenchmark::RegisterSelection(
+      "SelectBetween", VectorOpsBenchmark::kAllTypes, [](const auto &input, TupleIdList *tids) {
+        VectorOps::SelectBetween(*input.a, VectorOpsBenchmark::Constant(input.type, 25),
+                                 VectorOpsBenchmark::Constant(input.type, 75), true, false, tids);
+      });
+
+  VectorOpsBenchmark::RegisterSelection(
+      "IsNull", VectorOpsBenchmark::kAllTypes,
+      [](const auto &input, TupleIdList *tids) { VectorOps::IsNull(*input.a, tids); });
+  VectorOpsBenchmark::RegisterSelection(
+      "IsNotNull", VectorOpsBenchmark::kAllTypes,
+      [](const auto &input, TupleIdList *tids) { VectorOps::IsNotNull(*input.a, tids); });
+
+  VectorOpsBenchmark::Register(
+      "Gather", VectorOpsBenchmark::kAllTypes, [](const auto &input, TupleIdList *tids) {
+        VectorOps::Gather(*input.pointers, input.result.get(), 0);
+      });
+  REGISTER_GATHER_SELECT(GatherAndSelectEqual)
+  REGISTER_GATHER_SELECT(GatherAndSelectGreaterThan)
+  REGISTER_GATHER_SELECT(GatherAndSelectGreaterThanEqual)
+  REGISTER_GATHER_SELECT(GatherAndSelectLessThan)
+  REGISTER_GATHER_SELECT(GatherAndSelectLessThanEqual)
+  REGISTER_GATHER_SELECT(GatherAndSelectNotEqual)
+
+  REGISTER_ARITHMETIC(Add, VectorOpsBenchmark::kNumericTypes)
+  REGISTER_ARITHMETIC(Subtract, VectorOpsBenchmark::kNumericTypes)
+  REGISTER_ARITHMETIC(Multiply, VectorOpsBenchmark::kNumericTypes)
+  REGISTER_ARITHMETIC(Divide, VectorOpsBenchmark::kNumericTypes)
+  REGISTER_ARITHMETIC(Modulo, VectorOpsBenchmark::kIntegralTypes)
+
+  VectorOpsBenchmark::Register(
+      "Cast", VectorOpsBenchmark::kAllTypes,
+      [](const auto &input, TupleIdList *tids) { VectorOps::Cast(*input.a, input.result.get()); },
+      GetCastTarget);
+
+  VectorOpsBenchmark::Register(
+      "Hash", VectorOpsBenchmark::kAllTypes,
+      [](const auto &input, TupleIdList *tids) { VectorOps::Hash(*input.a, input.result.get()); },
+      GetHashType);
+  VectorOpsBenchmark::Register(
+      "HashCombine", VectorOpsBenchmark::kAllTypes,
+      [](const auto &input, TupleIdList *tids) {
+        VectorOps::HashCombine(*input.a, input.result.get());
+      },
+      GetHashType);
+
+  const TypeId kDateTimeTypes[] = {TypeId::Date, TypeId::Timestamp};
+  VectorOpsBenchmark::Register(
+      "DateExtract", kDateTimeTypes,
+      [](const auto &input, TupleIdList *tids) {
+        VectorOps::DateExtract(*input.a, DatePart::Month, input.result.get());
+      },
+      [](TypeId) { return TypeId::Integer; });
+  VectorOpsBenchmark::Register("DateTrunc", kDateTimeTypes,
+                               [](const auto &input, TupleIdList *tids) {
+                                 VectorOps::DateTrunc(*input.a, DatePart::Quarter,
+                                                      input.result.get());
+                               });
+  const TypeId kDateTypes[] = {TypeId::Date};
+  VectorOpsBenchmark::Register("DateAddMonths", kDateTypes,
+                               [](const auto &input, TupleIdList *tids) {
+                                 VectorOps::DateAddMonths(
+                                     *input.a, ConstantVector(GenericValue::CreateInteger(3)),
+                                     input.result.get());
+                               });
+
+  const TypeId kStringTypes[] = {TypeId::Varchar};
+  VectorOpsBenchmark::RegisterSelection(
+      "Like", kStringTypes, [](const auto &input, TupleIdList *tids) {
+        VectorOps::Like(*input.a, ConstantVector(GenericValue::CreateVarchar("%5%")), tids);
+      });
+  VectorOpsBenchmark::RegisterSelection(
+      "NotLike", kStringTypes, [](const auto &input, TupleIdList *tids) {
+        VectorOps::NotLike(*input.a, ConstantVector(GenericValue::CreateVarchar("%5%")), tids);
+      });
+  VectorOpsBenchmark::Register("Upper", kStringTypes, [](const auto &input, TupleIdList *tids) {
+    VectorOps::Upper(*input.a, input.result.get());
+  });
+  VectorOpsBenchmark::Register("Concat", kStringTypes, [](const auto &input, TupleIdList *tids) {
+    VectorOps::Concat(*input.a, *input.b, input.result.get());
+  });
+
+  return true;
+}
+
+#undef REGISTER_ARITHMETIC
+#undef REGISTER_GATHER_SELECT
+#undef REGISTER_SELECT
+
+const bool kRegistered = RegisterAll();
+
+}  // namespace
+
+}  // namespace tpl::sql
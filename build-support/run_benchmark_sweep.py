@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+
+# Runs the full-query benchmark suites over a matrix of scale factors, thread counts and execution
+# modes, writes the merged results as JSON and, optionally, compares them against a baseline.
+#
+# Thread counts and execution modes are swept within one benchmark process (see
+# benchmark/include/sql/codegen/query_benchmark.h). Each scale factor is run in its own process
+# since the suites generate their data once per process.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+SUITES = ['tpch_benchmark', 'starschema_benchmark']
+MODES = ['interpret', 'adaptive', 'compiled']
+
+# The metrics compared against the baseline. Lower is better for all.
+METRICS = ['real_time', 'compile_ms']
+
+# Hardware counters, reported by the suites only if available on the host.
+PERF_COUNTERS = ['cycles', 'instructions', 'llc_misses', 'branch_misses', 'dtlb_misses', 'ipc']
+
+# Per-phase compilation latencies and sizes, reported by the suites in compile-only mode. The
+# machine-code phases are reported only in adaptive and compiled modes.
+COMPILE_COUNTERS = ['codegen_ms', 'sema_ms', 'bytecode_gen_ms', 'module_gen_ms', 'llvm_ir_gen_ms',
+                    'llvm_verify_ms', 'llvm_optimize_ms', 'llvm_codegen_ms', 'llvm_load_ms',
+                    'ast_kb', 'bytecode_kb', 'object_kb']
+
+
+def run_suite(bench_dir, suite, scale_factor, threads, modes, bench_filter, compile_only):
+    env = dict(os.environ)
+    env['TPL_BENCHMARK_SCALE_FACTOR'] = str(scale_factor)
+    env['TPL_BENCHMARK_THREADS'] = threads
+    env['TPL_BENCHMARK_MODES'] = modes
+    env['TPL_BENCHMARK_COMPILE_ONLY'] = '1' if compile_only else '0'
+
+    with tempfile.NamedTemporaryFile(suffix='.json') as out:
+        args = [os.path.join(bench_dir, suite),
+                '--benchmark_out={}'.format(out.name),
+                '--benchmark_out_format=json']
+        if bench_filter:
+            args.append('--benchmark_filter={}'.format(bench_filter))
+        print('Running {} (scale factor: {}) ...'.format(suite, scale_factor), flush=True)
+        proc = subprocess.run(args, env=env, stdout=subprocess.DEVNULL)
+        if proc.returncode != 0:
+            sys.exit('{} failed with exit code {}'.format(suite, proc.returncode))
+        return json.load(out)
+
+
+def to_result(suite, scale_factor, bench):
+    # Benchmark names look like: TpchBenchmark/Q1/threads:0/mode:0/iterations:10
+    parts = bench['run_name'].split('/')
+    args = dict(p.split(':', 1) for p in parts[2:] if ':' in p)
+    result = {
+        'suite': suite,
+        'query': parts[1],
+        'scale_factor': scale_factor,
+        'threads': int(args.get('threads', 0)),
+        'mode': MODES[int(args.get('mode', 0))],
+        'time_unit': bench['time_unit'],
+        'real_time': bench['real_time'],
+        'cpu_time': bench['cpu_time'],
+        'compile_ms': bench.get('compile_ms'),
+        'first_run_ms': bench.get('first_run_ms'),
+    }
+    result.update({c: bench[c] for c in PERF_COUNTERS + COMPILE_COUNTERS if c in bench})
+    return result
+
+
+def result_key(result):
+    return (result['suite'], result['query'], result['scale_factor'], result['threads'],
+            result['mode'])
+
+
+def compare(results, baseline_file, threshold):
+    with open(baseline_file) as f:
+        baseline = {result_key(r): r for r in json.load(f)['results']}
+
+    regressions = []
+    for result in results:
+        base = baseline.get(result_key(result))
+        if base is None:
+            continue
+        for metric in METRICS:
+            old, new = base.get(metric), result.get(metric)
+            if not old or new is None:
+                continue
+            change = (new - old) / old
+            if change > threshold:
+                regressions.append((result, metric, old, new, change))
+
+    print('Compared {} results against {} (threshold: {:.0%}).'.format(
+        len(results), baseline_file, threshold))
+    for result, metric, old, new, change in regressions:
+        print('\tREGRESSION {}/{} sf={} threads={} mode={}: {} {:.2f} -> {:.2f} (+{:.1%})'.format(
+            result['suite'], result['query'], result['scale_factor'], result['threads'],
+            result['mode'], metric, old, new, change))
+    return len(regressions) == 0
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('-b', dest='bench_dir', required=True,
+                        help='Directory containing the benchmark binaries.')
+    parser.add_argument('-s', dest='scale_factors', default='0.1',
+                        help='Comma-separated scale factors.')
+    parser.add_argument('-t', dest='threads', default='0',
+                        help='Comma-separated thread counts. Zero uses all cores.')
+    parser.add_argument('-m', dest='modes', default='interpret',
+                        help='Comma-separated execution modes: {}.'.format(', '.join(MODES)))
+    parser.add_argument('--suites', default=','.join(SUITES),
+                        help='Comma-separated benchmark suites to run.')
+    parser.add_argument('--filter', dest='bench_filter', help='Benchmark filter regex.')
+    parser.add_argument('--compile-only', action='store_true',
+                        help='Time query compilation rather than execution.')
+    parser.add_argument('-o', dest='out_file', default='benchmark_sweep.json',
+                        help='File to write JSON results to.')
+    parser.add_argument('--baseline', help='JSON results of a previous sweep to compare against.')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='Relative slowdown above which a result is a regression.')
+    args = parser.parse_args()
+
+    for mode in args.modes.split(','):
+        if mode not in MODES:
+            sys.exit('Unknown execution mode: {}'.format(mode))
+
+    results, context = [], None
+    for scale_factor in [float(sf) for sf in args.scale_factors.split(',')]:
+        for suite in args.suites.split(','):
+            output = run_suite(args.bench_dir, suite, scale_factor, args.threads, args.modes,
+                               args.bench_filter, args.compile_only)
+            context = context or output['context']
+            results += [to_result(suite, scale_factor, b) for b in output['benchmarks']]
+
+    with open(args.out_file, 'w') as f:
+        json.dump({'context': context, 'results': results}, f, indent=2)
+    print('Wrote {} results to {}.'.format(len(results), args.out_file))
+
+    if args.baseline and not compare(results, args.baseline, args.threshold):
+        sys.exit(-1)
+
+
+if __name__ == '__main__':
+    main()
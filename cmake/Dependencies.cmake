@@ -44,7 +44,7 @@ message(STATUS "Found LLVM ${LLVM_PACKAGE_VERSION}")
 if (${LLVM_PACKAGE_VERSION} VERSION_LESS "11")
     message(FATAL_ERROR "LLVM 11 or newer is required.")
 endif ()
-llvm_map_components_to_libnames(LLVM_LIBRARIES core mcjit nativecodegen native ipo)
+llvm_map_components_to_libnames(LLVM_LIBRARIES core mcjit nativecodegen native ipo linker)
 include_directories(SYSTEM ${LLVM_INCLUDE_DIRS})
 list(APPEND TPL_LINK_LIBS ${LLVM_LIBRARIES})
 
@@ -159,7 +159,7 @@ bool LiteralExpression::IsRepresentable(ast::Type *type) const {
     switch (type->As<ast::BuiltinType>()->GetKind()) {
       case ast::BuiltinType::Kind::Float32: {
         const auto tmp = static_cast<float>(val);
-        return FLT_MIN <= val && val <= FLT_MAX && static_cast<double>(tmp) == val;
+        return -FLT_MAX <= val && val <= FLT_MAX && static_cast<double>(tmp) == val;
       }
       case ast::BuiltinType::Kind::Float64: {
         return true;
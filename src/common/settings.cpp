@@ -6,37 +6,36 @@
 
 namespace tpl {
 
+// The functions below provide portable defaults for thresholds that depend on the machine. They are
+// overridden by machine-specific values if the vector kernels have been calibrated on this CPU. See
+// sql::VectorCalibration.
+
 namespace {
 
 double DeriveOptimalFullSelectionThreshold(UNUSED Settings *settings, UNUSED CpuInfo *cpu_info) {
-  // TODO(pmenon): Micro-benchmark to determine this at database startup for the current machine
   // TODO(pmenon): What about types?
   return 0.25;
 }
 
 double DeriveOptimalFullSelectionBetweenThreshold(UNUSED Settings *settings,
                                                   UNUSED CpuInfo *cpu_info) {
-  // TODO(pmenon): Micro-benchmark to determine this at database startup for the current machine
   // TODO(pmenon): What about types?
   return 0.15;
 }
 
 double DeriveOptimalFullHashThreshold(UNUSED Settings *settings, UNUSED CpuInfo *cpu_info) {
-  // TODO(pmenon): Micro-benchmark to determine this at database startup for the current machine
   // We're assuming the hashing function is Murmur3-style xor-shift + multiply.
   return 0.35;
 }
 
 double DeriveOptimalArithmeticFullComputeThreshold(UNUSED Settings *settings,
                                                    UNUSED CpuInfo *cpu_info) {
-  // TODO(pmenon): Micro-benchmark to determine this at database startup for the current machine
   // TODO(pmenon): What about types?
   return 0.05;
 }
 
 double DeriveMinBitDensityThresholdForAvxIndexDecode(UNUSED Settings *settings,
                                                      UNUSED CpuInfo *cpu_info) {
-  // TODO(pmenon): Micro-benchmark to determine this at database startup for the current machine
   return 0.15;
 }
 
@@ -36,6 +36,8 @@ namespace tpl::ast {
   /* Thread State Container */                                  \
   F(ExecutionContextGetMemoryPool, execCtxGetMem)               \
   F(ExecutionContextGetTLS, execCtxGetTLS)                      \
+  F(ExecutionContextRecordTuples, execCtxRecordTuples)          \
+  F(ExecutionContextRecordMorsels, execCtxRecordMorsels)        \
   F(ThreadStateContainerReset, tlsReset)                        \
   F(ThreadStateContainerGetState, tlsGetCurrentThreadState)     \
   F(ThreadStateContainerIterate, tlsIterate)                    \
@@ -65,6 +65,11 @@ class CpuInfo {
    */
   uint32_t GetNumLogicalCores() const noexcept { return num_logical_cores_; }
 
+  /**
+   * @return The model name of the processor, as reported by the OS.
+   */
+  const std::string &GetModelName() const noexcept { return model_name_; }
+
   /**
    * @return The size of the cache at level @em level in bytes.
    */
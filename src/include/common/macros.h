@@ -13,6 +13,15 @@
 #define FALLTHROUGH [[fallthrough]]
 #define NORETURN [[noreturn]]
 
+// Marks a runtime function called on hot paths from bytecode handlers. The definitions of marked
+// functions are linked into the bytecode handler bitcode so that JIT-compiled code can inline
+// them (see gen_opt_bc.cpp). Only Clang, which produces that bitcode, needs to see the marker.
+#if defined(__clang__)
+#define JIT_INLINABLE __attribute__((annotate("tpl.jit_inlinable")))
+#else
+#define JIT_INLINABLE
+#endif
+
 // ---------------------------------------------------------
 // Macros to force classes to be non-copyable, non-movable,
 // or both
@@ -75,6 +75,39 @@ namespace tpl {
    */                                                                                              \
   CONST(ParallelQueryExecution, bool, true)                                                        \
                                                                                                    \
+  /*                                                                                               \
+   * Flag indicating if compiled queries should be instrumented to collect                         \
+   * runtime statistics for each operator and pipeline.                                            \
+   */                                                                                              \
+  CONST(ProfileQueries, bool, false)                                                               \
+                                                                                                   \
+  /*                                                                                               \
+   * Flag indicating if the bytecode of loaded modules should be translated                        \
+   * into direct-threaded code for the interpreter.                                                \
+   */                                                                                              \
+  CONST(ThreadedInterpretation, bool, true)                                                        \
+                                                                                                   \
+  /*                                                                                               \
+   * Flag indicating if the interpreter should profile branches and calls of                       \
+   * modules running in adaptive mode, so that their JIT compilation can                           \
+   * optimize for the observed behavior. Requires threaded interpretation.                         \
+   */                                                                                              \
+  CONST(ProfileGuidedCompilation, bool, true)                                                      \
+                                                                                                   \
+  /*                                                                                               \
+   * The number of function invocations and conditional jumps the interpreter                      \
+   * must profile in a module running in adaptive mode before the module is                        \
+   * JIT compiled. Only applies with profile-guided compilation.                                   \
+   */                                                                                              \
+  CONST(AdaptiveCompilationThreshold, int64_t, 10000)                                              \
+                                                                                                   \
+  /*                                                                                               \
+   * Flag indicating if each pipeline of a compiled query should be compiled                       \
+   * into its own module, allowing pipelines to be compiled into machine code                      \
+   * in parallel.                                                                                  \
+   */                                                                                              \
+  CONST(PerPipelineCompilation, bool, true)                                                        \
+                                                                                                   \
   /*                                                                                               \
    * The degree of oversampling when selecting random samples from an input.                       \
    */                                                                                              \
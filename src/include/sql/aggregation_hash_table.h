@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/macros.h"
 #include "sql/chaining_hash_table.h"
 #include "sql/memory_pool.h"
 #include "sql/schema.h"
@@ -43,6 +44,11 @@ class AggregationHashTable {
   // The default initial size we set the hash table on construction
   static constexpr uint32_t kDefaultInitialTableSize = 256;
 
+  // The largest initial size a hash table can be presized to from an estimate.
+  // Estimates can be far off, so larger tables grow as aggregates are inserted
+  // instead. Partition tables are sized from their exact counts.
+  static constexpr uint32_t kMaxInitialTableSize = 1u << 20u;
+
   // The default number of partitions we use in partitioned aggregation mode
   static constexpr uint32_t kDefaultNumPartitions = 512;
 
@@ -109,7 +115,7 @@ class AggregationHashTable {
   /**
    * Construct an aggregation hash table using the provided memory pool, configured to store
    * aggregates of size @em payload_size in bytes, and whose initial size allows for
-   * @em initial_size aggregates.
+   * @em initial_size aggregates. Estimated sizes should be capped at kMaxInitialTableSize.
    * @param memory The memory pool to allocate memory from.
    * @param payload_size The size of the elements in the hash table, in bytes.
    * @param initial_size The initial number of aggregates to support.
@@ -131,14 +137,14 @@ class AggregationHashTable {
    * @param hash The hash value of the element to insert.
    * @return A pointer to a memory area where the element can be written to.
    */
-  byte *AllocInputTuple(hash_t hash);
+  JIT_INLINABLE byte *AllocInputTuple(hash_t hash);
 
   /**
    * Insert a new element with hash value @em hash into this partitioned aggregation hash table.
    * @param hash The hash value of the element to insert.
    * @return A pointer to a memory area where the input element can be written.
    */
-  byte *AllocInputTuplePartitioned(hash_t hash);
+  JIT_INLINABLE byte *AllocInputTuplePartitioned(hash_t hash);
 
   /**
    * Insert and link in an entry containing a fully-constructed tuple into this aggregation table.
@@ -275,7 +281,7 @@ class AggregationHashTable {
   void Grow();
 
   // Internal entry allocation + hash table linkage. Does not resize!
-  HashTableEntry *AllocateEntryInternal(hash_t hash);
+  JIT_INLINABLE HashTableEntry *AllocateEntryInternal(hash_t hash);
 
   // Should we flush entries from the main table into the overflow partitions?
   bool NeedsToFlushToOverflowPartitions() const noexcept {
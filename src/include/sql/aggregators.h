@@ -4,8 +4,10 @@
 #include <limits>
 
 #include "common/common.h"
+#include "common/exception.h"
 #include "common/macros.h"
 #include "sql/value.h"
+#include "util/arithmetic_overflow.h"
 
 namespace tpl::sql {
 
@@ -134,6 +136,89 @@ class IntegerSumAggregate : public SumAggregate<Integer> {};
  */
 class RealSumAggregate : public SumAggregate<Real> {};
 
+/**
+ * Decimal sums. The sum is accumulated exactly in 128 bits, and checked for overflow. The scale of
+ * the sum is the scale of its inputs.
+ */
+class DecimalSumAggregate {
+ public:
+  /**
+   * Constructor.
+   */
+  DecimalSumAggregate() : sum_(0), is_null_(true) {}
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(DecimalSumAggregate);
+
+  /**
+   * Advance the aggregate by a given input value. If the input is NULL, no change is applied to
+   * the aggregate.
+   * @param val The (potentially NULL) value to advance the sum by.
+   */
+  void Advance(const DecimalVal &val) {
+    if (val.is_null) return;
+    is_null_ = false;
+    Add(val.val);
+  }
+
+  /**
+   * Merge a partial sum aggregate into this aggregate. If the partial sum is NULL, no change is
+   * applied to this aggregate.
+   * @param that The (potentially NULL) value to merge into this aggregate.
+   */
+  void Merge(const DecimalSumAggregate &that) {
+    if (that.is_null_) return;
+    is_null_ = false;
+    Add(that.sum_);
+  }
+
+  /**
+   * Reset the summation.
+   */
+  void Reset() {
+    sum_ = 0;
+    is_null_ = true;
+  }
+
+  /**
+   * @return The exact, 128-bit sum. Undefined if the sum is NULL.
+   */
+  Decimal128 GetSum128() const { return Decimal128(sum_); }
+
+  /**
+   * @return True if no non-NULL input has been seen; false otherwise.
+   */
+  bool IsNull() const { return is_null_; }
+
+  /**
+   * Return the result of the summation.
+   * @throw Exception of type ExceptionType::Decimal if the sum doesn't fit into a 64-bit decimal.
+   * @return The current value of the sum.
+   */
+  DecimalVal GetResultSum() const {
+    if (is_null_) {
+      return DecimalVal::Null();
+    }
+    if (sum_ > std::numeric_limits<int64_t>::max() || sum_ < std::numeric_limits<int64_t>::min()) {
+      throw Exception(ExceptionType::Decimal, "numeric field overflow in decimal sum");
+    }
+    return DecimalVal(static_cast<int64_t>(sum_));
+  }
+
+ private:
+  void Add(int128_t val) {
+    if (util::ArithmeticOverflow::Add<int128_t>(sum_, val, &sum_)) {
+      throw Exception(ExceptionType::Decimal, "numeric field overflow in decimal sum");
+    }
+  }
+
+ private:
+  int128_t sum_;
+  bool is_null_;
+};
+
 /**
  * Generic max.
  */
@@ -350,4 +435,69 @@ class AvgAggregate {
   uint64_t count_;
 };
 
+/**
+ * Decimal average aggregate. The sum is accumulated exactly; the average has the scale of its
+ * inputs and is rounded half away from zero.
+ */
+class DecimalAvgAggregate {
+ public:
+  /**
+   * Constructor.
+   */
+  DecimalAvgAggregate() : count_(0) {}
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(DecimalAvgAggregate);
+
+  /**
+   * Advance the aggregate by the input value @em val.
+   */
+  void Advance(const DecimalVal &val) {
+    if (val.is_null) return;
+    sum_.Advance(val);
+    count_++;
+  }
+
+  /**
+   * Merge a partial average aggregate into this aggregate.
+   */
+  void Merge(const DecimalAvgAggregate &that) {
+    sum_.Merge(that.sum_);
+    count_ += that.count_;
+  }
+
+  /**
+   * Reset the aggregate.
+   */
+  void Reset() {
+    sum_.Reset();
+    count_ = 0;
+  }
+
+  /**
+   * Return the result of the average.
+   */
+  DecimalVal GetResultAvg() const {
+    if (count_ == 0) {
+      return DecimalVal::Null();
+    }
+    const int128_t sum = sum_.GetSum128();
+    const int128_t count = count_;
+    int128_t avg = sum / count;
+    const int128_t rem = sum % count;
+    if (rem >= count - rem) {
+      avg++;
+    } else if (-rem >= count + rem) {
+      avg--;
+    }
+    return DecimalVal(static_cast<int64_t>(avg));
+  }
+
+ private:
+  DecimalSumAggregate sum_;
+  uint64_t count_;
+};
+
 }  // namespace tpl::sql
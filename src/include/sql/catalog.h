@@ -11,6 +11,7 @@
 namespace tpl::sql {
 
 class Table;
+class TableStatistics;
 
 #define TABLES(V)              \
   V(EmptyTable, "empty_table") \
@@ -84,6 +85,33 @@ class Catalog {
    */
   void InsertTable(const std::string &table_name, std::unique_ptr<Table> &&table);
 
+  /**
+   * Compute statistics over all columns of the table with ID @em table_id, replacing any existing
+   * statistics for the table. This is the ANALYZE operation.
+   * @param table_id The ID of the table to analyze.
+   * @return The computed statistics, or NULL if the table doesn't exist.
+   */
+  const TableStatistics *AnalyzeTable(uint16_t table_id);
+
+  /**
+   * Compute statistics over all tables in the catalog.
+   */
+  void AnalyzeAllTables();
+
+  /**
+   * Discard the statistics of the table with ID @em table_id, if any. Plans over the table will
+   * no longer be informed by statistics until it's analyzed again.
+   * @param table_id The ID of the table.
+   */
+  void ClearTableStatistics(uint16_t table_id);
+
+  /**
+   * Lookup the most recently computed statistics for the table with ID @em table_id.
+   * @param table_id The ID of the target table.
+   * @return A pointer to the table's statistics, or NULL if the table hasn't been analyzed.
+   */
+  const TableStatistics *LookupTableStatisticsById(uint16_t table_id) const;
+
  private:
   /**
    * Private on purpose to force access through singleton Instance() method.
@@ -94,6 +122,7 @@ class Catalog {
  private:
   std::unordered_map<uint16_t, std::unique_ptr<Table>> table_catalog_;
   std::unordered_map<std::string, uint16_t> table_name_to_id_map_;
+  std::unordered_map<uint16_t, std::unique_ptr<TableStatistics>> table_stats_;
   uint16_t next_table_id_;
 };
 
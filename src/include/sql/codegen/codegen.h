@@ -507,6 +507,18 @@ class CodeGen {
    */
   void UnIndent() { position_.column -= 4; }
 
+  /**
+   * @return The compilation unit generated structures and functions are registered in.
+   */
+  CompilationUnit *GetContainer() const { return container_; }
+
+  /**
+   * Register all structures and functions generated from now on in the given compilation unit.
+   * @pre The unit must use the same AST context as the current one.
+   * @param container The compilation unit.
+   */
+  void SetContainer(CompilationUnit *container) { container_ = container; }
+
   [[nodiscard]] ast::Expression *BuildTypeRepresentation(ast::Type *type, bool for_struct) const;
 
  private:
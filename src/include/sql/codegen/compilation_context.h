@@ -77,6 +77,16 @@ class CompilationContext {
    */
   ExpressionTranslator *LookupTranslator(const planner::AbstractExpression &expr) const;
 
+  /**
+   * @return True if the query is instrumented to collect runtime statistics; false otherwise.
+   */
+  bool IsProfiling() const { return profiling_; }
+
+  /**
+   * @return The ID of the operator implementing the given plan node in the query's profile.
+   */
+  uint32_t GetOperatorId(const planner::AbstractPlanNode &node) const;
+
   /**
    * @return A common prefix for all functions generated in this module.
    */
@@ -126,6 +136,8 @@ class CompilationContext {
  private:
   // Unique ID used as a prefix for all generated functions to ensure uniqueness.
   uint64_t unique_id_;
+  // Whether to instrument the generated code to collect runtime statistics.
+  bool profiling_;
   // The compiled query object we'll update.
   ExecutableQuery *query_;
   // All allocated containers.
@@ -142,6 +154,8 @@ class CompilationContext {
       operators_;
   std::unordered_map<const planner::AbstractExpression *, std::unique_ptr<ExpressionTranslator>>
       expressions_;
+  // The ID of each plan node in the query's profile.
+  std::unordered_map<const planner::AbstractPlanNode *, uint32_t> operator_ids_;
 };
 
 }  // namespace tpl::sql::codegen
@@ -61,6 +61,22 @@ class CompilationUnit {
    */
   std::unique_ptr<vm::Module> Compile();
 
+  /**
+   * @return The time spent type-checking during the most recent compilation, in milliseconds.
+   */
+  double GetSemaTimeMs() const { return sema_ms_; }
+
+  /**
+   * @return The time spent generating bytecode during the most recent compilation, in milliseconds.
+   */
+  double GetBytecodeGenTimeMs() const { return bytecode_gen_ms_; }
+
+  /**
+   * @return The time spent generating the module during the most recent compilation, in
+   *         milliseconds.
+   */
+  double GetModuleGenTimeMs() const { return module_gen_ms_; }
+
   /**
    * @return The context.
    */
@@ -74,6 +90,8 @@ class CompilationUnit {
   // The list of all functions and structs.
   llvm::SmallVector<ast::StructDeclaration *, 16> structs_;
   llvm::SmallVector<ast::FunctionDeclaration *, 16> functions_;
+  // The time spent in each phase of the most recent compilation.
+  double sema_ms_{0.0}, bytecode_gen_ms_{0.0}, module_gen_ms_{0.0};
 };
 
 }  // namespace tpl::sql::codegen
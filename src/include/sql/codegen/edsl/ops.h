@@ -44,6 +44,22 @@ class Reference<ast::x::ExecutionContext> {
     return Value<ast::x::MemoryPool *>(codegen_, mem_pool);
   }
 
+  Value<void> RecordTuples(uint32_t operator_id, const Value<uint64_t> &num_tuples) const {
+    auto call = codegen_->CallBuiltin(ast::Builtin::ExecutionContextRecordTuples,
+                                      {val_, codegen_->Literal(operator_id),
+                                       num_tuples.GetRaw()});
+    call->SetType(codegen_->GetType<void>());
+    return Value<void>(codegen_->MakeStatement(call));
+  }
+
+  Value<void> RecordMorsels(uint32_t pipeline_id, const Value<uint64_t> &num_morsels) const {
+    auto call = codegen_->CallBuiltin(ast::Builtin::ExecutionContextRecordMorsels,
+                                      {val_, codegen_->Literal(pipeline_id),
+                                       num_morsels.GetRaw()});
+    call->SetType(codegen_->GetType<void>());
+    return Value<void>(codegen_->MakeStatement(call));
+  }
+
  private:
   // The code generator instance.
   CodeGen *codegen_;
@@ -255,6 +271,15 @@ class Reference<ast::x::AggregationHashTable> {
     return Value<void>(codegen_->MakeStatement(call));
   }
 
+  Value<void> Init(const Value<ast::x::MemoryPool *> &mem_pool, const Value<uint32_t> &payload_size,
+                   const Value<uint32_t> &initial_size) const {
+    auto call = codegen_->CallBuiltin(
+        ast::Builtin::AggHashTableInit,
+        {val_, mem_pool.GetRaw(), payload_size.GetRaw(), initial_size.GetRaw()});
+    call->SetType(codegen_->GetType<void>());
+    return Value<void>(codegen_->MakeStatement(call));
+  }
+
   Value<ast::x::HashTableEntry *> Lookup(const Value<hash_t> &hash_val) const {
     auto call = codegen_->CallBuiltin(ast::Builtin::AggHashTableLookup, {val_, hash_val.GetRaw()});
     call->SetType(codegen_->GetType<ast::x::HashTableEntry *>());
@@ -638,6 +663,15 @@ class Reference<ast::x::Sorter> {
     return Value<void>(codegen_->MakeStatement(call));
   }
 
+  Value<void> Init(const Value<ast::x::MemoryPool *> &mem_pool, ast::Identifier cmp_func_name,
+                   const Value<uint32_t> &row_size, const Value<uint32_t> &num_rows) const {
+    auto call = codegen_->CallBuiltin(ast::Builtin::SorterInit,
+                                      {val_, mem_pool.GetRaw(), codegen_->MakeExpr(cmp_func_name),
+                                       row_size.GetRaw(), num_rows.GetRaw()});
+    call->SetType(codegen_->GetType<void>());
+    return Value<void>(codegen_->MakeStatement(call));
+  }
+
   Value<uint8_t *> Insert() const {
     auto call = codegen_->CallBuiltin(ast::Builtin::SorterInsert, {val_});
     call->SetType(codegen_->GetType<uint8_t *>());
@@ -853,7 +887,7 @@ inline Value<void> VPIFilter(const Value<ast::x::VectorProjection *> &vp,
  */
 inline Value<void> InitSqlNull(const ReferenceVT &val) {
   CodeGen *codegen = val.GetCodeGen();
-  auto call = codegen->CallBuiltin(ast::Builtin::InitSqlNull, {val.GetRaw()});
+  auto call = codegen->CallBuiltin(ast::Builtin::InitSqlNull, {codegen->AddressOf(val.GetRaw())});
   call->SetType(codegen->NilType());
   return Value<void>(codegen->MakeStatement(call));
 }
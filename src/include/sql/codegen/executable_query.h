@@ -3,6 +3,9 @@
 #include <iosfwd>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "common/common.h"
@@ -18,6 +21,7 @@ class ErrorReporter;
 
 namespace tpl::sql {
 class ExecutionContext;
+class QueryProfile;
 }  // namespace tpl::sql
 
 namespace tpl::sql::planner {
@@ -35,6 +39,55 @@ namespace tpl::sql::codegen {
  */
 class ExecutableQuery {
  public:
+  /**
+   * Compile-time information about a single pipeline in a profiled query.
+   */
+  struct PipelineInfo {
+    // The ID of the pipeline.
+    PipelineId id;
+    // A human-readable description.
+    std::string description;
+    // The operator driving the pipeline. Per-tuple statistics are relative to its output.
+    const planner::AbstractPlanNode *source;
+    // Is the pipeline executed in parallel?
+    bool parallel;
+  };
+
+  /**
+   * Compile-time information about a profiled query needed to interpret its runtime statistics.
+   */
+  struct ProfileInfo {
+    // The ID of each plan node in the profile.
+    std::unordered_map<const planner::AbstractPlanNode *, uint32_t> operator_ids;
+    // The IDs of the operators whose output is counted. The last operator of a pipeline consumes
+    // tuples without producing any in that pipeline, so it's counted only if it isn't last in
+    // some other pipeline.
+    std::unordered_set<uint32_t> counted_operators;
+    // The total number of pipelines.
+    std::size_t num_pipelines{0};
+    // Each pipeline, in execution order.
+    std::vector<PipelineInfo> pipelines;
+  };
+
+  /**
+   * Time spent in each phase of generating and compiling the query to bytecode, and the memory
+   * consumed by the results. Times are in milliseconds; sizes in bytes.
+   */
+  struct CompileStats {
+    // Translating the plan into a TPL AST.
+    double codegen_ms{0.0};
+    // Type-checking the AST.
+    double sema_ms{0.0};
+    // Generating bytecode.
+    double bytecode_gen_ms{0.0};
+    // Building the executable module.
+    double module_gen_ms{0.0};
+    // Memory used by the AST context.
+    std::size_t ast_bytes{0};
+    // The size of the generated bytecode.
+    std::size_t bytecode_bytes{0};
+  };
+
   /**
    * Create a query object.
    * @param plan The physical plan.
@@ -42,7 +95,7 @@ class ExecutableQuery {
   explicit ExecutableQuery(const planner::AbstractPlanNode &plan);
 
   /**
-   * Destructor.
+   * Destructor. Waits for all pending compilations of the query's modules.
    */
   ~ExecutableQuery();
 
@@ -58,22 +111,83 @@ class ExecutableQuery {
              std::size_t query_state_size);
 
   /**
-   * Execute the query.
+   * Mark this query as profiled. Each run of a profiled query collects runtime statistics.
+   * @param profile_info Information needed to interpret the collected statistics.
+   */
+  void EnableProfiling(ProfileInfo &&profile_info);
+
+  /**
+   * Execute the query. When executing in compiled mode, all modules are compiled into machine code
+   * in parallel in the background, and each step only waits for the module it runs. In adaptive
+   * mode, each module is compiled once the interpreter has profiled enough of its execution.
    * @param exec_ctx The context in which to execute the query.
    * @param mode The execution mode to use when running the query. By default, its interpreted.
    */
   void Run(ExecutionContext *exec_ctx, vm::ExecutionMode mode = vm::ExecutionMode::Interpret);
 
+  /**
+   * Wait for all compilations of the query's modules into machine code started by previous runs.
+   */
+  void WaitForCompilation();
+
+  /**
+   * @return True if this query collects runtime statistics when run; false otherwise.
+   */
+  bool IsProfiled() const { return profile_info_ != nullptr; }
+
+  /**
+   * @return The runtime statistics of the most recent run of this query. NULL if the query is not
+   *         profiled, or has not been run.
+   */
+  const QueryProfile *GetProfile() const { return profile_.get(); }
+
+  /**
+   * @return The ID of the operator implementing the given plan node in the query's profile.
+   */
+  uint32_t GetOperatorId(const planner::AbstractPlanNode &node) const;
+
+  /**
+   * @return True if the profile counts the tuples produced by the given plan node; false if the
+   *         node only ever ends pipelines.
+   */
+  bool IsOperatorCounted(const planner::AbstractPlanNode &node) const;
+
+  /**
+   * Print the plan annotated with the runtime statistics of the most recent run, in the style of
+   * EXPLAIN ANALYZE. The query must be profiled and have been run at least once.
+   * @param os The stream to print to.
+   */
+  void PrintProfile(std::ostream &os) const;
+
   /**
    * @return The physical plan this executable query implements.
    */
   const planner::AbstractPlanNode &GetPlan() const { return plan_; }
 
+  /**
+   * @return Statistics about the generation and compilation of this query.
+   */
+  const CompileStats &GetCompileStats() const { return compile_stats_; }
+
+  /**
+   * Set the statistics about the generation and compilation of this query.
+   */
+  void SetCompileStats(const CompileStats &compile_stats) { compile_stats_ = compile_stats; }
+
+  /**
+   * @return The compiled modules making up the query.
+   */
+  const std::vector<std::unique_ptr<vm::Module>> &GetModules() const { return modules_; }
+
   /**
    * @return The AST context.
    */
   ast::Context *GetContext() { return ast_context_.get(); }
 
+ private:
+  // Compiles the query's modules into machine code on the thread pool.
+  class BackgroundCompiler;
+
  private:
   // The plan.
   const planner::AbstractPlanNode &plan_;
@@ -93,6 +207,15 @@ class ExecutableQuery {
   ExecutionPlan execution_plan_;
   // The query state size.
   std::size_t query_state_size_;
+  // Profiling information, if the query is profiled.
+  std::unique_ptr<ProfileInfo> profile_info_;
+  // The runtime statistics of the most recent run.
+  std::unique_ptr<QueryProfile> profile_;
+  // Compilation statistics.
+  CompileStats compile_stats_;
+  // Machine code compilation of all modules started by a compiled run, if any. Adaptive runs
+  // compile each module on its own. The destructor waits for both before any member is destroyed.
+  std::unique_ptr<BackgroundCompiler> background_compiler_;
 };
 
 }  // namespace tpl::sql::codegen
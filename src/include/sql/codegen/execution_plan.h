@@ -8,6 +8,10 @@
 #include "sql/codegen/codegen_defs.h"
 #include "vm/vm_defs.h"
 
+namespace tpl::sql {
+class QueryProfile;
+}  // namespace tpl::sql
+
 namespace tpl::vm {
 class Module;
 }  // namespace tpl::vm
@@ -75,11 +79,14 @@ class ExecutionPlan {
   explicit ExecutionPlan(std::vector<ExecutionStep> &&steps);
 
   /**
-   * Run the plan using the provided query state, and using the given execution mode.
+   * Run the plan using the provided query state, and using the given execution mode. If a profile
+   * is provided, the time spent in each pipeline and, where available, the hardware counters
+   * sampled while running it are recorded into it.
    * @param query_state The query state.
    * @param mode The execution mode.
+   * @param profile The optional profile to record pipeline statistics into.
    */
-  void Run(byte query_state[], vm::ExecutionMode mode) const;
+  void Run(byte query_state[], vm::ExecutionMode mode, QueryProfile *profile = nullptr) const;
 
  private:
   // The steps in the plan.
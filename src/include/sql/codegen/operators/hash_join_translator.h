@@ -126,8 +126,10 @@ class HashJoinTranslator : public OperatorTranslator {
   void CheckRightMark(ConsumerContext *ctx, FunctionBuilder *function,
                       const edsl::Variable<bool> &right_mark) const;
 
-  // Check the join predicate.
-  void CheckJoinPredicate(ConsumerContext *condition, FunctionBuilder *function) const;
+  // Check the join predicate. If a right mark is provided, it is cleared for
+  // every valid join pair.
+  void CheckJoinPredicate(ConsumerContext *condition, FunctionBuilder *function,
+                          const edsl::Variable<bool> *right_mark = nullptr) const;
 
   // When probing the hash table, should we compare hash values?
   // This is useful to speed up probes when complex keys are present
@@ -141,6 +143,9 @@ class HashJoinTranslator : public OperatorTranslator {
   std::unique_ptr<edsl::VariableVT> build_row_;
   // For mark-based joins. The index in the row where the mark is stored.
   uint32_t build_mark_index_;
+  // For right-outer joins. While non-empty, build-side attributes are read
+  // from these NULL values rather than from the materialized build row.
+  mutable std::vector<edsl::VariableVT> null_build_row_;
 
   // The name of the analysis and compression functions.
   ast::Identifier analysis_fn_name_;
@@ -129,6 +129,21 @@ class PipelineContext {
   // Access the current thread's pipeline state.
   edsl::ValueVT AccessCurrentThreadState() const;
 
+  // Declare the counters used to profile the pipeline in the pipeline state.
+  void DeclareProfileCounters();
+
+  // Reset all profiling counters in the current thread's state.
+  void InitializeProfileCounters(FunctionBuilder *function) const;
+
+  // Record all profiling counters in the current thread's state into the query's profile.
+  void RecordProfileCounters(FunctionBuilder *function) const;
+
+  // Count one tuple produced by the given operator, if profiling.
+  void CountTuple(const OperatorTranslator &op, FunctionBuilder *function) const;
+
+  // Count one morsel processed by the current thread, if profiling.
+  void CountMorsel(FunctionBuilder *function) const;
+
  private:
   // The pipeline.
   const Pipeline &pipeline_;
@@ -138,6 +153,11 @@ class PipelineContext {
   ast::Identifier state_var_;
   // The pipeline state.
   ExecutionState state_;
+  // The profiling counters. These are declared only if the query is profiled. Tuples are counted
+  // for each operator feeding another operator in the pipeline.
+  using ProfileCounter = ExecutionState::Slot<uint64_t>;
+  std::vector<std::pair<const OperatorTranslator *, ProfileCounter>> tuple_counters_;
+  ProfileCounter morsel_counter_;
 };
 
 /**
@@ -22,7 +22,11 @@ class ColumnSegment {
    * @param num_tuples The number of tuples in this segment.
    */
   ColumnSegment(Type type, byte *data, uint32_t *null_bitmap, uint32_t num_tuples) noexcept
-      : type_(type), data_(data), null_bitmap_(null_bitmap), num_tuples_(num_tuples) {}
+      : type_(type),
+        data_(data),
+        null_bitmap_(null_bitmap),
+        num_tuples_(num_tuples),
+        has_nulls_(ComputeHasNulls()) {}
 
   /**
    * Move constructor.
@@ -32,7 +36,8 @@ class ColumnSegment {
       : type_(other.type_),
         data_(other.data_),
         null_bitmap_(other.null_bitmap_),
-        num_tuples_(other.num_tuples_) {
+        num_tuples_(other.num_tuples_),
+        has_nulls_(other.has_nulls_) {
     other.data_ = nullptr;
     other.null_bitmap_ = nullptr;
   }
@@ -70,7 +75,15 @@ class ColumnSegment {
    * @param idx The index to check
    * @return True if the value is null; false otherwise
    */
-  bool IsNullAt(uint32_t idx) const { return util::BitUtil::Test(null_bitmap_, idx); }
+  bool IsNullAt(uint32_t idx) const {
+    return has_nulls_ && util::BitUtil::Test(null_bitmap_, idx);
+  }
+
+  /**
+   * @return True if any value in the column is NULL; false otherwise. Non-nullable columns and
+   *         nullable columns whose values happen to all be non-NULL have no NULLs.
+   */
+  bool HasNulls() const { return has_nulls_; }
 
   /**
    * @return The SQL type of the column.
@@ -85,6 +98,21 @@ class ColumnSegment {
  private:
   friend class ColumnVectorIterator;
 
+  // Check if any of the first num_tuples_ bits in the NULL bitmap is set.
+  bool ComputeHasNulls() const noexcept {
+    if (null_bitmap_ == nullptr || !type_.IsNullable()) {
+      return false;
+    }
+    const uint32_t num_full_words = num_tuples_ / util::BitUtil::kBitWordSize;
+    for (uint32_t i = 0; i < num_full_words; i++) {
+      if (null_bitmap_[i] != 0) return true;
+    }
+    for (uint32_t i = num_full_words * util::BitUtil::kBitWordSize; i < num_tuples_; i++) {
+      if (util::BitUtil::Test(null_bitmap_, i)) return true;
+    }
+    return false;
+  }
+
   auto *AccessRaw(uint32_t idx) const { return &data_[idx]; }
 
   auto *AccessRawNullBitmap(uint32_t idx) const { return &null_bitmap_[idx]; }
@@ -101,6 +129,9 @@ class ColumnSegment {
 
   // The number of tuples
   uint32_t num_tuples_;
+
+  // Whether any tuple is NULL
+  bool has_nulls_;
 };
 
 }  // namespace tpl::sql
@@ -59,15 +59,21 @@ class ColumnVectorIterator {
   byte *GetColumnData() const noexcept { return col_data_; }
 
   /**
-   * @return The the current vector chunk's raw NULL bitmap.
+   * @return The the current vector chunk's raw NULL bitmap, or NULL if the column segment has no
+   *         NULL values.
    */
   uint32_t *GetColumnNullBitmap() noexcept { return col_null_bitmap_; }
 
   /**
-   * @return The the current vector chunk's raw NULL bitmap.
+   * @return The the current vector chunk's raw NULL bitmap, or NULL if the column segment has no
+   *         NULL values.
    */
   uint32_t *GetColumnNullBitmap() const noexcept { return col_null_bitmap_; }
 
+ private:
+  // Return the NULL bitmap of the current segment starting at position @em block_pos.
+  uint32_t *GetNullBitmapAt(uint32_t block_pos) const noexcept;
+
  private:
   // The schema information for the column this iterator operates on
   const Schema::ColumnInfo *col_info_;
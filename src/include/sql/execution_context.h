@@ -15,6 +15,7 @@ class OutputSchema;
 }  // namespace planner
 
 class MemoryPool;
+class QueryProfile;
 class Schema;
 
 /**
@@ -35,7 +36,8 @@ class ExecutionContext {
       : mem_pool_(mem_pool),
         buffer_(schema == nullptr ? nullptr
                                   : std::make_unique<ResultBuffer>(mem_pool, *schema, consumer)),
-        thread_state_container_(mem_pool_) {
+        thread_state_container_(mem_pool_),
+        profile_(nullptr) {
     TPL_ASSERT(mem_pool != nullptr, "Null memory-pool provided to execution context");
   }
 
@@ -64,6 +66,17 @@ class ExecutionContext {
    */
   ThreadStateContainer *GetThreadStateContainer() { return &thread_state_container_; }
 
+  /**
+   * @return The profile to record runtime statistics into; NULL if the query isn't profiled.
+   */
+  QueryProfile *GetQueryProfile() { return profile_; }
+
+  /**
+   * Set the profile to record runtime statistics into.
+   * @param profile The profile. Can be NULL to disable profiling.
+   */
+  void SetQueryProfile(QueryProfile *profile) { profile_ = profile; }
+
  private:
   // Pool for memory allocations required during execution
   MemoryPool *mem_pool_;
@@ -77,6 +90,9 @@ class ExecutionContext {
   // Container for thread-local state. During parallel processing, execution
   // threads access their thread-local state from this container.
   ThreadStateContainer thread_state_container_;
+
+  // Runtime statistics of a profiled query, if any.
+  QueryProfile *profile_;
 };
 
 }  // namespace tpl::sql
@@ -3,6 +3,7 @@
 #include <limits>
 #include <string>
 
+#include "common/macros.h"
 #include "sql/value.h"
 
 namespace tpl::sql {
@@ -24,9 +25,9 @@ class StringFunctions : public AllStatic {
   static void Left(StringVal *result, ExecutionContext *ctx, const StringVal &str,
                    const Integer &n);
 
-  static void Length(Integer *result, ExecutionContext *ctx, const StringVal &str);
+  JIT_INLINABLE static void Length(Integer *result, ExecutionContext *ctx, const StringVal &str);
 
-  static void Lower(StringVal *result, ExecutionContext *ctx, const StringVal &str);
+  JIT_INLINABLE static void Lower(StringVal *result, ExecutionContext *ctx, const StringVal &str);
 
   static void Lpad(StringVal *result, ExecutionContext *ctx, const StringVal &str,
                    const Integer &len, const StringVal &pad);
@@ -55,8 +56,8 @@ class StringFunctions : public AllStatic {
   static void SplitPart(StringVal *result, ExecutionContext *ctx, const StringVal &str,
                         const StringVal &delim, const Integer &field);
 
-  static void Substring(StringVal *result, ExecutionContext *ctx, const StringVal &str,
-                        const Integer &pos, const Integer &len);
+  JIT_INLINABLE static void Substring(StringVal *result, ExecutionContext *ctx,
+                                      const StringVal &str, const Integer &pos, const Integer &len);
 
   static void Substring(StringVal *result, ExecutionContext *ctx, const StringVal &str,
                         const Integer &pos) {
@@ -68,10 +69,10 @@ class StringFunctions : public AllStatic {
 
   static void Trim(StringVal *result, ExecutionContext *ctx, const StringVal &str);
 
-  static void Upper(StringVal *result, ExecutionContext *ctx, const StringVal &str);
+  JIT_INLINABLE static void Upper(StringVal *result, ExecutionContext *ctx, const StringVal &str);
 
-  static void Like(BoolVal *result, ExecutionContext *ctx, const StringVal &string,
-                   const StringVal &pattern);
+  JIT_INLINABLE static void Like(BoolVal *result, ExecutionContext *ctx, const StringVal &string,
+                                 const StringVal &pattern);
 };
 
 }  // namespace tpl::sql
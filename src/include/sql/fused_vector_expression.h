@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "common/common.h"
+#include "common/macros.h"
+#include "sql/sql.h"
+
+namespace tpl::sql {
+
+class TupleIdList;
+class Vector;
+class VectorProjection;
+
+namespace planner {
+class AbstractExpression;
+}  // namespace planner
+
+/**
+ * A fused, single-pass evaluator of an arithmetic or comparison expression tree over a vector
+ * projection.
+ *
+ * Evaluating an expression like (a * (1 - b) * (1 + c)) using VectorOps materializes a full vector
+ * for every intermediate result, and each operation makes a pass over memory. A fused expression
+ * instead walks the active tuples of the projection once, in small chunks. All operations of the
+ * expression are applied to a chunk before moving on to the next, using chunk-sized scratch
+ * registers that remain cache-resident. Only the inputs are read from and the final result is
+ * written to memory.
+ *
+ * Expressions are compiled from planner expressions. Supported nodes are:
+ * - Column references (ColumnValueExpression). The column OID is the index of the column in the
+ *   input projection. Columns must be numeric.
+ * - Numeric constants (ConstantValueExpression).
+ * - Binary arithmetic (BinaryExpression): +, -, *, /.
+ * - Comparisons (ComparisonExpression): =, !=, <, <=, >, >=.
+ * - Conjunctions (ConjunctionExpression): AND only.
+ * - CASE (CaseExpression), at the root of an arithmetic expression, or as the result of an
+ *   enclosing CASE. Each WHEN predicate refines the list of TIDs not matched by an earlier clause,
+ *   and its THEN result is computed only over the TIDs that matched and scattered into the output.
+ *   This replaces per-tuple branching with tight, branch-free loops over each partition.
+ *
+ * Each operation is computed in 64-bit integers if both of its operands are integral, and in
+ * doubles otherwise, so integer division truncates even if its result is later combined with a
+ * floating-point value. Integral operands of a floating-point operation are converted explicitly.
+ * Likewise, each result of a CASE is computed in its own type and converted to the type of the
+ * CASE, which is floating-point if any of its results is. NULLs are strict: a tuple with a NULL in
+ * any referenced column produces NULL (or doesn't qualify, for predicates), as does division by
+ * zero. This is also why OR isn't supported. Dividing the smallest BIGINT by -1 wraps around.
+ *
+ * Usage:
+ * @code
+ * auto expr = FusedVectorExpression::Compile(*plan_expr, col_types);
+ * if (expr->IsPredicate()) {
+ *   expr->Select(vector_projection, &tid_list);
+ * } else {
+ *   Vector result(expr->GetResultType(), true, false);
+ *   expr->Evaluate(vector_projection, &result);
+ * }
+ * @endcode
+ */
+class FusedVectorExpression {
+ public:
+  /**
+   * The number of tuples processed by each operation before moving to the next operation.
+   */
+  static constexpr uint32_t kChunkSize = 256;
+
+  /**
+   * Compile the given planner expression into a fused evaluator over vector projections whose
+   * columns have the provided types.
+   * @throw NotImplementedException if the expression contains an unsupported node or type.
+   * @param expr The expression to compile.
+   * @param col_types The types of the columns in the input vector projections.
+   * @return The compiled expression.
+   */
+  static std::unique_ptr<FusedVectorExpression> Compile(const planner::AbstractExpression &expr,
+                                                        const std::vector<TypeId> &col_types);
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(FusedVectorExpression);
+
+  /**
+   * @return True if this expression is a predicate, i.e., a comparison or conjunction; false if
+   *         it's an arithmetic expression.
+   */
+  bool IsPredicate() const noexcept { return is_predicate_; }
+
+  /**
+   * @return The primitive type of the result of an arithmetic expression: BigInt or Double.
+   *         Predicates produce BigInt truth values.
+   */
+  TypeId GetResultType() const noexcept { return compute_type_; }
+
+  /**
+   * Evaluate this arithmetic expression on all active tuples in the vector projection, and store
+   * the results into @em result. The result has the same shape as the projection.
+   * @pre The expression isn't a predicate, and the result vector has type GetResultType().
+   * @param vector_projection The input projection.
+   * @param[out] result The result vector.
+   */
+  void Evaluate(const VectorProjection &vector_projection, Vector *result) const;
+
+  /**
+   * Evaluate this predicate on the tuples in @em tid_list, retaining only those that qualify.
+   * @pre The expression is a predicate.
+   * @param vector_projection The input projection.
+   * @param[in,out] tid_list The list of TIDs to operate on and filter.
+   */
+  void Select(const VectorProjection &vector_projection, TupleIdList *tid_list) const;
+
+ private:
+  friend class FusedExpressionCompiler;
+
+  // Operations.
+  enum class OpCode : uint8_t {
+    Load,
+    Fill,
+    Cast,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Equal,
+    NotEqual,
+    LessThan,
+    LessThanEqual,
+    GreaterThan,
+    GreaterThanEqual,
+    And,
+  };
+
+  // An input to an operation: either a register, or a constant.
+  struct Operand {
+    bool is_constant;
+    uint16_t reg;
+    int64_t int_val;
+    double double_val;
+  };
+
+  // A single operation, computed in 'type', either BigInt or Double. Integer and floating-point
+  // values live in separate register files. Loads convert column 'col_idx' into register 'dst'.
+  // Fills broadcast the constant 'lhs' into register 'dst'. Casts convert the integer register
+  // 'lhs' into the floating-point register 'dst'. Other operations compute 'dst = lhs <op> rhs';
+  // comparisons and conjunctions write integer truth values.
+  struct Instruction {
+    OpCode op;
+    TypeId type;
+    uint16_t dst;
+    uint32_t col_idx;
+    Operand lhs, rhs;
+  };
+
+  // Use Compile().
+  explicit FusedVectorExpression(std::vector<TypeId> col_types);
+
+  // Apply a binary operation to two scalars. Used to fold constants.
+  template <typename T>
+  static T Apply(OpCode op, T a, T b);
+
+  // The value of a constant operand in the compute type T; zero for register operands.
+  template <typename T>
+  static T ConstantValue(const Operand &operand) {
+    if (!operand.is_constant) return T(0);
+    if constexpr (std::is_floating_point_v<T>) {
+      return operand.double_val;
+    } else {
+      return operand.int_val;
+    }
+  }
+
+  // A WHEN ... THEN ... clause of a CASE expression.
+  struct CaseClause {
+    std::unique_ptr<FusedVectorExpression> when;
+    std::unique_ptr<FusedVectorExpression> then;
+  };
+
+  // Evaluate this arithmetic expression on the given TIDs only, writing into 'result'.
+  void EvaluateInto(const VectorProjection &vector_projection, const sel_t *tids,
+                    uint32_t num_tids, Vector *result) const;
+
+  // Evaluate this CASE expression on the given TIDs only, writing into 'result'.
+  void EvaluateCase(const VectorProjection &vector_projection, const sel_t *tids,
+                    uint32_t num_tids, Vector *result) const;
+
+  // Run the program on the given TIDs, invoking 'consumer' with each chunk's results of type T.
+  template <typename T, typename F>
+  void Run(const VectorProjection &vector_projection, const sel_t *tids, uint32_t num_tids,
+           F &&consumer) const;
+
+  // Execute one instruction computed in type T on a chunk of 'n' tuples.
+  template <typename T>
+  static void Execute(const Instruction &instr, const VectorProjection &vector_projection,
+                      const sel_t *tids, uint32_t n, int64_t *int_registers,
+                      double *double_registers, uint8_t *invalid);
+
+ private:
+  // The types of the input columns.
+  std::vector<TypeId> col_types_;
+  // The columns referenced by the expression.
+  std::vector<uint32_t> referenced_cols_;
+  // The program.
+  std::vector<Instruction> program_;
+  // The number of registers the program needs.
+  uint16_t num_registers_;
+  // The type of the result.
+  TypeId compute_type_;
+  // Is this a predicate?
+  bool is_predicate_;
+  // If this is a CASE expression, its clauses and optional ELSE result. CASE expressions have no
+  // program of their own.
+  std::vector<CaseClause> case_clauses_;
+  std::unique_ptr<FusedVectorExpression> case_default_;
+  bool is_case_;
+};
+
+}  // namespace tpl::sql
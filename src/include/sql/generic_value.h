@@ -25,6 +25,7 @@ class GenericValue {
   friend class Vector;
   friend class VectorOps;
   friend class GenericValueTests;
+  friend class FusedExpressionCompiler;
   friend class codegen::ConstantTranslator;
 
  public:
@@ -45,6 +46,14 @@ class GenericValue {
    */
   bool Equals(const GenericValue &other) const;
 
+  /**
+   * Does this value order before the provided value? Both values must have the same type. NULLs
+   * order before all non-NULL values. This is NOT SQL comparison!
+   * @param other The value to compare with.
+   * @return True if this value is less than @em other; false otherwise.
+   */
+  bool LessThan(const GenericValue &other) const;
+
   /**
    * Cast this value to the given type.
    * @param type The type to cast to.
@@ -72,6 +81,11 @@ class GenericValue {
    */
   bool operator!=(const GenericValue &that) const { return !(*this == that); }
 
+  /**
+   * @return True if this value orders before @em that. Note that this is NOT SQL comparison!
+   */
+  bool operator<(const GenericValue &that) const { return LessThan(that); }
+
   // -------------------------------------------------------
   // Static factory methods
   // -------------------------------------------------------
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "common/macros.h"
 #include "sql/chaining_hash_table.h"
 #include "sql/concise_hash_table.h"
 #include "sql/memory_pool.h"
@@ -167,7 +168,7 @@ class JoinHashTable {
    * @param hash The hash value of the tuple to insert.
    * @return A memory region where the caller can materialize the tuple.
    */
-  byte *AllocInputTuple(hash_t hash);
+  JIT_INLINABLE byte *AllocInputTuple(hash_t hash);
 
   /**
    * Build and finalize the join hash table. After finalization, no new insertions are allowed and
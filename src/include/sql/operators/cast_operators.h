@@ -7,6 +7,7 @@
 #include "common/common.h"
 #include "common/exception.h"
 #include "sql/runtime_types.h"
+#include "util/fast_integer_parser.h"
 
 namespace tpl::sql {
 
@@ -386,9 +387,7 @@ template <typename OutType>
 struct TryCast<VarlenEntry, OutType, std::enable_if_t<detail::is_integer_type_v<OutType>>> {
   bool operator()(const VarlenEntry &input, OutType *output) const {
     const auto buf = reinterpret_cast<const char *>(input.GetContent());
-    const auto len = input.GetSize();
-    const auto [p, ec] = std::from_chars(buf, buf + len, *output);
-    return ec == std::errc();
+    return util::FastIntegerParser::Parse(buf, buf + input.GetSize(), output);
   }
 };
 
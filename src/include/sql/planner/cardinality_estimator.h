@@ -0,0 +1,51 @@
+#pragma once
+
+#include <optional>
+
+#include "common/common.h"
+
+namespace tpl::sql::planner {
+
+class AbstractExpression;
+class AbstractPlanNode;
+
+/**
+ * Estimates the cardinality of plan nodes and the number of distinct values of expressions using
+ * the table statistics stored in the catalog (see Catalog::AnalyzeTable()). Estimates are used to
+ * presize runtime structures such as hash tables and sorters. When a plan reads a table that has
+ * not been analyzed, no estimate is made.
+ *
+ * Estimates lean towards over-estimation. Filters are only considered when they compare a column
+ * to a constant; joins are assumed to be foreign-key joins producing as many rows as the probe
+ * side.
+ */
+class CardinalityEstimator : public AllStatic {
+ public:
+  /**
+   * Estimate the number of rows produced by the given plan node.
+   * @param plan The plan node.
+   * @return The estimated number of output rows, if an estimate can be made.
+   */
+  static std::optional<uint64_t> EstimateOutputRows(const AbstractPlanNode &plan);
+
+  /**
+   * Estimate the number of distinct values the expression @em expr takes over the input of the
+   * plan node @em plan. The expression is evaluated in the context of the plan node, i.e., it may
+   * only reference the plan's table (for scans) or the outputs of its children. Only expressions
+   * that directly reference table columns are estimated.
+   * @param plan The plan node in whose context the expression is evaluated.
+   * @param expr The expression.
+   * @return The estimated number of distinct values, if an estimate can be made.
+   */
+  static std::optional<uint64_t> EstimateDistinctValues(const AbstractPlanNode &plan,
+                                                        const AbstractExpression &expr);
+
+  /**
+   * Estimate the number of groups an aggregation plan node produces.
+   * @param plan The aggregation plan node.
+   * @return The estimated number of groups, if an estimate can be made.
+   */
+  static std::optional<uint64_t> EstimateGroupCount(const AbstractPlanNode &plan);
+};
+
+}  // namespace tpl::sql::planner
@@ -21,6 +21,17 @@ class ExpressionUtil : public AllStatic {
    * @return True if the given expression is a LIKE or NOT LIKE expression. False otherwise.
    */
   static bool IsLikeComparison(const AbstractExpression &expr);
+
+  /**
+   * @return True if the given expression is a BETWEEN expression. False otherwise.
+   */
+  static bool IsBetweenComparison(const AbstractExpression &expr);
+
+  /**
+   * @return True if the given expression is of the form: col BETWEEN const AND const. False
+   *         otherwise.
+   */
+  static bool IsColumnBetweenConsts(const AbstractExpression &expr);
 };
 
 }  // namespace tpl::sql::planner
@@ -94,10 +94,12 @@ class AbstractJoinPlanNode : public AbstractPlanNode {
   }
 
   /**
-   * @return True if the join requires a right-mark.
+   * @return True if the join requires a right-mark. Right-semi, right-anti and right-outer joins
+   *         require marks on the right side to indicate if the right-tuple found a join partner.
    */
   bool RequiresRightMark() const {
     switch (join_type_) {
+      case LogicalJoinType::RIGHT:
       case LogicalJoinType::RIGHT_SEMI:
       case LogicalJoinType::RIGHT_ANTI:
         return true;
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "common/macros.h"
+#include "util/perf_counters.h"
+
+namespace tpl::sql {
+
+/**
+ * Runtime statistics collected during one execution of a profiled query. Operators and pipelines
+ * are identified by dense IDs assigned at compilation time. Statistics are recorded by generated
+ * code when thread-local pipeline state is torn down, and by the execution plan as it runs each
+ * pipeline. All recording functions are thread-safe.
+ */
+class QueryProfile {
+ public:
+  /**
+   * Create an empty profile for a query with the given number of operators and pipelines.
+   * @param num_operators The number of operators in the query.
+   * @param num_pipelines The number of pipelines in the query.
+   */
+  QueryProfile(uint32_t num_operators, uint32_t num_pipelines);
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(QueryProfile);
+
+  /**
+   * Record that the operator with ID @em operator_id produced @em num_tuples tuples.
+   * @param operator_id The ID of the operator.
+   * @param num_tuples The number of tuples produced.
+   */
+  void RecordTuples(uint32_t operator_id, uint64_t num_tuples);
+
+  /**
+   * Record that a single thread processed @em num_morsels morsels in the pipeline with ID
+   * @em pipeline_id.
+   * @param pipeline_id The ID of the pipeline.
+   * @param num_morsels The number of morsels the thread processed.
+   */
+  void RecordMorsels(uint32_t pipeline_id, uint64_t num_morsels);
+
+  /**
+   * Record that @em ms milliseconds were spent executing the pipeline with ID @em pipeline_id.
+   * @param pipeline_id The ID of the pipeline.
+   * @param ms The elapsed wall time in milliseconds.
+   */
+  void RecordPipelineTime(uint32_t pipeline_id, double ms);
+
+  /**
+   * Record hardware counters sampled while executing the pipeline with ID @em pipeline_id.
+   * @param pipeline_id The ID of the pipeline.
+   * @param counters The sampled counters.
+   */
+  void RecordPipelineCounters(uint32_t pipeline_id, const util::PerfCounters::Sample &counters);
+
+  /**
+   * @return The total number of tuples produced by the operator with ID @em operator_id.
+   */
+  uint64_t GetNumTuples(uint32_t operator_id) const;
+
+  /**
+   * @return The total wall time in milliseconds spent in the pipeline with ID @em pipeline_id.
+   */
+  double GetPipelineTime(uint32_t pipeline_id) const;
+
+  /**
+   * @return The number of morsels processed by each thread that participated in the pipeline with
+   *         ID @em pipeline_id.
+   */
+  std::vector<uint64_t> GetMorselsPerThread(uint32_t pipeline_id) const;
+
+  /**
+   * @return The hardware counters sampled in the pipeline with ID @em pipeline_id. All zero if
+   *         counters were unavailable.
+   */
+  util::PerfCounters::Sample GetPipelineCounters(uint32_t pipeline_id) const;
+
+ private:
+  struct PipelineStats {
+    // Wall time.
+    double time_ms{0.0};
+    // Morsels processed by each participating thread.
+    std::vector<uint64_t> thread_morsels;
+    // Hardware counters.
+    util::PerfCounters::Sample counters;
+  };
+
+  // Latch protecting all statistics.
+  mutable std::mutex mutex_;
+  // Tuples produced, per operator.
+  std::vector<uint64_t> operator_tuples_;
+  // Per-pipeline statistics.
+  std::vector<PipelineStats> pipelines_;
+};
+
+}  // namespace tpl::sql
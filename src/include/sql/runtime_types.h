@@ -135,6 +135,16 @@ class Date {
    */
   static Date FromYMD(int32_t year, int32_t month, int32_t day);
 
+  /**
+   * @return The native representation of this date: the Julian day number.
+   */
+  NativeType ToNative() const noexcept { return value_; }
+
+  /**
+   * @return A date from its native representation, the Julian day number.
+   */
+  static Date FromNative(NativeType value) noexcept { return Date(value); }
+
  private:
   friend class Timestamp;
   friend struct DateVal;
@@ -311,6 +321,16 @@ class Timestamp {
   static Timestamp FromYMDHMS(int32_t year, int32_t month, int32_t day, int32_t hour, int32_t min,
                               int32_t sec);
 
+  /**
+   * @return The native representation of this timestamp: microseconds since the Julian epoch.
+   */
+  NativeType ToNative() const noexcept { return value_; }
+
+  /**
+   * @return A timestamp from its native representation, microseconds since the Julian epoch.
+   */
+  static Timestamp FromNative(NativeType value) noexcept { return Timestamp(value); }
+
  private:
   friend class Date;
   friend struct TimestampVal;
@@ -330,7 +350,8 @@ class Timestamp {
 
 /**
  * A generic fixed point decimal value. This only serves as a storage container for decimals of
- * various sizes. Operations on decimals require a precision and scale.
+ * various sizes. Operations on decimals require a precision and scale. A decimal with scale S
+ * stores the value V as the integer V * 10^S, e.g., 12.34 with scale 2 is stored as 1234.
  * @tparam T The underlying native data type sufficiently large to store decimals of a
  *           pre-determined scale
  */
@@ -339,6 +360,11 @@ class Decimal {
  public:
   using NativeType = T;
 
+  /**
+   * The maximum number of decimal digits this decimal can store.
+   */
+  static constexpr uint32_t kMaxPrecision = sizeof(T) == 4 ? 9 : sizeof(T) == 8 ? 18 : 38;
+
   /**
    * Create a decimal value using the given raw underlying encoded value.
    * @param value The value to set this decimal to.
@@ -350,6 +376,42 @@ class Decimal {
    */
   operator T() const { return value_; }  // NOLINT
 
+  /**
+   * @return 10 raised to the power @em exp, i.e., the encoded value of 1 at scale @em exp.
+   */
+  static constexpr T PowerOfTen(uint32_t exp) {
+    T result = 1;
+    for (uint32_t i = 0; i < exp; i++) result *= 10;
+    return result;
+  }
+
+  /**
+   * Convert this decimal from scale @em from_scale to scale @em to_scale. Reducing the scale rounds
+   * half away from zero.
+   * @throw Exception of type ExceptionType::Decimal if the value doesn't fit after rescaling.
+   * @param from_scale The current scale of this decimal.
+   * @param to_scale The desired scale.
+   * @return The rescaled decimal value.
+   */
+  Decimal<T> Rescale(uint32_t from_scale, uint32_t to_scale) const;
+
+  /**
+   * @return A string representation of this decimal with the given scale.
+   */
+  std::string ToString(uint32_t scale) const;
+
+  /**
+   * Parse a decimal value with the given precision and scale from the string @em str. Fractional
+   * digits beyond the scale are rounded half away from zero.
+   * @throw ConversionException if the string isn't a valid number.
+   * @throw Exception of type ExceptionType::Decimal if the value exceeds the precision.
+   * @param str The string to parse.
+   * @param precision The total number of significant digits.
+   * @param scale The number of fractional digits.
+   * @return The parsed decimal value.
+   */
+  static Decimal<T> FromString(std::string_view str, uint32_t precision, uint32_t scale);
+
   /**
    * Compute the hash value of this decimal instance.
    * @param seed The value to seed the hash with.
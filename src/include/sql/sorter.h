@@ -76,6 +76,12 @@ class Sorter {
   static constexpr uint64_t kDefaultMinTuplesForParallelSort = 10000;
 #endif
 
+  /**
+   * The maximum number of tuples the sorter reserves space for up front. Estimates can be far off,
+   * so larger sorters grow as tuples arrive instead.
+   */
+  static constexpr uint32_t kMaxPresizedTupleCount = 1u << 20u;
+
   /** The structure used to materialized build tuples. */
   using TupleBuffer = util::ChunkedVector<MemoryPoolAllocator<byte>>;
 
@@ -94,6 +100,18 @@ class Sorter {
    */
   Sorter(MemoryPool *memory, ComparisonFunction cmp_fn, uint32_t tuple_size);
 
+  /**
+   * Construct a sorter using @em memory as the memory allocator, storing tuples @em tuple_size
+   * size in bytes, and using the comparison function @em cmp_fn. The sorter reserves space up front
+   * for @em expected_tuple_count tuples, but no more than kMaxPresizedTupleCount.
+   * @param memory The memory pool to allocate memory from
+   * @param cmp_fn The sorting comparison function
+   * @param tuple_size The sizes of the input tuples in bytes
+   * @param expected_tuple_count The expected number of input tuples
+   */
+  Sorter(MemoryPool *memory, ComparisonFunction cmp_fn, uint32_t tuple_size,
+         uint32_t expected_tuple_count);
+
   /**
    * Destructor.
    */
@@ -109,7 +127,7 @@ class Sorter {
    * contents.
    * @return A pointer to a contiguous chunk of memory where the tuple's contents are written.
    */
-  byte *AllocInputTuple();
+  JIT_INLINABLE byte *AllocInputTuple();
 
   /**
    * Tuple allocation for TopK. This call is must be paired with a subsequent call to
@@ -20,6 +20,7 @@ enum class TypeId : uint8_t {
   SmallInt,   // int16_t
   Integer,    // int32_t
   BigInt,     // int64_t
+  HugeInt,    // int128_t
   Hash,       // hash_t
   Pointer,    // uintptr_t
   Float,      // float
@@ -59,6 +60,18 @@ enum class ColumnEncoding : uint8_t {
   StringDict,
 };
 
+/**
+ * The fields of a date or timestamp that can be extracted or truncated to.
+ */
+enum class DatePart : uint8_t {
+  Year,
+  Quarter,
+  Month,
+  Day,
+  DayOfWeek,  // 0-Sun, 1-Mon, ..., 6-Sat
+  DayOfYear,
+};
+
 /**
  * All known operators.
  */
@@ -132,6 +145,8 @@ constexpr inline TypeId GetTypeId() {
     return TypeId::Integer;
   } else if constexpr (std::is_same<std::remove_const_t<T>, int64_t>()) {
     return TypeId::BigInt;
+  } else if constexpr (std::is_same<std::remove_const_t<T>, int128_t>()) {
+    return TypeId::HugeInt;
   } else if constexpr (std::is_same<std::remove_const_t<T>, hash_t>()) {
     return TypeId::Hash;
   } else if constexpr (std::is_same<std::remove_const_t<T>, uintptr_t>()) {
@@ -131,6 +131,13 @@ class Table {
    */
   VarlenHeap *GetMutableStringHeap() { return &strings_; }
 
+  /**
+   * Take ownership of an external string heap holding the contents of strings stored in this
+   * table's blocks. Used when blocks are built in parallel, each with its own heap.
+   * @param heap The heap to adopt.
+   */
+  void AdoptStringHeap(VarlenHeap &&heap) { adopted_strings_.emplace_back(std::move(heap)); }
+
  private:
   // The ID of the table.
   uint16_t id_;
@@ -142,6 +149,8 @@ class Table {
   BlockList blocks_;
   // Strings.
   VarlenHeap strings_;
+  // String heaps whose ownership was transferred to this table.
+  std::vector<VarlenHeap> adopted_strings_;
   // The total number of tuples in the table.
   uint32_t num_tuples_;
 };
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/common.h"
+#include "common/macros.h"
+#include "sql/generic_value.h"
+
+namespace tpl::sql {
+
+class Table;
+
+/**
+ * Statistics describing the distribution of values in a single column of a table. Statistics
+ * include the number of rows and NULLs, the minimum and maximum values, an estimate of the number
+ * of distinct values, an equi-depth histogram and the most common values along with their
+ * frequencies.
+ *
+ * The number of distinct values is estimated with a HyperLogLog sketch over all values in the
+ * column. Histograms and most-common values are built from a systematic sample of the column.
+ * Histograms are equi-depth: every bucket holds roughly the same number of non-NULL rows. The
+ * histogram is stored as the sorted list of bucket boundaries, i.e., a histogram with B buckets
+ * has B+1 boundaries, the first and last being the column's minimum and maximum value.
+ */
+class ColumnStatistics {
+ public:
+  /** The maximum number of buckets in a histogram. */
+  static constexpr uint32_t kMaxHistogramBuckets = 64;
+
+  /** The maximum number of most-common values to track. */
+  static constexpr uint32_t kMaxMostCommonValues = 16;
+
+  /** A value and the fraction of all rows in the column that have the value. */
+  using ValueFrequency = std::pair<GenericValue, double>;
+
+  /**
+   * Create column statistics.
+   * @param num_rows The total number of rows in the column.
+   * @param null_count The number of NULL rows in the column.
+   * @param distinct_count The estimated number of distinct non-NULL values.
+   * @param min The minimum non-NULL value, or a NULL value if the column has no non-NULL values.
+   * @param max The maximum non-NULL value, or a NULL value if the column has no non-NULL values.
+   * @param histogram_bounds The sorted boundaries of the equi-depth histogram.
+   * @param most_common_values The most common values, in descending order of frequency.
+   */
+  ColumnStatistics(uint64_t num_rows, uint64_t null_count, uint64_t distinct_count,
+                   GenericValue min, GenericValue max, std::vector<GenericValue> histogram_bounds,
+                   std::vector<ValueFrequency> most_common_values);
+
+  /**
+   * @return The total number of rows in the column, including NULLs.
+   */
+  uint64_t GetRowCount() const noexcept { return num_rows_; }
+
+  /**
+   * @return The number of NULL rows in the column.
+   */
+  uint64_t GetNullCount() const noexcept { return null_count_; }
+
+  /**
+   * @return The fraction of rows in the column that are NULL.
+   */
+  double GetNullFraction() const noexcept {
+    return num_rows_ == 0 ? 0.0 : static_cast<double>(null_count_) / num_rows_;
+  }
+
+  /**
+   * @return The estimated number of distinct non-NULL values in the column.
+   */
+  uint64_t GetDistinctCount() const noexcept { return distinct_count_; }
+
+  /**
+   * @return The minimum non-NULL value in the column. NULL if all values are NULL.
+   */
+  const GenericValue &GetMin() const noexcept { return min_; }
+
+  /**
+   * @return The maximum non-NULL value in the column. NULL if all values are NULL.
+   */
+  const GenericValue &GetMax() const noexcept { return max_; }
+
+  /**
+   * @return The sorted boundaries of the equi-depth histogram. Empty if the column does not have a
+   *         histogram.
+   */
+  const std::vector<GenericValue> &GetHistogramBounds() const noexcept { return histogram_bounds_; }
+
+  /**
+   * @return The most common values in the column, in descending order of frequency.
+   */
+  const std::vector<ValueFrequency> &GetMostCommonValues() const noexcept {
+    return most_common_values_;
+  }
+
+  /**
+   * Estimate the fraction of rows in the column equal to @em value.
+   * @param value The value to compare against. Must be of the column's type.
+   * @return The estimated selectivity in the range [0,1].
+   */
+  double EstimateEqualSelectivity(const GenericValue &value) const;
+
+  /**
+   * Estimate the fraction of rows in the column strictly less than @em value.
+   * @param value The value to compare against. Must be of the column's type.
+   * @return The estimated selectivity in the range [0,1].
+   */
+  double EstimateLessThanSelectivity(const GenericValue &value) const;
+
+ private:
+  // The number of rows and NULLs.
+  uint64_t num_rows_;
+  uint64_t null_count_;
+  // Estimated number of distinct values.
+  uint64_t distinct_count_;
+  // The value range.
+  GenericValue min_;
+  GenericValue max_;
+  // Equi-depth histogram boundaries.
+  std::vector<GenericValue> histogram_bounds_;
+  // The most common values.
+  std::vector<ValueFrequency> most_common_values_;
+};
+
+/**
+ * Statistics for all columns in a table. Statistics are computed by TableStatistics::Compute(),
+ * which scans all blocks of the table in parallel.
+ */
+class TableStatistics {
+ public:
+  /** The target number of rows to sample from a table to build histograms and common values. */
+  static constexpr uint64_t kTargetSampleSize = 30000;
+
+  /**
+   * Create table statistics.
+   * @param num_rows The number of rows in the table.
+   * @param columns The statistics of each column, in schema order.
+   */
+  TableStatistics(uint64_t num_rows, std::vector<ColumnStatistics> columns)
+      : num_rows_(num_rows), columns_(std::move(columns)) {}
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(TableStatistics);
+
+  /**
+   * Compute statistics over all columns in the given table.
+   * @param table The table to analyze.
+   * @return The computed statistics.
+   */
+  static std::unique_ptr<TableStatistics> Compute(const Table &table);
+
+  /**
+   * @return The number of rows in the table at the time statistics were computed.
+   */
+  uint64_t GetRowCount() const noexcept { return num_rows_; }
+
+  /**
+   * @return The number of columns.
+   */
+  uint32_t GetColumnCount() const noexcept { return static_cast<uint32_t>(columns_.size()); }
+
+  /**
+   * @return The statistics for the column at index @em col_idx in the table's schema.
+   */
+  const ColumnStatistics &GetColumnStatistics(uint32_t col_idx) const {
+    TPL_ASSERT(col_idx < columns_.size(), "Out-of-bounds column access");
+    return columns_[col_idx];
+  }
+
+ private:
+  // The number of rows.
+  uint64_t num_rows_;
+  // Per-column statistics.
+  std::vector<ColumnStatistics> columns_;
+};
+
+}  // namespace tpl::sql
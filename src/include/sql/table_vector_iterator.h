@@ -82,6 +82,11 @@ class TableVectorIterator {
    */
   const Table *GetTable() const { return block_iterator_.GetTable(); }
 
+  /**
+   * @return The current active vector projection.
+   */
+  VectorProjection *GetVectorProjection() { return &vector_projection_; }
+
   /**
    * @return The iterator over the current active vector projection.
    */
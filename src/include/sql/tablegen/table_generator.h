@@ -26,12 +26,29 @@ class TableGenerator {
   static void GenerateTPCHTables(sql::Catalog *catalog, const std::string &data_dir,
                                  bool compress = false);
 
+  /**
+   * Generate all TPC-H tables natively at the given scale factor. Data is generated in parallel
+   * directly into table blocks, following the value distributions of the TPC-H specification.
+   * Generation is deterministic, i.e., independent of the number of threads used.
+   * @param catalog The catalog instance to insert tables into.
+   * @param scale_factor The TPC-H scale factor. Scale factor 1 is roughly 1GB of data.
+   */
+  static void GenerateTPCHTables(sql::Catalog *catalog, double scale_factor);
+
   /**
    * Generate all Star-Schema Benchmark tables.
    * @param catalog The catalog instance to insert tables into.
    * @param data_dir The directory containing table data.
    */
   static void GenerateSSBMTables(sql::Catalog *catalog, const std::string &data_dir);
+
+  /**
+   * Generate all Star-Schema Benchmark tables natively at the given scale factor. Like TPC-H,
+   * generation is parallel and deterministic.
+   * @param catalog The catalog instance to insert tables into.
+   * @param scale_factor The SSB scale factor.
+   */
+  static void GenerateSSBMTables(sql::Catalog *catalog, double scale_factor);
 };
 
 }  // namespace tpl::sql::tablegen
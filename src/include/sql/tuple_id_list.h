@@ -2,9 +2,11 @@
 
 #include <algorithm>
 #include <iosfwd>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "common/macros.h"
 #include "util/bit_vector.h"
@@ -59,15 +61,20 @@ namespace tpl::sql {
  *
  * Implementation:
  * ---------------
- * TupleIdList is implemented as a very thin wrapper around a bit vector. They occupy 128 or 256
- * bytes to represent 1024 or 2048 tuples, respectively. Using a bit vector as the underlying data
- * structure enables efficient implementations of list intersection, union, and difference required
- * during expression evaluation. Moreover, bit vectors are amenable to auto-vectorization by the
- * compiler.
+ * A TupleIdList adapts its physical representation to its contents. It is one of:
+ * 1. Range: all TIDs in a contiguous range [begin, end). Empty and full lists are ranges, making
+ *    unfiltered vector projections as cheap to iterate as a plain loop.
+ * 2. Selection: a sorted array of TIDs (i.e., a selection index vector). Sparse lists are filtered,
+ *    iterated, and converted to selection vectors in time proportional to the number of TIDs they
+ *    contain, rather than their capacity.
+ * 3. Bitmap: a bit vector with one bit per TID in the list's capacity. They occupy 128 or 256 bytes
+ *    to represent 1024 or 2048 tuples, respectively. Bit vectors enable efficient implementations
+ *    of list intersection, union, and difference required during expression evaluation, and are
+ *    amenable to auto-vectorization by the compiler.
  *
- * The primary drawback of bit vectors is iteration: dense TID lists (also known as selection index
- * vectors) are faster to iterate over than bit vectors, more so when the selectivity of the vector
- * is low.
+ * Lists start out as ranges, fall back to bitmaps when modified in ways a range can't represent,
+ * and switch to selection vectors when filtering a list that is sparse enough. A bitmap is always
+ * available through TupleIdList::GetMutableBits(), but is only materialized on demand.
  */
 class TupleIdList {
  public:
@@ -147,11 +154,35 @@ class TupleIdList {
     uint32_t current_position_;
   };
 
+  /**
+   * The physical representation of the TIDs in a list.
+   */
+  enum class Representation : uint8_t {
+    // All TIDs in the half-open range [begin, end).
+    Range,
+    // A sorted array of TIDs.
+    Selection,
+    // A bit vector with one bit per TID in the capacity of the list.
+    Bitmap,
+  };
+
+  /**
+   * The maximum fraction of TIDs in the capacity of a list that may be active for the list to be
+   * filtered through a selection vector rather than a bitmap.
+   */
+  static constexpr float kMaxSelectionVectorDensity = 0.0625;
+
   /**
    * Construct an empty list capable of storing at least @em num_tuples tuple IDs.
    * @param num_tuples The maximum number of tuples in the list.
    */
-  explicit TupleIdList(uint32_t num_tuples) : bit_vector_(num_tuples) {}
+  explicit TupleIdList(uint32_t num_tuples)
+      : repr_(Representation::Range),
+        range_begin_(0),
+        range_end_(0),
+        sel_size_(0),
+        bit_vector_(num_tuples),
+        bits_valid_(true) {}
 
   /**
    * This class cannot be copied (but can be moved).
@@ -185,43 +216,67 @@ class TupleIdList {
    *
    * @param num_tuples The number of TIDs to list should be able to store.
    */
-  void Resize(const uint32_t num_tuples) { bit_vector_.Resize(num_tuples); }
+  void Resize(uint32_t num_tuples);
 
   /**
    * @return True if the given TID @em tid is in the list; false otherwise.
    */
-  bool Contains(const uint32_t tid) const { return bit_vector_.Test(tid); }
+  bool Contains(const uint32_t tid) const {
+    if (repr_ == Representation::Range) {
+      return range_begin_ <= tid && tid < range_end_;
+    }
+    return GetBits().Test(tid);
+  }
 
   /**
    * @return True if this list contains all TIDs in the range [0, capacity); false otherwise.
    */
-  bool IsFull() const { return bit_vector_.All(); }
+  bool IsFull() const {
+    switch (repr_) {
+      case Representation::Range:
+        return range_begin_ == 0 && range_end_ == GetCapacity();
+      case Representation::Selection:
+        return sel_size_ == GetCapacity();
+      default:
+        return bit_vector_.All();
+    }
+  }
 
   /**
    * @return True if this list is empty; false otherwise.
    */
-  bool IsEmpty() const { return bit_vector_.None(); }
+  bool IsEmpty() const {
+    switch (repr_) {
+      case Representation::Range:
+        return range_begin_ == range_end_;
+      case Representation::Selection:
+        return sel_size_ == 0;
+      default:
+        return bit_vector_.None();
+    }
+  }
 
   /**
    * Add the tuple ID @em tid to this list.
    * @pre The given TID must be in the range [0, capacity) of this list.
    * @param tid The ID of the tuple.
    */
-  void Add(const uint32_t tid) { bit_vector_.Set(tid); }
+  void Add(const uint32_t tid) {
+    ConvertToBitmap();
+    bit_vector_.Set(tid);
+  }
 
   /**
    * Add all TIDs in the range [start_tid, end_tid) to this list. Note the half-open interval!
    * @param start_tid The left inclusive range boundary.
    * @param end_tid The right exclusive range boundary.
    */
-  void AddRange(const uint32_t start_tid, const uint32_t end_tid) {
-    bit_vector_.SetRange(start_tid, end_tid);
-  }
+  void AddRange(uint32_t start_tid, uint32_t end_tid);
 
   /**
    * Add all tuple IDs this list can support.
    */
-  void AddAll() { bit_vector_.SetAll(); }
+  void AddAll() { SetRange(0, GetCapacity()); }
 
   /**
    * Conditionally add or remove the tuple with ID @em tid depending on the value of @em enable. If
@@ -234,37 +289,56 @@ class TupleIdList {
    * @param tid The ID of the tuple to conditionally add to the list.
    * @param enable The flag indicating if the tuple is added or removed.
    */
-  void Enable(const uint32_t tid, const bool enable) { bit_vector_.Set(tid, enable); }
+  void Enable(const uint32_t tid, const bool enable) {
+    ConvertToBitmap();
+    bit_vector_.Set(tid, enable);
+  }
 
   /**
    * Remove the tuple with the given ID from the list.
    * @param tid The ID of the tuple.
    */
-  void Remove(const uint32_t tid) { bit_vector_.Unset(tid); }
+  void Remove(const uint32_t tid) {
+    ConvertToBitmap();
+    bit_vector_.Unset(tid);
+  }
 
   /**
    * Assign all tuple IDs in @em other to this list.
    * @param other The list to copy all TIDs from.
    */
-  void AssignFrom(const TupleIdList &other) { bit_vector_.Copy(other.bit_vector_); }
+  void AssignFrom(const TupleIdList &other);
 
   /**
    * Intersect the set of tuple IDs in this list with the tuple IDs in the provided list.
    * @param other The list to intersect with.
    */
-  void IntersectWith(const TupleIdList &other) { bit_vector_.Intersect(other.bit_vector_); }
+  void IntersectWith(const TupleIdList &other);
+
+  /**
+   * Remove all tuple IDs from this list whose bits are not set in the provided bit vector.
+   * @param bits The bit vector to intersect with. Must have the same capacity as this list.
+   */
+  void IntersectWith(const BitVectorType &bits);
 
   /**
    * Union the set of tuple IDs in this list with the tuple IDs in the provided list.
    * @param other The list to union with.
    */
-  void UnionWith(const TupleIdList &other) { bit_vector_.Union(other.bit_vector_); }
+  void UnionWith(const TupleIdList &other);
 
   /**
    * Remove all tuple IDs from this list that are also present in the provided list.
    * @param other The list to unset from.
    */
-  void UnsetFrom(const TupleIdList &other) { bit_vector_.Difference(other.bit_vector_); }
+  void UnsetFrom(const TupleIdList &other);
+
+  /**
+   * Remove all tuple IDs from this list whose bits are set in the provided bit vector. This is
+   * typically used to strip out TIDs of NULL elements using a vector's NULL mask.
+   * @param bits The bit vector to unset from. Must have the same capacity as this list.
+   */
+  void UnsetFrom(const BitVectorType &bits);
 
   /**
    * Filter the TIDs in this list based on the given unary filtering function.
@@ -274,10 +348,40 @@ class TupleIdList {
    */
   template <typename P>
   void Filter(P p) {
-    if (IsFull()) {
-      bit_vector_.UpdateFull(p);
-    } else {
-      bit_vector_.UpdateSetBits(p);
+    switch (repr_) {
+      case Representation::Range: {
+        const uint32_t count = range_end_ - range_begin_;
+        if (count == 0) {
+          return;
+        }
+        if (ShouldUseSelectionVector(count)) {
+          ConvertToSelection();
+          FilterSelection(p);
+        } else if (count == GetCapacity()) {
+          ConvertToBitmap();
+          bit_vector_.UpdateFull(p);
+        } else {
+          ConvertToBitmap();
+          bit_vector_.UpdateSetBits(p);
+        }
+        break;
+      }
+      case Representation::Selection: {
+        FilterSelection(p);
+        break;
+      }
+      case Representation::Bitmap: {
+        const uint32_t count = bit_vector_.CountOnes();
+        if (ShouldUseSelectionVector(count)) {
+          ConvertToSelection();
+          FilterSelection(p);
+        } else if (count == GetCapacity()) {
+          bit_vector_.UpdateFull(p);
+        } else {
+          bit_vector_.UpdateSetBits(p);
+        }
+        break;
+      }
     }
   }
 
@@ -298,23 +402,44 @@ class TupleIdList {
    * @param size The number of elements in the match vector.
    */
   void BuildFromMatchVector(const uint8_t *const matches, const uint32_t size) {
+    // The match vector overwrites the whole bitmap, so there's nothing to convert.
+    repr_ = Representation::Bitmap;
+    bits_valid_ = true;
     bit_vector_.SetFromBytes(matches, size);
   }
 
   /**
    * Remove all tuples from the list.
    */
-  void Clear() { bit_vector_.Reset(); }
+  void Clear() { SetRange(0, 0); }
+
+  /**
+   * @return The internal bit vector representation of the list. The list switches to its bitmap
+   *         representation, if it isn't already using it.
+   */
+  BitVectorType *GetMutableBits() {
+    ConvertToBitmap();
+    return &bit_vector_;
+  }
 
   /**
-   * @return The internal bit vector representation of the list.
+   * @return The physical representation of the list.
    */
-  BitVectorType *GetMutableBits() { return &bit_vector_; }
+  Representation GetRepresentation() const { return repr_; }
 
   /**
    * @return The number of active tuples in the list.
    */
-  uint32_t GetTupleCount() const { return bit_vector_.CountOnes(); }
+  uint32_t GetTupleCount() const {
+    switch (repr_) {
+      case Representation::Range:
+        return range_end_ - range_begin_;
+      case Representation::Selection:
+        return sel_size_;
+      default:
+        return bit_vector_.CountOnes();
+    }
+  }
 
   /**
    * @return The capacity of the TID list.
@@ -324,7 +449,12 @@ class TupleIdList {
   /**
    * @return The selectivity of the list as a fraction in the range [0.0, 1.0].
    */
-  float ComputeSelectivity() const { return bit_vector_.ComputeDensity(); }
+  float ComputeSelectivity() const {
+    if (repr_ == Representation::Bitmap || GetCapacity() == 0) {
+      return bit_vector_.ComputeDensity();
+    }
+    return static_cast<float>(GetTupleCount()) / GetCapacity();
+  }
 
   /**
    * Convert this tuple ID list into a dense selection index vector.
@@ -340,12 +470,29 @@ class TupleIdList {
    */
   template <typename F>
   void ForEach(F f) const {
-    if (IsFull()) {
-      for (std::size_t i = 0, n = GetCapacity(); i < n; i++) {
-        f(i);
+    switch (repr_) {
+      case Representation::Range: {
+        for (std::size_t i = range_begin_; i < range_end_; i++) {
+          f(i);
+        }
+        break;
+      }
+      case Representation::Selection: {
+        for (uint32_t i = 0; i < sel_size_; i++) {
+          f(std::size_t{sel_[i]});
+        }
+        break;
+      }
+      case Representation::Bitmap: {
+        if (bit_vector_.All()) {
+          for (std::size_t i = 0, n = GetCapacity(); i < n; i++) {
+            f(i);
+          }
+        } else {
+          bit_vector_.ForEachSet(f);
+        }
+        break;
       }
-    } else {
-      bit_vector_.ForEachSet(f);
     }
   }
 
@@ -372,7 +519,14 @@ class TupleIdList {
    */
   std::size_t operator[](const std::size_t i) const {
     TPL_ASSERT(i < GetTupleCount(), "Out-of-bounds list access");
-    return bit_vector_.NthOne(i);
+    switch (repr_) {
+      case Representation::Range:
+        return range_begin_ + i;
+      case Representation::Selection:
+        return sel_[i];
+      default:
+        return bit_vector_.NthOne(i);
+    }
   }
 
   /**
@@ -401,26 +555,91 @@ class TupleIdList {
   /**
    * @return An iterator positioned at the first element in the TID list.
    */
-  ConstIterator begin() { return ConstIterator(bit_vector_); }
+  ConstIterator begin() { return ConstIterator(GetBits()); }
 
   /**
    * @return A const iterator position at the first element in the TID list.
    */
-  ConstIterator begin() const { return ConstIterator(bit_vector_); }
+  ConstIterator begin() const { return ConstIterator(GetBits()); }
 
   /**
    * @return An iterator positioned at the end of the list.
    */
-  ConstIterator end() { return ConstIterator(bit_vector_, BitVectorType::kInvalidPos); }
+  ConstIterator end() { return ConstIterator(GetBits(), BitVectorType::kInvalidPos); }
 
   /**
    * @return A const iterator position at the end of the list.
    */
-  ConstIterator end() const { return ConstIterator(bit_vector_, BitVectorType::kInvalidPos); }
+  ConstIterator end() const { return ConstIterator(GetBits(), BitVectorType::kInvalidPos); }
+
+ private:
+  // Should a list with the given number of TIDs be filtered through a selection vector?
+  bool ShouldUseSelectionVector(const uint32_t count) const {
+    return GetCapacity() <= kMaxSelectionVectorCapacity &&
+           count <= kMaxSelectionVectorDensity * GetCapacity();
+  }
+
+  // Make the list hold exactly the TIDs in the range [begin, end).
+  void SetRange(const uint32_t begin, const uint32_t end) {
+    repr_ = Representation::Range;
+    range_begin_ = begin;
+    range_end_ = end;
+    bits_valid_ = false;
+  }
+
+  // Switch to the bitmap representation.
+  void ConvertToBitmap() {
+    if (TPL_UNLIKELY(repr_ != Representation::Bitmap)) {
+      MaterializeBits();
+      repr_ = Representation::Bitmap;
+    }
+  }
+
+  // Switch to the selection vector representation.
+  void ConvertToSelection();
+
+  // Return the bitmap, materializing it from the current representation if needed.
+  const BitVectorType &GetBits() const {
+    if (TPL_UNLIKELY(!bits_valid_)) {
+      MaterializeBits();
+    }
+    return bit_vector_;
+  }
+
+  // Write the TIDs in this list into the bitmap.
+  void MaterializeBits() const;
+
+  // Retain all TIDs in the selection vector for which the predicate returns true.
+  template <typename P>
+  void FilterSelection(P p) {
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < sel_size_; i++) {
+      const sel_t tid = sel_[i];
+      sel_[k] = tid;
+      k += static_cast<uint32_t>(static_cast<bool>(p(std::size_t{tid})));
+    }
+    sel_size_ = k;
+    bits_valid_ = false;
+  }
 
  private:
-  // The validity bit vector
-  BitVectorType bit_vector_;
+  // The largest list capacity whose TIDs all fit in a selection vector.
+  static constexpr uint32_t kMaxSelectionVectorCapacity =
+      static_cast<uint32_t>(std::numeric_limits<sel_t>::max()) + 1;
+
+  // The active representation.
+  Representation repr_;
+  // The range [range_begin_, range_end_) when using the range representation.
+  uint32_t range_begin_;
+  uint32_t range_end_;
+  // The sorted TIDs when using the selection vector representation. The array is sized to the
+  // capacity of the list when first needed, and only the first sel_size_ elements are valid.
+  std::vector<sel_t> sel_;
+  uint32_t sel_size_;
+  // The bitmap. It's the source of truth in the bitmap representation, and is otherwise a lazily
+  // materialized copy of the contents of the list, valid only if bits_valid_ is true.
+  mutable BitVectorType bit_vector_;
+  mutable bool bits_valid_;
 };
 
 /**
@@ -41,6 +41,18 @@ class Type {
    */
   uint32_t GetMaxStringLength() const;
 
+  /**
+   * @return The total number of significant digits of a DECIMAL type. Zero for other types.
+   */
+  uint32_t GetPrecision() const {
+    return type_id_ == SqlTypeId::Decimal ? numeric_info_.precision : 0;
+  }
+
+  /**
+   * @return The number of fractional digits of a DECIMAL type. Zero for other types.
+   */
+  uint32_t GetScale() const { return type_id_ == SqlTypeId::Decimal ? numeric_info_.scale : 0; }
+
   /**
    * @return A string representation of this type.
    */
@@ -96,11 +108,30 @@ class Type {
 
   /**
    * @return A fixed-point DECIMAL SQL type with the requested NULL-ability, precision, and scale.
+   *         Decimals with a precision up to 18 digits are stored in 64-bit integers; others are
+   *         stored in 128-bit integers.
    */
   static Type DecimalType(bool nullable, uint32_t precision, uint32_t scale) {
+    TPL_ASSERT(precision > 0 && precision <= Decimal128::kMaxPrecision, "Invalid precision");
+    TPL_ASSERT(scale <= precision, "Scale cannot exceed precision");
     return Type(SqlTypeId::Decimal, nullable, NumericInfo{precision, scale});
   }
 
+  /**
+   * Compute the type of the result of applying the arithmetic operator @em op to two DECIMAL
+   * values of types @em left and @em right. With input precisions p1, p2 and scales s1, s2:
+   *  - Add/Sub: scale max(s1, s2); precision max(p1-s1, p2-s2) + max(s1, s2) + 1.
+   *  - Mul: scale s1 + s2; precision p1 + p2 + 1.
+   *  - Div: scale max(6, s1 + p2 + 1); precision p1 - s1 + s2 + scale.
+   * Precisions are capped at 38 digits. When capping, the scale of a division is reduced to keep
+   * the integral digits, but never below min(scale, 6).
+   * @param op The arithmetic operator. One of Add, Sub, Mul, or Div.
+   * @param left The type of the left input.
+   * @param right The type of the right input.
+   * @return The result type. The result is NULL-able if either input is.
+   */
+  static Type DecimalArithmeticResultType(KnownOperator op, const Type &left, const Type &right);
+
   /**
    * @return A new DATE SQL type with the requested NULL-ability.
    */
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <initializer_list>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -186,9 +187,29 @@ class Vector {
   const NullMask &GetNullMask() const noexcept { return null_mask_; }
 
   /**
-   * @return A mutable pointer to this vector's NULL indication bit mask.
+   * @return A mutable pointer to this vector's NULL indication bit mask. The vector is no longer
+   *         known to be free of NULLs, since the caller may set bits in the mask.
    */
-  NullMask *GetMutableNullMask() noexcept { return &null_mask_; }
+  NullMask *GetMutableNullMask() noexcept {
+    no_nulls_ = false;
+    return &null_mask_;
+  }
+
+  /**
+   * @return True if this vector is known to have no NULL elements; false otherwise. This is
+   *         conservative: a vector may have no NULLs and still return false. Kernels use it to
+   *         skip NULL mask processing entirely.
+   */
+  bool HasNoNulls() const noexcept { return no_nulls_; }
+
+  /**
+   * Set this vector's NULL mask to the union of the NULL masks of all vectors in @em inputs. Inputs
+   * known to have no NULLs are skipped, and if all are, the mask is simply cleared. This vector
+   * may itself be one of the inputs.
+   * @pre All inputs must have the same size as this vector.
+   * @param inputs The vectors whose NULLs to propagate into this vector.
+   */
+  void SetNullMaskFrom(std::initializer_list<const Vector *> inputs);
 
   /**
    * @return A mutable pointer to this vector's string heap.
@@ -255,6 +276,7 @@ class Vector {
    */
   void SetNull(const uint32_t index, const bool null) {
     null_mask_[tid_list_ != nullptr ? (*tid_list_)[index] : index] = null;
+    no_nulls_ = no_nulls_ && !null;
   }
 
   /**
@@ -390,6 +412,8 @@ class Vector {
   const TupleIdList *tid_list_;
   // The null mask used to indicate if an element in the vector is NULL.
   NullMask null_mask_;
+  // True if the null mask is known to be empty.
+  bool no_nulls_;
   // Heap container for strings owned by this vector.
   VarlenHeap varlen_heap_;
   // If the vector holds allocated data, this field manages it.
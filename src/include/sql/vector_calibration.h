@@ -0,0 +1,84 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+
+#include "common/settings.h"
+
+namespace tpl::sql {
+
+/**
+ * Calibrates the selectivity thresholds vector kernels use to choose between selective and full
+ * computation on the current machine. Each threshold is found by timing its kernel under both
+ * strategies over a range of input selectivities and locating the crossover point. Kernels are
+ * timed for several representative types; the median crossover across types is used.
+ *
+ * Calibration takes a fraction of a second, so results are cached in a file with one section per
+ * CPU model. The cache is loaded at startup by LoadCached(), and only rewritten by an explicit call
+ * to CalibrateAndStore(). The cache file defaults to $HOME/.tpl/vector_calibration.conf, and can
+ * be overridden with the environment variable TPL_CALIBRATION_FILE. A section looks like:
+ *
+ * @code
+ * [Intel(R) Xeon(R) Gold 6148 CPU @ 2.40GHz]
+ * FullSelectOptThreshold = 0.25
+ * FullHashOptThreshold = 0.35
+ * @endcode
+ */
+class VectorCalibration {
+ public:
+  /**
+   * The calibrated value of each threshold setting.
+   */
+  using Thresholds = std::map<Settings::Name, double>;
+
+  /**
+   * Micro-benchmark all vector kernels on this machine.
+   * @return The calibrated thresholds.
+   */
+  static Thresholds Calibrate();
+
+  /**
+   * Apply the given thresholds to the global settings.
+   * @param thresholds The thresholds to apply.
+   */
+  static void Apply(const Thresholds &thresholds);
+
+  /**
+   * Load the thresholds calibrated for the CPU model @em cpu_model from the cache file @em path.
+   * Unknown settings in the file are ignored.
+   * @param path The path to the cache file.
+   * @param cpu_model The CPU model name.
+   * @return The cached thresholds, if the file has an entry for the CPU model.
+   */
+  static std::optional<Thresholds> Load(const std::string &path, const std::string &cpu_model);
+
+  /**
+   * Store the thresholds calibrated for the CPU model @em cpu_model into the cache file @em path,
+   * replacing any existing entry for the model. Entries for other models are retained.
+   * @param path The path to the cache file.
+   * @param cpu_model The CPU model name.
+   * @param thresholds The thresholds to store.
+   */
+  static void Store(const std::string &path, const std::string &cpu_model,
+                    const Thresholds &thresholds);
+
+  /**
+   * @return The path to the cache file.
+   */
+  static std::string GetCachePath();
+
+  /**
+   * Load and apply the cached thresholds for this machine's CPU, if any.
+   * @return True if cached thresholds were found and applied; false otherwise.
+   */
+  static bool LoadCached();
+
+  /**
+   * Calibrate all thresholds on this machine, apply them, and store them in the cache.
+   * @return The calibrated thresholds.
+   */
+  static Thresholds CalibrateAndStore();
+};
+
+}  // namespace tpl::sql
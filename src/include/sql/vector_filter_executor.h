@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/common.h"
+#include "common/macros.h"
 
 namespace tpl::sql {
 
@@ -20,8 +21,8 @@ class VectorFilterExecutor : public AllStatic {
    * @param col_idx The index of the column to compare with.
    * @param val The value to compare with.
    */
-  static void SelectEqualVal(VectorProjection *vector_projection, uint32_t col_idx, const Val &val,
-                             TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectEqualVal(VectorProjection *vector_projection, uint32_t col_idx,
+                                           const Val &val, TupleIdList *tid_list);
 
   /**
    * Select tuples in the column stored at the given index (@em col_idx) in the vector projection
@@ -29,8 +30,9 @@ class VectorFilterExecutor : public AllStatic {
    * @param col_idx The index of the column to compare with.
    * @param val The value to compare with.
    */
-  static void SelectGreaterThanEqualVal(VectorProjection *vector_projection, uint32_t col_idx,
-                                        const Val &val, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectGreaterThanEqualVal(VectorProjection *vector_projection,
+                                                      uint32_t col_idx, const Val &val,
+                                                      TupleIdList *tid_list);
 
   /**
    * Select tuples in the column stored at the given index (@em col_idx) in the vector projection
@@ -38,8 +40,9 @@ class VectorFilterExecutor : public AllStatic {
    * @param col_idx The index of the column to compare with.
    * @param val The value to compare with.
    */
-  static void SelectGreaterThanVal(VectorProjection *vector_projection, uint32_t col_idx,
-                                   const Val &val, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectGreaterThanVal(VectorProjection *vector_projection,
+                                                 uint32_t col_idx, const Val &val,
+                                                 TupleIdList *tid_list);
 
   /**
    * Select tuples in the column stored at the given index (@em col_idx) in the vector projection
@@ -47,8 +50,9 @@ class VectorFilterExecutor : public AllStatic {
    * @param col_idx The index of the column to compare with.
    * @param val The value to compare with.
    */
-  static void SelectLessThanEqualVal(VectorProjection *vector_projection, uint32_t col_idx,
-                                     const Val &val, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectLessThanEqualVal(VectorProjection *vector_projection,
+                                                   uint32_t col_idx, const Val &val,
+                                                   TupleIdList *tid_list);
 
   /**
    * Select tuples in the column stored at the given index (@em col_idx) in the vector projection
@@ -56,8 +60,8 @@ class VectorFilterExecutor : public AllStatic {
    * @param col_idx The index of the column to compare with.
    * @param val The value to compare with.
    */
-  static void SelectLessThanVal(VectorProjection *vector_projection, uint32_t col_idx,
-                                const Val &val, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectLessThanVal(VectorProjection *vector_projection, uint32_t col_idx,
+                                              const Val &val, TupleIdList *tid_list);
 
   /**
    * Select tuples in the column stored at the given index (@em col_idx) in the vector projection
@@ -65,8 +69,8 @@ class VectorFilterExecutor : public AllStatic {
    * @param col_idx The index of the column to compare with.
    * @param val The value to compare with.
    */
-  static void SelectNotEqualVal(VectorProjection *vector_projection, uint32_t col_idx,
-                                const Val &val, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectNotEqualVal(VectorProjection *vector_projection, uint32_t col_idx,
+                                              const Val &val, TupleIdList *tid_list);
 
   /**
    * Select tuples whose values in the left (first) column are equal to the values in the right
@@ -74,8 +78,8 @@ class VectorFilterExecutor : public AllStatic {
    * @param left_col_idx The index of the left column to compare with.
    * @param right_col_idx The index of the right column to compare with.
    */
-  static void SelectEqual(VectorProjection *vector_projection, uint32_t left_col_idx,
-                          uint32_t right_col_idx, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectEqual(VectorProjection *vector_projection, uint32_t left_col_idx,
+                                        uint32_t right_col_idx, TupleIdList *tid_list);
 
   /**
    * Select tuples whose values in the left (first) column are greater than or equal to the values
@@ -83,8 +87,9 @@ class VectorFilterExecutor : public AllStatic {
    * @param left_col_idx The index of the left column to compare with.
    * @param right_col_idx The index of the right column to compare with.
    */
-  static void SelectGreaterThanEqual(VectorProjection *vector_projection, uint32_t left_col_idx,
-                                     uint32_t right_col_idx, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectGreaterThanEqual(VectorProjection *vector_projection,
+                                                   uint32_t left_col_idx, uint32_t right_col_idx,
+                                                   TupleIdList *tid_list);
 
   /**
    * Select tuples whose values in the left (first) column are greater than the values in the right
@@ -92,8 +97,9 @@ class VectorFilterExecutor : public AllStatic {
    * @param left_col_idx The index of the left column to compare with.
    * @param right_col_idx The index of the right column to compare with.
    */
-  static void SelectGreaterThan(VectorProjection *vector_projection, uint32_t left_col_idx,
-                                uint32_t right_col_idx, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectGreaterThan(VectorProjection *vector_projection,
+                                              uint32_t left_col_idx, uint32_t right_col_idx,
+                                              TupleIdList *tid_list);
 
   /**
    * Select tuples whose values in the left (first) column are less than or equal to the values in
@@ -101,8 +107,9 @@ class VectorFilterExecutor : public AllStatic {
    * @param left_col_idx The index of the left column to compare with.
    * @param right_col_idx The index of the right column to compare with.
    */
-  static void SelectLessThanEqual(VectorProjection *vector_projection, uint32_t left_col_idx,
-                                  uint32_t right_col_idx, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectLessThanEqual(VectorProjection *vector_projection,
+                                                uint32_t left_col_idx, uint32_t right_col_idx,
+                                                TupleIdList *tid_list);
 
   /**
    * Select tuples whose values in the left (first) column are less than the values in the right
@@ -110,8 +117,9 @@ class VectorFilterExecutor : public AllStatic {
    * @param left_col_idx The index of the left column to compare with.
    * @param right_col_idx The index of the right column to compare with.
    */
-  static void SelectLessThan(VectorProjection *vector_projection, uint32_t left_col_idx,
-                             uint32_t right_col_idx, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectLessThan(VectorProjection *vector_projection,
+                                           uint32_t left_col_idx, uint32_t right_col_idx,
+                                           TupleIdList *tid_list);
 
   /**
    * Select tuples whose values in the left (first) column are not equal to the values in the right
@@ -119,8 +127,8 @@ class VectorFilterExecutor : public AllStatic {
    * @param left_col_idx The index of the left column to compare with.
    * @param right_col_idx The index of the right column to compare with.
    */
-  static void SelectNotEqual(VectorProjection *vector_projection, uint32_t col_idx,
-                             uint32_t right_col_idx, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectNotEqual(VectorProjection *vector_projection, uint32_t col_idx,
+                                           uint32_t right_col_idx, TupleIdList *tid_list);
 };
 
 }  // namespace tpl::sql
@@ -184,9 +184,9 @@ class BinaryOperationExecutor : public AllStatic {
     if (left.IsNull(0)) {
       VectorOps::FillNull(result);
     } else {
-      result->GetMutableNullMask()->Copy(right.GetNullMask());
+      result->SetNullMaskFrom({&right});
 
-      if (IgnoreNull && result->GetNullMask().Any()) {
+      if (IgnoreNull && !result->HasNoNulls() && result->GetNullMask().Any()) {
         VectorOps::Exec(right, [&](uint64_t i, uint64_t k) {
           if (!result->GetNullMask()[i]) {
             result_data[i] = op(left_data[0], right_data[i]);
@@ -221,9 +221,9 @@ class BinaryOperationExecutor : public AllStatic {
     if (right.IsNull(0)) {
       VectorOps::FillNull(result);
     } else {
-      result->GetMutableNullMask()->Copy(left.GetNullMask());
+      result->SetNullMaskFrom({&left});
 
-      if (IgnoreNull && result->GetNullMask().Any()) {
+      if (IgnoreNull && !result->HasNoNulls() && result->GetNullMask().Any()) {
         VectorOps::Exec(left, [&](uint64_t i, uint64_t k) {
           if (!result->GetNullMask()[i]) {
             result_data[i] = op(left_data[i], right_data[0]);
@@ -257,10 +257,10 @@ class BinaryOperationExecutor : public AllStatic {
     auto *RESTRICT result_data = reinterpret_cast<ResultType *>(result->GetData());
 
     result->Resize(left.GetSize());
-    result->GetMutableNullMask()->Copy(left.GetNullMask()).Union(right.GetNullMask());
+    result->SetNullMaskFrom({&left, &right});
     result->SetFilteredTupleIdList(left.GetFilteredTupleIdList(), left.GetCount());
 
-    if (IgnoreNull && result->GetNullMask().Any()) {
+    if (IgnoreNull && !result->HasNoNulls() && result->GetNullMask().Any()) {
       VectorOps::Exec(left, [&](uint64_t i, uint64_t k) {
         if (!result->GetNullMask()[i]) {
           result_data[i] = op(left_data[i], right_data[i]);
@@ -296,12 +296,12 @@ class BinaryOperationExecutor : public AllStatic {
     if (traits::ShouldPerformFullCompute<Op>()(tid_list)) {
       TupleIdList::BitVectorType *bit_vector = tid_list->GetMutableBits();
       bit_vector->UpdateFull([&](uint64_t i) { return op(left_data[0], right_data[i]); });
-      bit_vector->Difference(right.GetNullMask());
+      if (!right.HasNoNulls()) bit_vector->Difference(right.GetNullMask());
       return;
     }
 
     // Remove all NULL entries from right input. Left constant is guaranteed non-NULL by this point.
-    tid_list->GetMutableBits()->Difference(right.GetNullMask());
+    if (!right.HasNoNulls()) tid_list->UnsetFrom(right.GetNullMask());
 
     // Filter
     tid_list->Filter([&](uint64_t i) { return op(left_data[0], right_data[i]); });
@@ -324,12 +324,12 @@ class BinaryOperationExecutor : public AllStatic {
     if (traits::ShouldPerformFullCompute<Op>()(tid_list)) {
       TupleIdList::BitVectorType *bit_vector = tid_list->GetMutableBits();
       bit_vector->UpdateFull([&](uint64_t i) { return op(left_data[i], right_data[0]); });
-      bit_vector->Difference(left.GetNullMask());
+      if (!left.HasNoNulls()) bit_vector->Difference(left.GetNullMask());
       return;
     }
 
     // Remove all NULL entries from left input. Right constant is guaranteed non-NULL by this point.
-    tid_list->GetMutableBits()->Difference(left.GetNullMask());
+    if (!left.HasNoNulls()) tid_list->UnsetFrom(left.GetNullMask());
 
     // Filter
     tid_list->Filter([&](uint64_t i) { return op(left_data[i], right_data[0]); });
@@ -346,12 +346,14 @@ class BinaryOperationExecutor : public AllStatic {
     if (traits::ShouldPerformFullCompute<Op>()(tid_list)) {
       TupleIdList::BitVectorType *bit_vector = tid_list->GetMutableBits();
       bit_vector->UpdateFull([&](uint64_t i) { return op(left_data[i], right_data[i]); });
-      bit_vector->Difference(left.GetNullMask()).Difference(right.GetNullMask());
+      if (!left.HasNoNulls()) bit_vector->Difference(left.GetNullMask());
+      if (!right.HasNoNulls()) bit_vector->Difference(right.GetNullMask());
       return;
     }
 
     // Remove all NULL entries in either vector
-    tid_list->GetMutableBits()->Difference(left.GetNullMask()).Difference(right.GetNullMask());
+    if (!left.HasNoNulls()) tid_list->UnsetFrom(left.GetNullMask());
+    if (!right.HasNoNulls()) tid_list->UnsetFrom(right.GetNullMask());
 
     // Filter
     tid_list->Filter([&](uint64_t i) { return op(left_data[i], right_data[i]); });
@@ -122,7 +122,7 @@ class InPlaceOperationExecutor : public AllStatic {
     auto *RESTRICT input_data = reinterpret_cast<InputType *>(input.GetData());
     auto *RESTRICT result_data = reinterpret_cast<ResultType *>(result->GetData());
 
-    result->GetMutableNullMask()->Union(input.GetNullMask());
+    result->SetNullMaskFrom({result, &input});
     if (traits::ShouldPerformFullCompute<Op>()(result->GetFilteredTupleIdList())) {
       VectorOps::ExecIgnoreFilter(
           *result, [&](uint64_t i, uint64_t k) { op(&result_data[i], input_data[i]); });
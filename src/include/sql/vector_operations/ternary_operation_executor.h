@@ -192,12 +192,16 @@ class TernaryOperationExecutor : public AllStatic {
     auto *RESTRICT result_data = reinterpret_cast<ResultType *>(result->GetData());
 
     result->Resize(a.GetSize());
-    if (!a.IsConstant()) result->GetMutableNullMask()->Copy(a.GetNullMask());
-    if (!b.IsConstant()) result->GetMutableNullMask()->Copy(b.GetNullMask());
-    if (!c.IsConstant()) result->GetMutableNullMask()->Copy(c.GetNullMask());
+    // A NULL in any non-constant input produces a NULL. NULL constants are handled by callers.
+    result->SetNullMaskFrom({});
+    for (const Vector *input : {&a, &b, &c}) {
+      if (!input->IsConstant() && !input->HasNoNulls()) {
+        result->GetMutableNullMask()->Union(input->GetNullMask());
+      }
+    }
     result->SetFilteredTupleIdList(a.GetFilteredTupleIdList(), a.GetCount());
 
-    if (IgnoreNull && result->GetNullMask().Any()) {
+    if (IgnoreNull && !result->HasNoNulls() && result->GetNullMask().Any()) {
       VectorOps::Exec(a, [&](uint64_t i, uint64_t k) {
         const auto a_idx = a_indexer(i);
         const auto b_idx = b_indexer(i);
@@ -244,16 +248,16 @@ class TernaryOperationExecutor : public AllStatic {
         return op(a_data[a_idx], b_data[b_idx], c_data[c_idx]);
       });
       // Strip nulls.
-      if (!a.IsConstant()) bit_vector->Difference(a.GetNullMask());
-      if (!b.IsConstant()) bit_vector->Difference(b.GetNullMask());
-      if (!c.IsConstant()) bit_vector->Difference(c.GetNullMask());
+      if (!a.IsConstant() && !a.HasNoNulls()) bit_vector->Difference(a.GetNullMask());
+      if (!b.IsConstant() && !b.HasNoNulls()) bit_vector->Difference(b.GetNullMask());
+      if (!c.IsConstant() && !c.HasNoNulls()) bit_vector->Difference(c.GetNullMask());
       return;
     }
 
     // Remove all NULL entries in any vector.
-    if (!a.IsConstant()) tid_list->GetMutableBits()->Difference(a.GetNullMask());
-    if (!b.IsConstant()) tid_list->GetMutableBits()->Difference(b.GetNullMask());
-    if (!c.IsConstant()) tid_list->GetMutableBits()->Difference(c.GetNullMask());
+    if (!a.IsConstant() && !a.HasNoNulls()) tid_list->UnsetFrom(a.GetNullMask());
+    if (!b.IsConstant() && !b.HasNoNulls()) tid_list->UnsetFrom(b.GetNullMask());
+    if (!c.IsConstant() && !c.HasNoNulls()) tid_list->UnsetFrom(c.GetNullMask());
 
     // Filter!
     tid_list->Filter([&](uint64_t i) {
@@ -79,7 +79,7 @@ class UnaryOperationExecutor : public AllStatic {
     auto *RESTRICT result_data = reinterpret_cast<ResultType *>(result->GetData());
 
     result->Resize(input.GetSize());
-    result->GetMutableNullMask()->Copy(input.GetNullMask());
+    result->SetNullMaskFrom({&input});
     result->SetFilteredTupleIdList(input.GetFilteredTupleIdList(), input.GetCount());
 
     if (input.IsConstant()) {
@@ -87,7 +87,7 @@ class UnaryOperationExecutor : public AllStatic {
         result_data[0] = op(input_data[0]);
       }
     } else {
-      if (IgnoreNull && input.GetNullMask().Any()) {
+      if (IgnoreNull && !input.HasNoNulls() && input.GetNullMask().Any()) {
         const auto &null_mask = input.GetNullMask();
         VectorOps::Exec(input, [&](uint64_t i, uint64_t k) {
           if (!null_mask[i]) {
@@ -2,14 +2,17 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "common/common.h"
+#include "common/macros.h"
 #include "sql/generic_value.h"
 #include "sql/vector.h"
 
 namespace tpl::sql {
 
 class TupleIdList;
+class Type;
 
 /**
  * A utility class containing several core vectorized operations.
@@ -128,6 +131,72 @@ class VectorOps : public AllStatic {
    */
   static void Modulo(const Vector &left, const Vector &right, Vector *result);
 
+  /**
+   * Add DECIMAL vector elements in @em left with @em right and store the result into @em result.
+   * Inputs are rescaled to the scale of the result, whose type is determined by
+   * Type::DecimalArithmeticResultType(). Vectors must use the storage type of their DECIMAL type.
+   *
+   * result = left + right
+   *
+   * @throw Exception of type ExceptionType::Decimal if any result exceeds the result's precision.
+   * @param left The left input into the addition.
+   * @param left_type The DECIMAL type of the left input.
+   * @param right The right input into the addition.
+   * @param right_type The DECIMAL type of the right input.
+   * @param[out] result The result of the addition.
+   */
+  static void DecimalAdd(const Vector &left, const Type &left_type, const Vector &right,
+                         const Type &right_type, Vector *result);
+
+  /**
+   * Subtract DECIMAL vector elements in @em right from @em left and store the result into
+   * @em result. Inputs are rescaled to the scale of the result.
+   *
+   * result = left - right
+   *
+   * @throw Exception of type ExceptionType::Decimal if any result exceeds the result's precision.
+   * @param left The left input into the subtraction.
+   * @param left_type The DECIMAL type of the left input.
+   * @param right The right input into the subtraction.
+   * @param right_type The DECIMAL type of the right input.
+   * @param[out] result The result of the subtraction.
+   */
+  static void DecimalSubtract(const Vector &left, const Type &left_type, const Vector &right,
+                              const Type &right_type, Vector *result);
+
+  /**
+   * Multiply DECIMAL vector elements in @em left with @em right and store the result into
+   * @em result. The scale of the result is the sum of the input scales.
+   *
+   * result = left * right
+   *
+   * @throw Exception of type ExceptionType::Decimal if any result exceeds the result's precision.
+   * @param left The left input into the multiplication.
+   * @param left_type The DECIMAL type of the left input.
+   * @param right The right input into the multiplication.
+   * @param right_type The DECIMAL type of the right input.
+   * @param[out] result The result of the multiplication.
+   */
+  static void DecimalMultiply(const Vector &left, const Type &left_type, const Vector &right,
+                              const Type &right_type, Vector *result);
+
+  /**
+   * Divide DECIMAL vector elements in @em left by @em right and store the result into @em result.
+   * Quotients are rounded half away from zero to the scale of the result. Division by zero
+   * produces NULL.
+   *
+   * result = left / right
+   *
+   * @throw Exception of type ExceptionType::Decimal if any result exceeds the result's precision.
+   * @param left The left input into the division.
+   * @param left_type The DECIMAL type of the left input.
+   * @param right The right input into the division.
+   * @param right_type The DECIMAL type of the right input.
+   * @param[out] result The result of the division.
+   */
+  static void DecimalDivide(const Vector &left, const Type &left_type, const Vector &right,
+                            const Type &right_type, Vector *result);
+
   /**
    * Add vector elements in @em left with @em right and store the result back into @em left:
    *
@@ -148,6 +217,52 @@ class VectorOps : public AllStatic {
    */
   static void BitwiseAndInPlace(Vector *left, const Vector &right);
 
+  // -------------------------------------------------------
+  //
+  // Date/time
+  //
+  // -------------------------------------------------------
+
+  /**
+   * Extract the field @em part from all dates or timestamps in @em input, and store the result in
+   * the integer vector @em result. Dates in common ranges are split using small precomputed
+   * calendar tables rather than full calendar math.
+   * @param input The input date or timestamp vector.
+   * @param part The field to extract.
+   * @param[out] result The integer result vector.
+   */
+  static void DateExtract(const Vector &input, DatePart part, Vector *result);
+
+  /**
+   * Truncate all dates or timestamps in @em input to the start of their year, quarter, month, or
+   * day, and store the result in @em result, which has the same type as the input.
+   * @throw NotImplementedException if @em part is a day of the week or year.
+   * @param input The input date or timestamp vector.
+   * @param part The field to truncate to.
+   * @param[out] result The result vector.
+   */
+  static void DateTrunc(const Vector &input, DatePart part, Vector *result);
+
+  /**
+   * Add the integer number of days in @em days to the dates in @em dates:
+   *
+   * result[i] = dates[i] + days[i] days
+   *
+   * @param dates The input dates.
+   * @param days The integer number of days to add.
+   * @param[out] result The date result vector.
+   */
+  static void DateAddDays(const Vector &dates, const Vector &days, Vector *result);
+
+  /**
+   * Add the integer number of months in @em months to the dates in @em dates. Days past the end of
+   * the resulting month are clamped to its last day, e.g., 2020-01-31 + 1 month = 2020-02-29.
+   * @param dates The input dates.
+   * @param months The integer number of months to add.
+   * @param[out] result The date result vector.
+   */
+  static void DateAddMonths(const Vector &dates, const Vector &months, Vector *result);
+
   // -------------------------------------------------------
   //
   // Selections
@@ -161,7 +276,8 @@ class VectorOps : public AllStatic {
    * @param right The right input into the selection
    * @param[in,out] tid_list The list of TIDs to read and update.
    */
-  static void SelectEqual(const Vector &left, const Vector &right, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectEqual(const Vector &left, const Vector &right,
+                                        TupleIdList *tid_list);
 
   /**
    * Filter the TID list @em tid_list with all elements in @em left that are strictly greater than
@@ -170,7 +286,8 @@ class VectorOps : public AllStatic {
    * @param right The right input into the selection
    * @param[in,out] tid_list The list of TIDs to read and update.
    */
-  static void SelectGreaterThan(const Vector &left, const Vector &right, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectGreaterThan(const Vector &left, const Vector &right,
+                                              TupleIdList *tid_list);
 
   /**
    * Filter the TID list @em tid_list with all elements in @em left that are greater than or equal
@@ -179,8 +296,8 @@ class VectorOps : public AllStatic {
    * @param right The right input into the selection
    * @param[in,out] tid_list The list of TIDs to read and update.
    */
-  static void SelectGreaterThanEqual(const Vector &left, const Vector &right,
-                                     TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectGreaterThanEqual(const Vector &left, const Vector &right,
+                                                   TupleIdList *tid_list);
 
   /**
    * Filter the TID list @em tid_list with all elements in @em left that are strictly less than
@@ -189,7 +306,8 @@ class VectorOps : public AllStatic {
    * @param right The right input into the selection
    * @param[in,out] tid_list The list of TIDs to read and update.
    */
-  static void SelectLessThan(const Vector &left, const Vector &right, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectLessThan(const Vector &left, const Vector &right,
+                                           TupleIdList *tid_list);
 
   /**
    * Filter the TID list @em tid_list with all elements in @em left that are less than or equal to
@@ -198,7 +316,8 @@ class VectorOps : public AllStatic {
    * @param right The right input into the selection
    * @param[in,out] tid_list The list of TIDs to read and update.
    */
-  static void SelectLessThanEqual(const Vector &left, const Vector &right, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectLessThanEqual(const Vector &left, const Vector &right,
+                                                TupleIdList *tid_list);
 
   /**
    * Filter the TID list @em tid_list with all elements in @em left that are not equal to elements
@@ -207,7 +326,8 @@ class VectorOps : public AllStatic {
    * @param right The right input into the selection
    * @param[in,out] tid_list The list of TIDs to read and update.
    */
-  static void SelectNotEqual(const Vector &left, const Vector &right, TupleIdList *tid_list);
+  JIT_INLINABLE static void SelectNotEqual(const Vector &left, const Vector &right,
+                                           TupleIdList *tid_list);
 
   /**
    * Filter the list @em tid_list with the TIDs of all elements in @em input that are "between" the
@@ -279,6 +399,67 @@ class VectorOps : public AllStatic {
    */
   static void NotLike(const Vector &a, const Vector &b, TupleIdList *tid_list);
 
+  /**
+   * Convert all ASCII characters in the strings in @em input to upper case and store the results
+   * in @em result. All bytes not belonging to ASCII letters are copied unchanged.
+   * @param input The vector of strings to convert.
+   * @param[out] result The vector where the converted strings are written into.
+   */
+  static void Upper(const Vector &input, Vector *result);
+
+  /**
+   * Convert all ASCII characters in the strings in @em input to lower case and store the results
+   * in @em result. All bytes not belonging to ASCII letters are copied unchanged.
+   * @param input The vector of strings to convert.
+   * @param[out] result The vector where the converted strings are written into.
+   */
+  static void Lower(const Vector &input, Vector *result);
+
+  /**
+   * Store the substrings of all strings in @em input that begin at the 1-based position @em pos
+   * and have at most @em len characters into @em result. Ranges are clamped to the bounds of each
+   * string. A negative length produces NULLs.
+   * @param input The vector of strings to take substrings of.
+   * @param pos The 1-based position of the start of each substring.
+   * @param len The maximum length of each substring.
+   * @param[out] result The vector where the substrings are written into.
+   */
+  static void Substring(const Vector &input, int64_t pos, int64_t len, Vector *result);
+
+  /**
+   * Remove the longest prefix and suffix of each string in @em input that consist only of
+   * characters in @em chars, and store the results in @em result.
+   * @param input The vector of strings to trim.
+   * @param chars The constant string of characters to trim.
+   * @param[out] result The vector where the trimmed strings are written into.
+   */
+  static void Trim(const Vector &input, const Vector &chars, Vector *result);
+
+  /**
+   * Like Trim(), but only removes prefixes.
+   * @param input The vector of strings to trim.
+   * @param chars The constant string of characters to trim.
+   * @param[out] result The vector where the trimmed strings are written into.
+   */
+  static void Ltrim(const Vector &input, const Vector &chars, Vector *result);
+
+  /**
+   * Like Trim(), but only removes suffixes.
+   * @param input The vector of strings to trim.
+   * @param chars The constant string of characters to trim.
+   * @param[out] result The vector where the trimmed strings are written into.
+   */
+  static void Rtrim(const Vector &input, const Vector &chars, Vector *result);
+
+  /**
+   * Concatenate the strings in @em left with their counterparts in @em right and store the results
+   * in @em result. NULL inputs are treated as empty strings.
+   * @param left The vector of strings to concatenate.
+   * @param right The vector of strings to append.
+   * @param[out] result The vector where the concatenated strings are written into.
+   */
+  static void Concat(const Vector &left, const Vector &right, Vector *result);
+
   // -------------------------------------------------------
   //
   // Hashing
@@ -300,6 +481,15 @@ class VectorOps : public AllStatic {
    */
   static void HashCombine(const Vector &input, Vector *result);
 
+  /**
+   * Hash the elements of all vectors in @em inputs and store the combined hashes in @em result.
+   * This produces the same hashes as calling Hash() with the first input followed by HashCombine()
+   * with each remaining input, but decodes the active TIDs, which all inputs must share, only once.
+   * @param inputs The vectors to hash, in order.
+   * @param[out] result The vector where hash results are stored.
+   */
+  static void Hash(const std::vector<const Vector *> &inputs, Vector *result);
+
   // -------------------------------------------------------
   //
   // Gather / Scatter
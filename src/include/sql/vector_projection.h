@@ -138,7 +138,7 @@ class VectorProjection {
   /**
    * @return The list of active TIDs in the projection; NULL if no tuples have been filtered out.
    */
-  const TupleIdList *GetFilteredTupleIdList() { return filter_; }
+  const TupleIdList *GetFilteredTupleIdList() const { return filter_; }
 
   /**
    * Filter elements from the projection based on the tuple IDs in the input list @em tid_list.
@@ -157,25 +157,53 @@ class VectorProjection {
    */
   TypeId GetColumnType(const uint32_t col_idx) const {
     TPL_ASSERT(col_idx < GetColumnCount(), "Out-of-bounds column access");
-    return GetColumn(col_idx)->GetTypeId();
+    return columns_[col_idx]->GetTypeId();
   }
 
   /**
-   * @return The column vector at index @em col_idx as it appears in the projection.
+   * @return The column vector at index @em col_idx as it appears in the projection. If the column
+   *         was deferred, it is loaded now.
    */
   const Vector *GetColumn(const uint32_t col_idx) const {
     TPL_ASSERT(col_idx < GetColumnCount(), "Out-of-bounds column access");
+    if (deferred_columns_[col_idx] != nullptr) {
+      LoadDeferredColumn(col_idx);
+    }
     return columns_[col_idx].get();
   }
 
   /**
-   * @return The column vector at index @em col_idx as it appears in the projection.
+   * @return The column vector at index @em col_idx as it appears in the projection. If the column
+   *         was deferred, it is loaded now.
    */
   Vector *GetColumn(const uint32_t col_idx) {
     TPL_ASSERT(col_idx < GetColumnCount(), "Out-of-bounds column access");
+    if (deferred_columns_[col_idx] != nullptr) {
+      LoadDeferredColumn(col_idx);
+    }
     return columns_[col_idx].get();
   }
 
+  /**
+   * Defer loading the column at index @em col_idx from the current vector of the column iterator
+   * @em source until the column is first accessed through GetColumn(). Scans use this to run their
+   * filters before touching the remaining columns: columns no filter reads are only loaded for
+   * blocks with surviving tuples, and then only the NULL bits of surviving tuples are copied. The
+   * iterator must not be advanced while the column is deferred. Resetting the projection drops all
+   * deferred columns.
+   * @param col_idx The index of the column to defer.
+   * @param source The column iterator positioned at the vector to load.
+   */
+  void DeferColumn(uint32_t col_idx, const ColumnVectorIterator *source);
+
+  /**
+   * @return True if the column at index @em col_idx is deferred and hasn't been loaded yet.
+   */
+  bool IsColumnDeferred(const uint32_t col_idx) const {
+    TPL_ASSERT(col_idx < GetColumnCount(), "Out-of-bounds column access");
+    return deferred_columns_[col_idx] != nullptr;
+  }
+
   /**
    * Reset the count of each child vector to @em num_tuples and reset the data pointer of each child
    * vector to point to their data chunk in this projection, if it owns any.
@@ -263,10 +291,20 @@ class VectorProjection {
   // Propagate the active TID list to child vectors, if necessary.
   void RefreshFilteredTupleIdList();
 
+  // Load the deferred column at index @em col_idx from its column iterator.
+  void LoadDeferredColumn(uint32_t col_idx) const;
+
+  // Load all deferred columns.
+  void LoadDeferredColumns() const;
+
  private:
   // Vector containing column data for all columns in this projection.
   std::vector<std::unique_ptr<Vector>> columns_;
 
+  // For each column, the column iterator to load it from when it's first
+  // accessed, or NULL if the column has been loaded.
+  mutable std::vector<const ColumnVectorIterator *> deferred_columns_;
+
   // The list of active TIDs in the projection. Non-null only when tuples have
   // been filtered out.
   const TupleIdList *filter_;
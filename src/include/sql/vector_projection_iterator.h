@@ -326,6 +326,7 @@ inline void VectorProjectionIterator::SetValue(uint32_t col_idx, const T val, bo
 
   if constexpr (Nullable) {
     col_vector->null_mask_[curr_idx] = null;
+    col_vector->no_nulls_ = col_vector->no_nulls_ && !null;
     if (!null) {
       reinterpret_cast<T *>(col_vector->data_)[curr_idx] = val;
     }
@@ -1,12 +1,12 @@
 #pragma once
 
-#include <charconv>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "common/common.h"
+#include "util/fast_integer_parser.h"
 #include "util/file.h"
 
 namespace tpl::util {
@@ -221,8 +221,8 @@ class CSVReader {
     int64_t AsInteger() const {
       TPL_ASSERT(!escaped, "Integer data cannot contain be escaped");
       int64_t n = 0;
-      UNUSED auto [ptr, ec] = std::from_chars(s.begin(), s.end(), n);
-      TPL_ASSERT(ec == std::errc(), "Invalid integer.");
+      UNUSED const bool valid = FastIntegerParser::Parse(s.data(), s.data() + s.size(), &n);
+      TPL_ASSERT(valid, "Invalid integer.");
       return n;
     }
 
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "common/common.h"
+#include "common/macros.h"
+#include "util/arithmetic_overflow.h"
+
+namespace tpl::util {
+
+/**
+ * A base-10 integer parser that consumes eight digits at a time using SWAR (SIMD within a register)
+ * tricks. Inputs are accepted exactly as std::from_chars() does: an optional leading '-' for signed
+ * types, followed by one or more digits. Parsing stops at the first non-digit character.
+ */
+class FastIntegerParser : public AllStatic {
+ public:
+  /**
+   * Parse the integer at the start of the character range [first, last) into @em output.
+   * @tparam T The integer type to parse into.
+   * @param first A pointer to the first character in the range.
+   * @param last A pointer to one past the last character in the range.
+   * @param[out] output Where the parsed value is written to.
+   * @return True if the range starts with an integer that fits in the output type; false
+   *         otherwise. On failure, the output is left unmodified.
+   */
+  template <typename T>
+  static bool Parse(const char *first, const char *last, T *output) noexcept {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "Must be an integer type");
+
+    const char *p = first;
+    bool negative = false;
+    if constexpr (std::is_signed_v<T>) {
+      if (p != last && *p == '-') {
+        negative = true;
+        p++;
+      }
+    }
+
+    // Accumulate the magnitude, eight digits at a time, then one at a time.
+    const char *const digits = p;
+    uint64_t value = 0;
+    bool overflow = false;
+    for (uint64_t chunk; last - p >= 8; p += 8) {
+      std::memcpy(&chunk, p, sizeof(chunk));
+      if (!IsMadeOfEightDigits(chunk)) break;
+      overflow |= ArithmeticOverflow::Mul(value, uint64_t{100000000}, &value);
+      overflow |= ArithmeticOverflow::Add(value, ParseEightDigits(chunk), &value);
+    }
+    for (; p != last && static_cast<uint8_t>(*p - '0') < 10; p++) {
+      overflow |= ArithmeticOverflow::Mul(value, uint64_t{10}, &value);
+      overflow |= ArithmeticOverflow::Add(value, static_cast<uint64_t>(*p - '0'), &value);
+    }
+
+    if (p == digits || overflow) {
+      return false;
+    }
+
+    // Check range.
+    using UnsignedT = std::make_unsigned_t<T>;
+    const auto max_magnitude =
+        static_cast<uint64_t>(std::numeric_limits<T>::max()) + static_cast<uint64_t>(negative);
+    if (value > max_magnitude) {
+      return false;
+    }
+
+    *output = negative ? static_cast<T>(UnsignedT(0) - static_cast<UnsignedT>(value))
+                       : static_cast<T>(value);
+    return true;
+  }
+
+ private:
+  // Are all eight characters packed into the (little-endian) word digits? A byte is a digit iff
+  // neither adding 0x46 nor subtracting 0x30 sets its high bit.
+  static bool IsMadeOfEightDigits(const uint64_t chunk) noexcept {
+    return (((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) &
+            0x8080808080808080) == 0;
+  }
+
+  // Convert eight ASCII digits packed into a (little-endian) word into their value by combining
+  // adjacent digits into pairs, and then pairs into groups of four using two multiplications.
+  static uint64_t ParseEightDigits(uint64_t chunk) noexcept {
+    constexpr uint64_t kMask = 0x000000FF000000FF;
+    constexpr uint64_t kMul1 = 100 + (1000000ULL << 32);
+    constexpr uint64_t kMul2 = 1 + (10000ULL << 32);
+    chunk -= 0x3030303030303030;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & kMask) * kMul1) + (((chunk >> 16) & kMask) * kMul2)) >> 32;
+    return static_cast<uint32_t>(chunk);
+  }
+};
+
+}  // namespace tpl::util
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "common/macros.h"
+
+namespace tpl::util {
+
+/**
+ * A group of hardware performance counters measuring the calling thread. Counters are read through
+ * Linux's perf_event_open() interface. Only user-space events are counted so that measurements are
+ * permitted under the default perf_event_paranoid setting.
+ *
+ * Counters are unavailable on other platforms, in some virtualized or containerized environments,
+ * or when the kernel denies access. In these cases, IsAvailable() returns false and all counts read
+ * as zero. Individual events the hardware does not support also read as zero.
+ *
+ * @code
+ * PerfCounters counters;
+ * counters.Start();
+ * // your busy work ...
+ * counters.Stop();
+ * auto sample = counters.Read();
+ * auto ipc = sample.GetIPC();
+ * @endcode
+ *
+ * Counters are inherited by threads the calling thread creates after construction, but not by
+ * threads that already exist (e.g., those in TBB's pool). Parallel work is thus only partially
+ * measured.
+ */
+class PerfCounters {
+ public:
+  /**
+   * The hardware events measured.
+   */
+  enum class Event : uint8_t {
+    Cycles,
+    Instructions,
+    LLCMisses,
+    BranchMisses,
+    DTLBMisses,
+    // Put new entries above this comment.
+    Last = DTLBMisses,
+  };
+
+  /**
+   * The number of events measured.
+   */
+  static constexpr uint32_t kNumEvents = static_cast<uint32_t>(Event::Last) + 1;
+
+  /**
+   * The counts of all events over some measured interval.
+   */
+  class Sample {
+   public:
+    /**
+     * @return The count of the given event.
+     */
+    uint64_t Get(Event event) const { return counts_[static_cast<uint32_t>(event)]; }
+
+    /**
+     * Set the count of the given event.
+     */
+    void Set(Event event, uint64_t count) { counts_[static_cast<uint32_t>(event)] = count; }
+
+    /**
+     * @return Instructions retired per cycle. Zero if no cycles were counted.
+     */
+    double GetIPC() const {
+      const auto cycles = Get(Event::Cycles);
+      return cycles == 0 ? 0.0 : static_cast<double>(Get(Event::Instructions)) / cycles;
+    }
+
+    /**
+     * @return The count of the given event divided by @em n. Zero if @em n is zero.
+     */
+    double GetPer(Event event, uint64_t n) const {
+      return n == 0 ? 0.0 : static_cast<double>(Get(event)) / n;
+    }
+
+    /**
+     * Accumulate the counts in @em that sample into this one.
+     */
+    Sample &operator+=(const Sample &that) {
+      for (uint32_t i = 0; i < kNumEvents; i++) {
+        counts_[i] += that.counts_[i];
+      }
+      return *this;
+    }
+
+   private:
+    std::array<uint64_t, kNumEvents> counts_{};
+  };
+
+  /**
+   * Open all counters for the calling thread. Counting is stopped until Start() is called.
+   */
+  PerfCounters();
+
+  /**
+   * Close all counters.
+   */
+  ~PerfCounters();
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(PerfCounters);
+
+  /**
+   * @return True if hardware counters could be opened; false otherwise.
+   */
+  bool IsAvailable() const { return fds_[0] != kInvalidDescriptor; }
+
+  /**
+   * Reset all counts to zero and begin counting.
+   */
+  void Start();
+
+  /**
+   * Stop counting. Counts are retained until the next call to Start().
+   */
+  void Stop();
+
+  /**
+   * @return The counts accumulated between the last calls to Start() and Stop(). If the kernel
+   *         multiplexed counters, counts are scaled to estimate the full interval.
+   */
+  Sample Read() const;
+
+  /**
+   * @return A short name for the given event, usable as a counter or column name.
+   */
+  static const char *GetEventName(Event event);
+
+ private:
+  static constexpr int32_t kInvalidDescriptor = -1;
+
+ private:
+  // One descriptor per event. The first is the group leader.
+  std::array<int32_t, kNumEvents> fds_;
+};
+
+}  // namespace tpl::util
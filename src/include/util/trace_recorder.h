@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/macros.h"
+
+namespace tpl::util {
+
+/**
+ * A low-overhead recorder of timed events (e.g., parallel tasks) that can be dumped as a JSON trace
+ * viewable in chrome://tracing or Perfetto. Recording is disabled by default. When disabled, the
+ * cost of a TraceScope is a single relaxed atomic load.
+ *
+ * Each thread records into its own fixed-size ring buffer, so recording requires no locking. Once
+ * a buffer is full, the oldest events are overwritten. Once cleared, buffers of exited threads are
+ * recycled by threads created later. A recycled buffer gets a new ID, so each thread in the trace
+ * is a single OS thread.
+ *
+ * Event names, categories and argument names must be string literals (or otherwise outlive the
+ * recorder). Buffers are read without synchronizing with the threads writing them. Thus, traces
+ * may only be written or cleared once recording is disabled and all traced work has finished.
+ *
+ * @code
+ * TraceRecorder::Instance()->Enable();
+ * {
+ *   TraceScope scope("scan", "ScanBlocks", "first_block", 10);
+ *   // your busy work ...
+ * }
+ * TraceRecorder::Instance()->Disable();
+ * TraceRecorder::Instance()->WriteJson(std::cout);
+ * @endcode
+ */
+class TraceRecorder {
+ public:
+  /**
+   * The maximum number of events retained per thread.
+   */
+  static constexpr uint32_t kBufferCapacity = 16384;
+
+  /**
+   * A single complete event.
+   */
+  struct Event {
+    // The event's category and name.
+    const char *category;
+    const char *name;
+    // Start and end time, in nanoseconds relative to the recorder's creation.
+    uint64_t start_ns;
+    uint64_t end_ns;
+    // An optional argument. NULL name if none.
+    const char *arg_name;
+    int64_t arg;
+  };
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(TraceRecorder);
+
+  /**
+   * @return The process-wide recorder.
+   */
+  static TraceRecorder *Instance();
+
+  /**
+   * Begin recording events.
+   */
+  void Enable() { enabled_.store(true, std::memory_order_relaxed); }
+
+  /**
+   * Stop recording events. Events recorded so far are retained.
+   */
+  void Disable() { enabled_.store(false, std::memory_order_relaxed); }
+
+  /**
+   * @return True if events are being recorded; false otherwise.
+   */
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * @return The current time in nanoseconds relative to the recorder's creation.
+   */
+  uint64_t Now() const {
+    const auto elapsed = std::chrono::steady_clock::now() - epoch_;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  }
+
+  /**
+   * Record a complete event into the calling thread's buffer.
+   * @param event The event.
+   */
+  void Record(const Event &event);
+
+  /**
+   * @return The number of events currently retained across all threads.
+   */
+  uint64_t GetEventCount() const;
+
+  /**
+   * Discard all recorded events. Recording must be disabled, and no thread may be recording.
+   */
+  void Clear();
+
+  /**
+   * Write all retained events in the Trace Event JSON format. Recording must be disabled, and no
+   * thread may be recording.
+   * @param os The stream to write to.
+   */
+  void WriteJson(std::ostream &os) const;
+
+ private:
+  // A single thread's events.
+  struct ThreadBuffer {
+    explicit ThreadBuffer(uint32_t id) : id(id), events(new Event[kBufferCapacity]) {}
+    // The ID of the buffer's current thread, used as the thread ID in traces.
+    uint32_t id;
+    // The ring of events.
+    std::unique_ptr<Event[]> events;
+    // The number of events ever written. Only the owning thread writes.
+    std::atomic<uint64_t> num_written{0};
+    // Is a live thread using this buffer?
+    bool in_use{true};
+  };
+
+  // Releases a thread's buffer when the thread exits.
+  friend class ThreadBufferHandle;
+
+  TraceRecorder();
+
+  // Get the calling thread's buffer, acquiring one if needed.
+  ThreadBuffer *GetThreadBuffer();
+
+  // Acquire or release a buffer.
+  ThreadBuffer *AcquireBuffer();
+  void ReleaseBuffer(ThreadBuffer *buffer);
+
+ private:
+  // The time all events are relative to.
+  const std::chrono::steady_clock::time_point epoch_;
+  // Is recording enabled?
+  std::atomic<bool> enabled_{false};
+  // Latch protecting the buffer list.
+  mutable std::mutex mutex_;
+  // All buffers ever created.
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+  // The number of thread IDs handed out to buffers.
+  uint32_t num_thread_ids_{0};
+};
+
+/**
+ * Records the lifetime of the scope as a complete event, if tracing is enabled on entry.
+ */
+class TraceScope {
+ public:
+  /**
+   * Begin an event with the given category and name.
+   */
+  TraceScope(const char *category, const char *name) : TraceScope(category, name, nullptr, 0) {}
+
+  /**
+   * Begin an event with the given category, name and a single named argument.
+   */
+  TraceScope(const char *category, const char *name, const char *arg_name, int64_t arg)
+      : recorder_(TraceRecorder::Instance()),
+        event_{category, name, 0, 0, arg_name, arg},
+        active_(recorder_->IsEnabled()) {
+    if (active_) event_.start_ns = recorder_->Now();
+  }
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(TraceScope);
+
+  /**
+   * Finish and record the event.
+   */
+  ~TraceScope() {
+    if (active_) {
+      event_.end_ns = recorder_->Now();
+      recorder_->Record(event_);
+    }
+  }
+
+ private:
+  TraceRecorder *recorder_;
+  TraceRecorder::Event event_;
+  bool active_;
+};
+
+}  // namespace tpl::util
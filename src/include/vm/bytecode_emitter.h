@@ -146,6 +146,10 @@ class BytecodeEmitter {
   void EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVar region, FunctionId cmp_fn,
                       LocalVar tuple_size);
 
+  // Emit code to initialize a sorter instance expecting a given number of tuples.
+  void EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVar region, FunctionId cmp_fn,
+                      LocalVar tuple_size, LocalVar expected_tuple_count);
+
   // Emit code to initialize a CSV reader.
   void EmitCSVReaderInit(LocalVar creader, LocalVar static_local_string, uint32_t string_len);
 
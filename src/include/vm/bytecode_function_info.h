@@ -31,7 +31,7 @@ namespace vm {
  */
 class LocalInfo {
  public:
-  enum class Kind : uint8_t { Var, Parameter };
+  enum class Kind : uint8_t { Var, Parameter, Temporary };
 
   /**
    * Construct a local with the given, name, type, offset and kind.
@@ -47,6 +47,11 @@ class LocalInfo {
    */
   bool IsParameter() const noexcept { return kind_ == Kind::Parameter; }
 
+  /**
+   * @return True if this local is a temporary created for expression evaluation; false otherwise.
+   */
+  bool IsTemporary() const noexcept { return kind_ == Kind::Temporary; }
+
   /**
    * @return The name of this local variable.
    */
@@ -176,6 +181,11 @@ class LocalVar {
  *
  * TBC functions manage a set of locals. The first N locals are reserved for the input (and output)
  * parameters. The number of parameters tracks both input and output arguments.
+ *
+ * Locals are released when they go out of scope, and temporaries when the statement they were
+ * created for completes. A new local reuses the frame slot of a released local of the same type,
+ * if one exists, keeping frames small. Because slots are only shared between locals of the same
+ * type, every offset in the frame holds values of a single type.
  */
 class FunctionInfo {
  public:
@@ -211,7 +221,8 @@ class FunctionInfo {
   LocalVar GetReturnValueLocal() const;
 
   /**
-   * Lookup a local variable by name.
+   * Lookup a local variable by name. If several locals share the name, the most recently declared
+   * one that is still in scope is returned.
    * @param name The name of the local variable.
    * @return A (logical) pointer to the local variable.
    */
@@ -292,6 +303,19 @@ class FunctionInfo {
   // Allocate a new local variable in the function.
   LocalVar NewLocal(ast::Type *type, const std::string &name, LocalInfo::Kind kind);
 
+  // Enter a new lexical scope. Locals allocated until the matching call to
+  // ExitScope() are not visible to name lookups after it.
+  void EnterScope() { scope_marks_.push_back(visible_locals_.size()); }
+
+  // Exit the current lexical scope, releasing the slots of all its locals.
+  void ExitScope();
+
+  // Return a mark to pass to ReleaseTemporaries().
+  std::size_t GetTemporariesMark() const noexcept { return visible_locals_.size(); }
+
+  // Release the slots of all temporaries allocated since @em mark was taken.
+  void ReleaseTemporaries(std::size_t mark);
+
  private:
   // The ID of the function in the module. IDs are unique within a module.
   FunctionId id_;
@@ -303,6 +327,12 @@ class FunctionInfo {
   std::pair<std::size_t, std::size_t> bytecode_range_;
   // List of all locals visible to this function.
   std::vector<LocalInfo> locals_;
+  // Indexes into 'locals_' of the locals that are in scope, in declaration
+  // order, and the size of that list on entry to each open scope.
+  std::vector<uint32_t> visible_locals_;
+  std::vector<std::size_t> scope_marks_;
+  // Indexes into 'locals_' of released locals whose slots can be reused.
+  std::vector<uint32_t> free_locals_;
   // The size (in bytes) of this function's frame.
   std::size_t frame_size_;
   // The start position within the frame where the first input argument is.
@@ -248,6 +248,12 @@ VM_OP_WARM void OpExecutionContextGetTLS(
   *thread_state_container = exec_ctx->GetThreadStateContainer();
 }
 
+VM_OP void OpExecutionContextRecordTuples(tpl::sql::ExecutionContext *exec_ctx,
+                                          uint32_t operator_id, uint64_t num_tuples);
+
+VM_OP void OpExecutionContextRecordMorsels(tpl::sql::ExecutionContext *exec_ctx,
+                                           uint32_t pipeline_id, uint64_t num_morsels);
+
 VM_OP_WARM void OpThreadStateContainerAccessCurrentThreadState(
     byte **state, tpl::sql::ThreadStateContainer *thread_state_container) {
   *state = thread_state_container->AccessCurrentThreadState();
@@ -709,6 +715,10 @@ VM_OP_HOT void OpRemReal(tpl::sql::Real *const result, const tpl::sql::Real *con
 VM_OP void OpAggregationHashTableInit(tpl::sql::AggregationHashTable *agg_hash_table,
                                       tpl::sql::MemoryPool *memory, uint32_t payload_size);
 
+VM_OP void OpAggregationHashTableInitWithSize(tpl::sql::AggregationHashTable *agg_hash_table,
+                                              tpl::sql::MemoryPool *memory, uint32_t payload_size,
+                                              uint32_t initial_size);
+
 VM_OP_HOT void OpAggregationHashTableAllocTuple(byte **result,
                                                 tpl::sql::AggregationHashTable *agg_hash_table,
                                                 const hash_t hash_val) {
@@ -1206,6 +1216,10 @@ VM_OP void OpAnalysisStatsSetColumnBits(tpl::sql::JoinHashTable::AnalysisStats *
 VM_OP void OpSorterInit(tpl::sql::Sorter *sorter, tpl::sql::MemoryPool *memory,
                         tpl::sql::Sorter::ComparisonFunction cmp_fn, uint32_t tuple_size);
 
+VM_OP void OpSorterInitWithSize(tpl::sql::Sorter *sorter, tpl::sql::MemoryPool *memory,
+                                tpl::sql::Sorter::ComparisonFunction cmp_fn, uint32_t tuple_size,
+                                uint32_t expected_tuple_count);
+
 VM_OP_HOT void OpSorterAllocTuple(byte **result, tpl::sql::Sorter *sorter) {
   *result = sorter->AllocInputTuple();
 }
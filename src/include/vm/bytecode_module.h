@@ -84,6 +84,16 @@ class BytecodeModule {
    */
   std::size_t GetInstructionCount() const;
 
+  /**
+   * @return The size of the code section, in bytes.
+   */
+  std::size_t GetCodeSize() const { return code_.size(); }
+
+  /**
+   * @return The size of the data section, in bytes.
+   */
+  std::size_t GetDataSize() const { return data_.size(); }
+
   /**
    * @return The name of the module.
    */
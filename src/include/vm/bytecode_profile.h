@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "common/common.h"
+#include "common/macros.h"
+#include "vm/vm_defs.h"
+
+namespace tpl::vm {
+
+class BytecodeModule;
+
+/**
+ * Execution statistics for the functions of a bytecode module, collected by the interpreter. The
+ * JIT uses them to lay out compiled code for the data a query actually sees. For each function,
+ * the profile records the number of invocations and, for every conditional jump, the number of
+ * times the jump was and wasn't taken. Loop trip counts follow from the counts of a loop's exit
+ * test.
+ *
+ * Counters are bumped without atomic read-modify-write operations. Concurrent updates may be lost,
+ * but the profile only needs to be approximate, and the interpreter shouldn't pay for contended
+ * atomics on every branch.
+ */
+class BytecodeProfile {
+ public:
+  /**
+   * The counters of a single conditional jump.
+   */
+  class BranchCounters {
+   public:
+    /**
+     * Record one execution of the jump.
+     * @param taken Whether the jump was taken.
+     */
+    void Record(const bool taken) noexcept { Bump(taken ? &taken_ : &not_taken_); }
+
+    /**
+     * @return The number of times the jump was taken.
+     */
+    uint64_t GetTakenCount() const noexcept { return taken_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return The number of times the jump wasn't taken.
+     */
+    uint64_t GetNotTakenCount() const noexcept {
+      return not_taken_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    friend class BytecodeProfile;
+
+    static void Bump(std::atomic<uint64_t> *counter) noexcept {
+      counter->store(counter->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic<uint64_t> taken_{0};
+    std::atomic<uint64_t> not_taken_{0};
+  };
+
+  /**
+   * Create an empty profile for the functions in @em module.
+   * @param module The module to profile.
+   */
+  explicit BytecodeProfile(const BytecodeModule &module);
+
+  /**
+   * This class cannot be copied or moved.
+   */
+  DISALLOW_COPY_AND_MOVE(BytecodeProfile);
+
+  /**
+   * Record one invocation of the function with ID @em func_id.
+   */
+  void RecordInvocation(const FunctionId func_id) noexcept {
+    BranchCounters::Bump(&functions_[func_id].invocations);
+  }
+
+  /**
+   * @return The number of recorded invocations of the function with ID @em func_id.
+   */
+  uint64_t GetInvocationCount(const FunctionId func_id) const noexcept {
+    return functions_[func_id].invocations.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return The counters of the conditional jump at position @em position in the bytecode of the
+   *         function with ID @em func_id; NULL if there is no conditional jump at that position.
+   */
+  BranchCounters *GetBranchCounters(FunctionId func_id, std::size_t position);
+
+  /**
+   * @return The counters of the conditional jump at position @em position in the bytecode of the
+   *         function with ID @em func_id; NULL if there is no conditional jump at that position.
+   */
+  const BranchCounters *GetBranchCounters(FunctionId func_id, std::size_t position) const {
+    return const_cast<BytecodeProfile *>(this)->GetBranchCounters(func_id, position);
+  }
+
+  /**
+   * @return The total number of function invocations and conditional jump executions recorded
+   *         across all functions. This is a measure of how much of the module's execution the
+   *         profile has observed.
+   */
+  uint64_t GetTotalCount() const noexcept;
+
+ private:
+  struct FunctionProfile {
+    // The number of invocations.
+    std::atomic<uint64_t> invocations{0};
+    // The sorted bytecode positions of all conditional jumps, and the jumps'
+    // counters in the same order.
+    std::vector<std::size_t> branch_positions;
+    std::unique_ptr<BranchCounters[]> branches;
+  };
+
+ private:
+  // The profile of each function, indexed by ID.
+  std::vector<FunctionProfile> functions_;
+};
+
+}  // namespace tpl::vm
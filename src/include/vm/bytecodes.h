@@ -104,6 +104,8 @@ namespace tpl::vm {
   /* Execution Context */                                                                                              \
   F(ExecutionContextGetMemoryPool, OperandType::Local, OperandType::Local)                                             \
   F(ExecutionContextGetTLS, OperandType::Local, OperandType::Local)                                                    \
+  F(ExecutionContextRecordTuples, OperandType::Local, OperandType::Local, OperandType::Local)                          \
+  F(ExecutionContextRecordMorsels, OperandType::Local, OperandType::Local, OperandType::Local)                         \
                                                                                                                        \
   /* Thread State Container */                                                                                         \
   F(ThreadStateContainerIterate, OperandType::Local, OperandType::Local, OperandType::FunctionId)                      \
@@ -284,6 +286,7 @@ namespace tpl::vm {
                                                                                                                        \
   /* Aggregation Hash Table */                                                                                         \
   F(AggregationHashTableInit, OperandType::Local, OperandType::Local, OperandType::Local)                              \
+  F(AggregationHashTableInitWithSize, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)  \
   F(AggregationHashTableAllocTuple, OperandType::Local, OperandType::Local, OperandType::Local)                        \
   F(AggregationHashTableAllocTuplePartitioned, OperandType::Local, OperandType::Local, OperandType::Local)             \
   F(AggregationHashTableLinkHashTableEntry, OperandType::Local, OperandType::Local)                                    \
@@ -409,6 +412,8 @@ namespace tpl::vm {
                                                                                                                        \
   /* Sorting */                                                                                                        \
   F(SorterInit, OperandType::Local, OperandType::Local, OperandType::FunctionId, OperandType::Local)                   \
+  F(SorterInitWithSize, OperandType::Local, OperandType::Local, OperandType::FunctionId, OperandType::Local,           \
+      OperandType::Local)                                                                                              \
   F(SorterAllocTuple, OperandType::Local, OperandType::Local)                                                          \
   F(SorterAllocTupleTopK, OperandType::Local, OperandType::Local, OperandType::Local)                                  \
   F(SorterAllocTupleTopKFinish, OperandType::Local, OperandType::Local)                                                \
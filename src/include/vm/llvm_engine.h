@@ -17,6 +17,7 @@ class Type;
 namespace tpl::vm {
 
 class BytecodeModule;
+class BytecodeProfile;
 class FunctionInfo;
 class LocalVar;
 
@@ -50,14 +51,37 @@ class LLVMEngine {
    */
   static void Shutdown();
 
+  /**
+   * Time spent in each phase of compiling a module, in milliseconds, and the size of the result.
+   */
+  struct CompileStats {
+    // Loading handlers, and declaring and defining all functions in LLVM IR.
+    double ir_gen_ms{0.0};
+    // Simplifying and verifying the generated IR.
+    double verify_ms{0.0};
+    // Optimizing the IR.
+    double optimize_ms{0.0};
+    // Generating machine code.
+    double codegen_ms{0.0};
+    // Loading and linking machine code.
+    double load_ms{0.0};
+    // The size of the generated object code.
+    std::size_t object_code_bytes{0};
+    // The number of conditional branches weighted with profiled outcomes.
+    std::size_t weighted_branches{0};
+  };
+
   /**
    * JIT compile a TPL bytecode module to native code.
    *
    * @param module The module to compile.
+   * @param options The compilation options.
+   * @param stats Optional output for the time spent in each phase of compilation.
    * @return The JIT compiled module.
    */
   static std::unique_ptr<CompiledModule> Compile(const BytecodeModule &module,
-                                                 const CompilerOptions &options = {});
+                                                 const CompilerOptions &options = {},
+                                                 CompileStats *stats = nullptr);
 
   // -------------------------------------------------------
   // Compiler Options
@@ -71,7 +95,8 @@ class LLVMEngine {
     /**
      * Create compiler options with default values.
      */
-    CompilerOptions() : debug_(false), write_obj_file_(false), output_file_name_() {}
+    CompilerOptions()
+        : debug_(false), write_obj_file_(false), output_file_name_(), profile_(nullptr) {}
 
     /**
      * Set the debug option to the provided value. If debug is true, JIT code will contain debug
@@ -127,6 +152,25 @@ class LLVMEngine {
      */
     const std::string &GetOutputObjectFileName() const { return output_file_name_; }
 
+    /**
+     * Set the execution profile of the module to compile. Profiled branch outcomes and function
+     * invocation counts are attached to the generated code as branch weights and function entry
+     * counts, steering LLVM's block layout and branch optimizations. The profile is read once,
+     * when code for the module is generated.
+     *
+     * @param profile The profile, or NULL to compile without one.
+     * @return The current compiler options.
+     */
+    CompilerOptions &SetProfile(const BytecodeProfile *profile) {
+      profile_ = profile;
+      return *this;
+    }
+
+    /**
+     * @return The profile to guide compilation; NULL if there isn't one.
+     */
+    const BytecodeProfile *GetProfile() const { return profile_; }
+
     /**
      * @return The path where the required bytecode handlers is found.
      */
@@ -136,6 +180,7 @@ class LLVMEngine {
     bool debug_;
     bool write_obj_file_;
     std::string output_file_name_;
+    const BytecodeProfile *profile_;
   };
 
   // -------------------------------------------------------
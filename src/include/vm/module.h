@@ -1,16 +1,20 @@
 #pragma once
 
 #include <atomic>
+#include <exception>
 #include <memory>
 #include <mutex>  // NOLINT
 #include <string>
+#include <thread>  // NOLINT
 #include <utility>
 
 #include "llvm/Support/Memory.h"
 
 #include "ast/type.h"
 #include "vm/bytecode_module.h"
+#include "vm/bytecode_profile.h"
 #include "vm/llvm_engine.h"
+#include "vm/vm.h"
 #include "vm/vm_defs.h"
 
 namespace tpl::vm {
@@ -47,6 +51,11 @@ class Module {
    */
   DISALLOW_COPY_AND_MOVE(Module);
 
+  /**
+   * Destructor. Waits for a background compilation of the module, if one is in progress.
+   */
+  ~Module();
+
   /**
    * Look up the metadata for a TPL function in this module by its ID.
    * @return A pointer to the function's info if it exists; null otherwise.
@@ -98,6 +107,35 @@ class Module {
    */
   const BytecodeModule *GetBytecodeModule() const { return bytecode_module_.get(); }
 
+  /**
+   * @return The execution profile the interpreter collects for this module; NULL if the module
+   *         isn't profiled. A module is profiled from the time one of its functions is requested
+   *         in adaptive mode, and only if profile-guided compilation is enabled.
+   */
+  const BytecodeProfile *GetProfile() const {
+    const Profiling *profiling = profiling_.load(std::memory_order_acquire);
+    return profiling == nullptr ? nullptr : &profiling->profile;
+  }
+
+  /**
+   * @return Statistics about the compilation of this module into machine code. Only meaningful
+   *         after the module has been compiled.
+   */
+  const LLVMEngine::CompileStats &GetCompileStats() const { return compile_stats_; }
+
+  /**
+   * Compile this module into machine code. This is a blocking call. The module is compiled at most
+   * once; concurrent callers wait for a compilation that is already in progress. If compilation
+   * fails, the error is raised to every caller and the module keeps its interpreted functions.
+   */
+  void CompileToMachineCode();
+
+  /**
+   * Wait for a background compilation of this module into machine code to finish, if one was
+   * started. Adaptive execution starts one once the interpreter's profile is warm.
+   */
+  void WaitForCompilation();
+
  private:
   friend class VM;                      // For the VM to access raw bytecode.
   friend class BytecodeTrampolineTest;  // For the tests to check private methods.
@@ -127,6 +165,24 @@ class Module {
   // Generate a trampoline for the function.
   void CreateFunctionTrampoline(const FunctionInfo &func, Trampoline *trampoline);
 
+  // The profile of a module, and the module's direct-threaded code recording
+  // into it.
+  struct Profiling {
+    explicit Profiling(const BytecodeModule &module) : profile(module), code(module, &profile) {}
+    BytecodeProfile profile;
+    VM::ThreadedCode code;
+  };
+
+  // Start profiling the interpretation of this module so that it can be JIT
+  // compiled using the profile later. Returns false if the module can't be
+  // profiled, i.e., if profile-guided compilation is disabled.
+  bool StartProfiling();
+
+  // Called by the VM after it interprets a call into this module. If the
+  // module is being profiled and the profile has seen enough execution, the
+  // module is compiled in the background.
+  void CompileIfProfileIsWarm() const;
+
   // Access the bytecode trampoline for the function with the given ID.
   void *GetBytecodeImpl(const FunctionId func_id) const {
     return bytecode_trampolines_[func_id].GetCode();
@@ -141,9 +197,6 @@ class Module {
     return jit_module_->GetFunctionPointer(func_info->GetName());
   }
 
-  // Compile this module into machine code. This is a blocking call.
-  void CompileToMachineCode();
-
   // Compile this module into machine code. This is a non-blocking call that
   // triggers a compilation in the background.
   void CompileToMachineCodeAsync();
@@ -155,6 +208,29 @@ class Module {
   // The module containing compiled machine code for the TPL program.
   std::unique_ptr<LLVMEngine::CompiledModule> jit_module_;
 
+  // The bytecode translated into direct-threaded code for the interpreter.
+  // NULL if threaded interpretation is disabled.
+  std::unique_ptr<VM::ThreadedCode> threaded_code_;
+
+  // The execution profile collected by the interpreter, used to guide JIT
+  // compilation, with the profiling direct-threaded code. Created at most once,
+  // when the module is first run adaptively; NULL until then. The interpreter
+  // switches to the profiling code as soon as it's published.
+  std::unique_ptr<Profiling> profiling_storage_;
+  std::atomic<Profiling *> profiling_{nullptr};
+  std::once_flag profiling_flag_;
+
+  // Flag indicating if a background compilation has been requested.
+  mutable std::atomic<bool> compile_requested_{false};
+
+  // The thread running the background compilation, if any, and the latch
+  // protecting it.
+  std::mutex compile_thread_mutex_;
+  std::thread compile_thread_;
+
+  // Statistics of the JIT compilation.
+  LLVMEngine::CompileStats compile_stats_;
+
   // Function pointers for all functions defined in the TPL program. Pointers
   // may point into bytecode stub functions (i.e., interpreted implementations),
   // or into compiled machine-code implementations.
@@ -166,6 +242,9 @@ class Module {
 
   // Flag to indicate if the JIT compilation has occurred.
   std::once_flag compiled_flag_;
+
+  // The error the JIT compilation failed with, if any.
+  std::exception_ptr compile_error_;
 };
 
 // ---------------------------------------------------------
@@ -206,7 +285,12 @@ inline bool Module::GetFunction(std::string_view name, const ExecutionMode exec_
 
   switch (exec_mode) {
     case ExecutionMode::Adaptive: {
-      CompileToMachineCodeAsync();
+      // Interpret while compiling in the background. If the module can be
+      // profiled, compilation is deferred until the profile is warm so that it
+      // can guide the JIT. See CompileIfProfileIsWarm().
+      if (!StartProfiling()) {
+        CompileToMachineCodeAsync();
+      }
       FALLTHROUGH;
     }
     case ExecutionMode::Interpret: {
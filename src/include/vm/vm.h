@@ -1,11 +1,15 @@
 #pragma once
 
+#include <vector>
+
 #include "common/common.h"
 #include "common/macros.h"
 #include "vm/bytecode_function_info.h"
 
 namespace tpl::vm {
 
+class BytecodeModule;
+class BytecodeProfile;
 class Module;
 
 /**
@@ -24,6 +28,38 @@ class VM {
    */
   static void InvokeFunction(const Module *module, FunctionId func_id, const uint8_t args[]);
 
+  /**
+   * The bytecode of a module translated into the interpreter's direct-threaded form. Each
+   * instruction's opcode is replaced with the address of its handler in the interpreter, so that
+   * dispatching to the next instruction is a single indirect jump rather than an opcode read and a
+   * dispatch table lookup. Operands keep their encoding and width; only jump offsets are adjusted
+   * to account for the wider instructions. Conditional jumps carry one extra trailing operand: a
+   * pointer to the jump's counters in the module's profile, or NULL if the module isn't profiled.
+   * The translation is done once when a module is loaded.
+   */
+  class ThreadedCode {
+   public:
+    /**
+     * Translate the bytecode of all functions in @em module.
+     * @param module The bytecode module to translate.
+     * @param profile The profile to record branch outcomes into, if any.
+     */
+    ThreadedCode(const BytecodeModule &module, BytecodeProfile *profile);
+
+    /**
+     * @return The direct-threaded code for the function with ID @em func_id.
+     */
+    const uint8_t *GetCodeForFunction(FunctionId func_id) const {
+      return &code_[func_offsets_[func_id]];
+    }
+
+   private:
+    // The translated code for ALL functions, stored contiguously.
+    std::vector<uint8_t> code_;
+    // The position of each function's code in 'code_', indexed by ID.
+    std::vector<std::size_t> func_offsets_;
+  };
+
  private:
   // Private constructor to force users to use InvokeFunction().
   explicit VM(const Module *module);
@@ -31,7 +67,13 @@ class VM {
   // Forward declare the frame.
   class Frame;
 
+  // Execute the function @em func using the given execution frame. This uses
+  // the function's direct-threaded code if the module has any.
+  void Execute(const FunctionInfo &func, Frame *frame);
+
   // Interpret the given instruction stream using the given execution frame.
+  // If Threaded is true, the stream must be direct-threaded code.
+  template <bool Threaded>
   void Interpret(const uint8_t *ip, Frame *frame);
 
   // Execute a call instruction.
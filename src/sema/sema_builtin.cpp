@@ -291,8 +291,14 @@ void Sema::CheckBuiltinConcat(ast::CallExpression *call) {
 void Sema::CheckBuiltinAggHashTableCall(ast::CallExpression *call, ast::Builtin builtin) {
   switch (builtin) {
     case ast::Builtin::AggHashTableInit:
-      GenericBuiltinCheck<void(ast::x::AggregationHashTable *, ast::x::MemoryPool *, uint32_t)>(
-          call);
+      // Distinguish between default and presized tables.
+      if (call->NumArgs() <= 3) {
+        GenericBuiltinCheck<void(ast::x::AggregationHashTable *, ast::x::MemoryPool *, uint32_t)>(
+            call);
+      } else {
+        GenericBuiltinCheck<void(ast::x::AggregationHashTable *, ast::x::MemoryPool *, uint32_t,
+                                 uint32_t)>(call);
+      }
       break;
     case ast::Builtin::AggHashTableInsert:
       // Distinguish between partitioned and non-partitioned insertion.
@@ -533,6 +539,10 @@ void Sema::CheckBuiltinExecutionContextCall(ast::CallExpression *call, ast::Buil
     case ast::Builtin::ExecutionContextGetTLS:
       GenericBuiltinCheck<ast::x::ThreadStateContainer *(ast::x::ExecutionContext *)>(call);
       break;
+    case ast::Builtin::ExecutionContextRecordTuples:
+    case ast::Builtin::ExecutionContextRecordMorsels:
+      GenericBuiltinCheck<void(ast::x::ExecutionContext *, uint32_t, uint64_t)>(call);
+      break;
     default:
       UNREACHABLE("Impossible execution context call");
   }
@@ -1016,7 +1026,12 @@ void Sema::CheckBuiltinSorterCall(ast::CallExpression *call, ast::Builtin builti
   switch (builtin) {
     case ast::Builtin::SorterInit:
       using SortFunc = Function<bool(AnyPointer, AnyPointer)>;
-      GenericBuiltinCheck<void(ast::x::Sorter *, ast::x::MemoryPool *, SortFunc, uint32_t)>(call);
+      if (call->NumArgs() <= 4) {
+        GenericBuiltinCheck<void(ast::x::Sorter *, ast::x::MemoryPool *, SortFunc, uint32_t)>(call);
+      } else {
+        GenericBuiltinCheck<void(ast::x::Sorter *, ast::x::MemoryPool *, SortFunc, uint32_t,
+                                 uint32_t)>(call);
+      }
       break;
     case ast::Builtin::SorterInsert:
       GenericBuiltinCheck<uint8_t *(ast::x::Sorter *)>(call);
@@ -1141,7 +1156,9 @@ void Sema::CheckBuiltinCall(ast::CallExpression *call) {
       break;
     }
     case ast::Builtin::ExecutionContextGetMemoryPool:
-    case ast::Builtin::ExecutionContextGetTLS: {
+    case ast::Builtin::ExecutionContextGetTLS:
+    case ast::Builtin::ExecutionContextRecordTuples:
+    case ast::Builtin::ExecutionContextRecordMorsels: {
       CheckBuiltinExecutionContextCall(call, builtin);
       break;
     }
@@ -92,6 +92,14 @@ bool HasDuplicatesNames(const util::RegionVector<ast::FieldDeclaration *> &field
 void Sema::VisitFunctionDeclaration(ast::FunctionDeclaration *node) {
   DeclarationContextScope scope(this, node);
 
+  // Declarations may be shared between files (e.g., the compilation units of a
+  // query). One checked as part of an earlier file is only made available.
+  if (node->GetFunctionLiteral()->GetType() != nullptr) {
+    TPL_ASSERT(scope_ != nullptr, "No scope exists!");
+    scope_->Declare(node->GetName(), node->GetFunctionLiteral()->GetType());
+    return;
+  }
+
   // Resolve **JUST** the function's type representation, not the function body.
   ast::Type *func_type = Resolve(node->GetTypeRepr());
 
@@ -123,6 +131,14 @@ void Sema::VisitFunctionDeclaration(ast::FunctionDeclaration *node) {
 void Sema::VisitStructDeclaration(ast::StructDeclaration *node) {
   DeclarationContextScope scope(this, node);
 
+  // Like functions, structs checked as part of an earlier file are only made
+  // available. Resolving them again would create a distinct struct type.
+  if (node->GetTypeRepr()->GetType() != nullptr) {
+    TPL_ASSERT(scope_ != nullptr, "No scope exists!");
+    scope_->Declare(node->GetName(), node->GetTypeRepr()->GetType());
+    return;
+  }
+
   ast::Type *struct_type = Resolve(node->GetTypeRepr());
 
   if (struct_type == nullptr) {
@@ -24,6 +24,7 @@
 #include "util/bit_util.h"
 #include "util/math_util.h"
 #include "util/timer.h"
+#include "util/trace_recorder.h"
 
 namespace tpl::sql {
 
@@ -609,6 +610,7 @@ AggregationHashTable *AggregationHashTable::GetOrBuildTableOverPartition(
       memory_->AllocateAligned(sizeof(AggregationHashTable), alignof(AggregationHashTable), false))
       AggregationHashTable(memory_, payload_size_, estimated_size);
 
+  util::TraceScope trace("aggregation", "BuildPartition", "partition", partition_idx);
   util::Timer<std::milli> timer;
   timer.Start();
 
@@ -763,6 +765,8 @@ void AggregationHashTable::MergePartitions(AggregationHashTable *target, void *q
 
   // Merge overflow data into the appropriate partitioned table in the target.
   tbb::parallel_for_each(nonempty_parts, [&](const uint32_t part_idx) {
+    util::TraceScope trace("aggregation", "MergePartition", "partition", part_idx);
+
     // Get the partitioned hash table from the target.
     auto agg_table_partition = target->GetOrBuildTableOverPartition(query_state, part_idx);
 
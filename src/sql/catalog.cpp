@@ -15,6 +15,7 @@
 #include "logging/logger.h"
 #include "sql/schema.h"
 #include "sql/table.h"
+#include "sql/table_statistics.h"
 
 namespace tpl::sql {
 
@@ -196,12 +197,26 @@ std::pair<byte *, uint32_t *> GenerateColumnData(ColumnInsertMeta *col_meta, uin
           col_meta, num_rows, std::get<int64_t>(col_meta->min), std::get<int64_t>(col_meta->max)));
       break;
     }
-    case SqlTypeId::BigInt:
-    case SqlTypeId::Decimal: {
+    case SqlTypeId::BigInt: {
       col_data = reinterpret_cast<byte *>(CreateNumberColumnData<int64_t>(
           col_meta, num_rows, std::get<int64_t>(col_meta->min), std::get<int64_t>(col_meta->max)));
       break;
     }
+    case SqlTypeId::Decimal: {
+      // The generated values are the encoded decimals, i.e., already scaled.
+      auto *vals = CreateNumberColumnData<int64_t>(
+          col_meta, num_rows, std::get<int64_t>(col_meta->min), std::get<int64_t>(col_meta->max));
+      if (col_meta->type.GetPrimitiveTypeId() == TypeId::HugeInt) {
+        auto *wide_vals = static_cast<int128_t *>(
+            Memory::MallocAligned(sizeof(int128_t) * num_rows, CACHELINE_SIZE));
+        std::copy(vals, vals + num_rows, wide_vals);
+        std::free(vals);
+        col_data = reinterpret_cast<byte *>(wide_vals);
+      } else {
+        col_data = reinterpret_cast<byte *>(vals);
+      }
+      break;
+    }
     case SqlTypeId::Real: {
       col_data = reinterpret_cast<byte *>(CreateNumberColumnData<float>(
           col_meta, num_rows, std::get<double>(col_meta->min), std::get<double>(col_meta->max)));
@@ -318,4 +333,28 @@ void Catalog::InsertTable(const std::string &table_name, std::unique_ptr<Table>
   table_name_to_id_map_.insert(std::make_pair(table_name, table_id));
 }
 
+const TableStatistics *Catalog::AnalyzeTable(uint16_t table_id) {
+  const Table *table = LookupTableById(table_id);
+  if (table == nullptr) {
+    return nullptr;
+  }
+  LOG_INFO("Analyzing table '{}'", table->GetName());
+  auto &stats = table_stats_[table_id];
+  stats = TableStatistics::Compute(*table);
+  return stats.get();
+}
+
+void Catalog::AnalyzeAllTables() {
+  for (const auto &[table_id, table] : table_catalog_) {
+    AnalyzeTable(table_id);
+  }
+}
+
+void Catalog::ClearTableStatistics(uint16_t table_id) { table_stats_.erase(table_id); }
+
+const TableStatistics *Catalog::LookupTableStatisticsById(uint16_t table_id) const {
+  auto iter = table_stats_.find(table_id);
+  return (iter == table_stats_.end() ? nullptr : iter->second.get());
+}
+
 }  // namespace tpl::sql
@@ -9,6 +9,7 @@
 #include "ast/context.h"
 #include "common/exception.h"
 #include "common/macros.h"
+#include "common/settings.h"
 #include "logging/logger.h"
 #include "sql/codegen/compilation_unit.h"
 #include "sql/codegen/executable_query.h"
@@ -68,6 +69,7 @@ std::atomic<uint64_t> kUniqueIds{0};
 
 CompilationContext::CompilationContext(ExecutableQuery *query)
     : unique_id_(kUniqueIds++),
+      profiling_(Settings::Instance()->GetBool(Settings::Name::ProfileQueries)),
       query_(query),
       codegen_(MakeContainer()),
       query_state_var_(codegen_.MakeIdentifier("q_state")),
@@ -120,42 +122,95 @@ void CompilationContext::DeclareCommonStructsAndFunctions() {
 void CompilationContext::GenerateQueryLogic(const PipelineGraph &pipeline_graph,
                                             const Pipeline &main_pipeline) {
   // Now we're ready to generate some code.
-  // First, generate the query state initialization and tear-down logic.
-  ast::FunctionDeclaration *init_fn = GenerateInitFunction();
-  ast::FunctionDeclaration *tear_down_fn = GenerateTearDownFunction();
+  // The main container holds the query-level structures and functions generated so far. If each
+  // pipeline is compiled separately, the pipeline gets a container of its own, seeded with a copy
+  // of these declarations.
+  CompilationUnit *main_container = codegen_.GetContainer();
+  const bool per_pipeline = Settings::Instance()->GetBool(Settings::Name::PerPipelineCompilation);
 
-  // Next, generate all pipeline code.
+  // Generate all pipeline code.
   // Optimize (prematurely?) by reserving now.
   std::vector<ExecutionStep> steps;
+  std::vector<std::size_t> step_containers;
   steps.reserve(pipeline_graph.NumPipelines() * 3);
+  step_containers.reserve(pipeline_graph.NumPipelines() * 3);
 
   // Determine order.
   std::vector<const Pipeline *> pipeline_exec_order;
   pipeline_graph.CollectTransitiveDependencies(main_pipeline, &pipeline_exec_order);
 
   // Generate!
+  std::size_t container_idx = 0;
   for (auto pipeline : pipeline_exec_order) {
+    if (per_pipeline) {
+      CompilationUnit *container = MakeContainer();
+      container->CopyDeclarations(*main_container);
+      codegen_.SetContainer(container);
+      container_idx = containers_.size() - 1;
+    }
     // Prepare and generate the pipeline steps.
     auto exec_funcs = pipeline->GeneratePipelineLogic();
     // Each generated function becomes an execution step in the order
     // provided by the pipeline.
     for (auto func : exec_funcs) {
       steps.emplace_back(pipeline->GetId(), func->GetName().ToString());
+      step_containers.push_back(container_idx);
     }
   }
+  codegen_.SetContainer(main_container);
+
+  // Then, generate the query state initialization and tear-down logic. This is
+  // done after the pipelines so that pipeline containers don't copy them.
+  ast::FunctionDeclaration *init_fn = GenerateInitFunction();
+  ast::FunctionDeclaration *tear_down_fn = GenerateTearDownFunction();
+
+  // Compile all containers, the main one first. Containers share the AST
+  // context, which isn't thread-safe, so they're compiled one at a time. The
+  // costlier compilation into machine code is done in parallel when the query
+  // is run (see ExecutableQuery::Run()). Record the time spent in each phase
+  // while we're at it. Code generation time is filled by the caller.
+  std::vector<std::unique_ptr<vm::Module>> modules;
+  modules.reserve(containers_.size());
+  ExecutableQuery::CompileStats compile_stats;
+  for (const auto &container : containers_) {
+    auto module = container->Compile();
+
+    // Check compilation error.
+    if (module == nullptr) {
+      throw Exception(ExceptionType::CodeGen, "Error compiling query module!");
+    }
 
-  // Compile the single container containing all the code.
-  std::vector<std::unique_ptr<vm::Module>> modules(1);
-  modules[0] = containers_[0]->Compile();
+    compile_stats.sema_ms += container->GetSemaTimeMs();
+    compile_stats.bytecode_gen_ms += container->GetBytecodeGenTimeMs();
+    compile_stats.module_gen_ms += container->GetModuleGenTimeMs();
+    compile_stats.bytecode_bytes += module->GetBytecodeModule()->GetCodeSize();
+    modules.push_back(std::move(module));
+  }
+  query_->SetCompileStats(compile_stats);
 
-  // Check compilation error.
-  if (modules[0] == nullptr) {
-    throw Exception(ExceptionType::CodeGen, "Error compiling query module!");
+  // Resolve all the steps in the module of the container they were generated in.
+  for (std::size_t i = 0; i < steps.size(); i++) {
+    steps[i].Resolve(modules[step_containers[i]].get());
   }
 
-  // Resolve all the steps.
-  for (auto &step : steps) {
-    step.Resolve(modules[0].get());
+  // If profiling, provide what's needed to interpret the query's runtime statistics.
+  if (IsProfiling()) {
+    ExecutableQuery::ProfileInfo profile_info;
+    profile_info.operator_ids = operator_ids_;
+    profile_info.num_pipelines = pipeline_graph.NumPipelines();
+    for (auto pipeline : pipeline_exec_order) {
+      for (auto iter = pipeline->Begin(), end = pipeline->End(); iter != end; ++iter) {
+        if (!pipeline->IsLastOperator(**iter)) {
+          profile_info.counted_operators.insert(GetOperatorId((*iter)->GetPlan()));
+        }
+      }
+      profile_info.pipelines.push_back(ExecutableQuery::PipelineInfo{
+          pipeline->GetId(),
+          fmt::format("{} ({})", pipeline->ConstructPipelinePath(),
+                      pipeline->IsParallel() ? "parallel" : "serial"),
+          &(*pipeline->Begin())->GetPlan(), pipeline->IsParallel()});
+    }
+    query_->EnableProfiling(std::move(profile_info));
   }
 
   // Setup query and finish.
@@ -210,6 +265,13 @@ std::unique_ptr<ExecutableQuery> CompilationContext::Compile(
   timer.Stop();
   LOG_DEBUG("Compilation time: {:.2f} ms", timer.GetElapsed());
 
+  // Everything not spent compiling the generated AST was spent generating it.
+  auto compile_stats = query->GetCompileStats();
+  compile_stats.codegen_ms = timer.GetElapsed() - compile_stats.sema_ms -
+                             compile_stats.bytecode_gen_ms - compile_stats.module_gen_ms;
+  compile_stats.ast_bytes = query->GetContext()->GetRegion()->allocated();
+  query->SetCompileStats(compile_stats);
+
   return query;
 }
 
@@ -277,6 +339,7 @@ void CompilationContext::Prepare(const planner::AbstractPlanNode &plan, Pipeline
   }
 
   operators_[&plan] = std::move(translator);
+  operator_ids_.emplace(&plan, operator_ids_.size());
 }
 
 void CompilationContext::Prepare(const planner::AbstractExpression &expression) {
@@ -358,6 +421,11 @@ ExpressionTranslator *CompilationContext::LookupTranslator(
   return nullptr;
 }
 
+uint32_t CompilationContext::GetOperatorId(const planner::AbstractPlanNode &node) const {
+  TPL_ASSERT(operator_ids_.count(&node) != 0, "Plan node was not prepared in this context");
+  return operator_ids_.at(&node);
+}
+
 std::string CompilationContext::GetFunctionPrefix() const {
   return "Query" + std::to_string(unique_id_);
 }
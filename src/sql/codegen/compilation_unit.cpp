@@ -80,8 +80,11 @@ std::unique_ptr<vm::Module> CompilationUnit::Compile() {
   compiler::Compiler::RunCompilation(input, &timer);
   std::unique_ptr<vm::Module> module = callbacks.ReleaseModule();
 
-  LOG_DEBUG("Type-check: {:.2f} ms, Bytecode Gen: {:.2f} ms, Module Gen: {:.2f} ms",
-            timer.GetSemaTimeMs(), timer.GetBytecodeGenTimeMs(), timer.GetModuleGenTimeMs());
+  sema_ms_ = timer.GetSemaTimeMs();
+  bytecode_gen_ms_ = timer.GetBytecodeGenTimeMs();
+  module_gen_ms_ = timer.GetModuleGenTimeMs();
+  LOG_DEBUG("Type-check: {:.2f} ms, Bytecode Gen: {:.2f} ms, Module Gen: {:.2f} ms", sema_ms_,
+            bytecode_gen_ms_, module_gen_ms_);
 
   // Done.
   return module;
@@ -24,7 +24,9 @@ edsl::ValueVT ConsumerContext::DeriveValue(const planner::AbstractExpression &ex
 }
 
 void ConsumerContext::Consume(FunctionBuilder *function) {
+  const OperatorTranslator *producer = *pipeline_iter_;
   if (++pipeline_iter_ == pipeline_end_) return;
+  pipeline_ctx_.CountTuple(*producer, function);
   (*pipeline_iter_)->Consume(this, function);
 }
 
@@ -1,6 +1,11 @@
 #include "sql/codegen/executable_query.h"
 
 #include <algorithm>
+#include <numeric>
+#include <ostream>
+
+#include "spdlog/fmt/fmt.h"
+#include "tbb/task_group.h"
 
 #include "ast/context.h"
 #include "common/defer.h"
@@ -9,10 +14,83 @@
 #include "sema/error_reporter.h"
 #include "sql/codegen/execution_plan.h"
 #include "sql/execution_context.h"
+#include "sql/planner/plannodes/abstract_plan_node.h"
+#include "sql/query_profile.h"
+#include "util/perf_counters.h"
 #include "vm/module.h"
 
 namespace tpl::sql::codegen {
 
+namespace {
+
+// Print the subtree rooted at the given node, annotated with the node's runtime statistics.
+void PrintProfiledPlan(std::ostream &os, const ExecutableQuery &query,
+                       const planner::AbstractPlanNode &node, uint32_t depth) {
+  const QueryProfile &profile = *query.GetProfile();
+  const auto children = node.GetChildren();
+
+  // Tuple counts of operators that only ever end pipelines aren't known.
+  const auto rows_out = [&](const planner::AbstractPlanNode &op) {
+    return query.IsOperatorCounted(op)
+               ? std::to_string(profile.GetNumTuples(query.GetOperatorId(op)))
+               : std::string("n/a");
+  };
+
+  std::string line = std::string(depth * 2, ' ') + "-> ";
+  line += planner::PlanNodeTypeToString(node.GetPlanNodeType());
+  if (!children.empty()) {
+    const bool all_counted = std::all_of(children.begin(), children.end(), [&](const auto child) {
+      return query.IsOperatorCounted(*child);
+    });
+    uint64_t rows_in = 0;
+    for (const auto child : children) {
+      rows_in += profile.GetNumTuples(query.GetOperatorId(*child));
+    }
+    line += fmt::format(" (rows_in={}", all_counted ? std::to_string(rows_in) : "n/a");
+  } else {
+    line += " (";
+  }
+  line += fmt::format("{}rows_out={}", children.empty() ? "" : ", ", rows_out(node));
+  if (node.GetPlanNodeType() == planner::PlanNodeType::HASHJOIN) {
+    line += fmt::format(", hash_table_entries={}", rows_out(*children[0]));
+  }
+  os << line << ")" << std::endl;
+
+  for (const auto child : children) {
+    PrintProfiledPlan(os, query, *child, depth + 1);
+  }
+}
+
+}  // namespace
+
+class ExecutableQuery::BackgroundCompiler {
+ public:
+  // Start compiling the given modules, in order.
+  explicit BackgroundCompiler(const std::vector<std::unique_ptr<vm::Module>> &modules) {
+    for (const auto &module : modules) {
+      tasks_.run([module = module.get()]() {
+        // The module keeps the error, and raises it again when one of its
+        // functions is requested in compiled mode.
+        try {
+          module->CompileToMachineCode();
+        } catch (const std::exception &ex) {
+          LOG_ERROR("Failed to compile module '{}': {}", module->GetBytecodeModule()->GetName(),
+                    ex.what());
+        }
+      });
+    }
+  }
+
+  // Wait for all pending compilations.
+  ~BackgroundCompiler() { Wait(); }
+
+  // Wait for all pending compilations.
+  void Wait() { tasks_.wait(); }
+
+ private:
+  tbb::task_group tasks_;
+};
+
 ExecutableQuery::ExecutableQuery(const planner::AbstractPlanNode &plan)
     : plan_(plan),
       errors_(std::make_unique<sema::ErrorReporter>()),
@@ -20,8 +98,8 @@ ExecutableQuery::ExecutableQuery(const planner::AbstractPlanNode &plan)
       main_module_(nullptr),
       query_state_size_(0) {}
 
-// Needed because we forward-declare classes used as template types to std::unique_ptr<>
-ExecutableQuery::~ExecutableQuery() = default;
+// Pending compilations must finish before the modules and the AST context are destroyed.
+ExecutableQuery::~ExecutableQuery() { WaitForCompilation(); }
 
 void ExecutableQuery::Setup(std::vector<std::unique_ptr<vm::Module>> &&modules,
                             vm::Module *main_module, std::string init_fn, std::string tear_down_fn,
@@ -55,11 +133,41 @@ void ExecutableQuery::Setup(std::vector<std::unique_ptr<vm::Module>> &&modules,
   query_state_size_ = query_state_size;
 }
 
+void ExecutableQuery::WaitForCompilation() {
+  if (background_compiler_ != nullptr) {
+    background_compiler_->Wait();
+  }
+  for (const auto &module : modules_) {
+    module->WaitForCompilation();
+  }
+}
+
+void ExecutableQuery::EnableProfiling(ProfileInfo &&profile_info) {
+  profile_info_ = std::make_unique<ProfileInfo>(std::move(profile_info));
+}
+
 void ExecutableQuery::Run(ExecutionContext *exec_ctx, vm::ExecutionMode mode) {
   // First, allocate the query state and move the execution context into it.
   auto query_state = std::make_unique<byte[]>(query_state_size_);
   *reinterpret_cast<ExecutionContext **>(query_state.get()) = exec_ctx;
 
+  // If profiled, collect statistics for this run into a fresh profile.
+  if (IsProfiled()) {
+    profile_ = std::make_unique<QueryProfile>(profile_info_->operator_ids.size(),
+                                              profile_info_->num_pipelines);
+    exec_ctx->SetQueryProfile(profile_.get());
+  }
+
+  // Detach the profile from the context when done, after the query is torn down.
+  DEFER(exec_ctx->SetQueryProfile(nullptr));
+
+  // Compile all modules into machine code in parallel. Fetching a function in
+  // compiled mode below only waits for the module it belongs to. In adaptive
+  // mode, each module is compiled once the interpreter has profiled it.
+  if (mode == vm::ExecutionMode::Compiled && background_compiler_ == nullptr) {
+    background_compiler_ = std::make_unique<BackgroundCompiler>(modules_);
+  }
+
   // Pull out init and tear-down functions.
   ExecStepFn init, tear_down;
   UNUSED bool found_init = main_module_->GetFunction(init_fn_, mode, init);
@@ -74,10 +182,60 @@ void ExecutableQuery::Run(ExecutionContext *exec_ctx, vm::ExecutionMode mode) {
   DEFER(tear_down(query_state.get()));
 
   // Now, run the main execution plan!
-  execution_plan_.Run(query_state.get(), mode);
+  execution_plan_.Run(query_state.get(), mode, profile_.get());
 
   // The query tear-down logic is deferred above; it is automatically executed
   // for us if any exceptions occur. Thus, we needn't manually execute it.
 }
 
+uint32_t ExecutableQuery::GetOperatorId(const planner::AbstractPlanNode &node) const {
+  TPL_ASSERT(IsProfiled(), "Operator IDs are only available in profiled queries");
+  return profile_info_->operator_ids.at(&node);
+}
+
+bool ExecutableQuery::IsOperatorCounted(const planner::AbstractPlanNode &node) const {
+  TPL_ASSERT(IsProfiled(), "Operator counts are only available in profiled queries");
+  return profile_info_->counted_operators.count(GetOperatorId(node)) != 0;
+}
+
+void ExecutableQuery::PrintProfile(std::ostream &os) const {
+  if (profile_ == nullptr) {
+    throw Exception(ExceptionType::Execution, "No runtime statistics. Was the query profiled?");
+  }
+
+  os << "Pipelines:" << std::endl;
+  for (const auto &[id, description, source, parallel] : profile_info_->pipelines) {
+    const auto morsels = profile_->GetMorselsPerThread(id);
+    std::string per_thread;
+    for (const auto count : morsels) {
+      per_thread += (per_thread.empty() ? "" : ", ") + std::to_string(count);
+    }
+    std::string line =
+        fmt::format("  #{} {}: time={:.3f} ms, threads={}, morsels={} [{}]", id, description,
+                    profile_->GetPipelineTime(id), morsels.size(),
+                    std::accumulate(morsels.begin(), morsels.end(), uint64_t{0}), per_thread);
+    // Hardware counters, if they were available. They're sampled only on the thread running the
+    // execution plan, so they don't cover the work of a parallel pipeline's other threads.
+    if (const auto counters = profile_->GetPipelineCounters(id);
+        counters.Get(util::PerfCounters::Event::Cycles) != 0) {
+      if (parallel) {
+        line += ", counters=n/a (parallel)";
+      } else {
+        using Event = util::PerfCounters::Event;
+        const auto tuples = profile_->GetNumTuples(GetOperatorId(*source));
+        line += fmt::format(
+            ", ipc={:.2f}, llc_misses/tuple={:.2f}, branch_misses/tuple={:.2f}, "
+            "dtlb_misses/tuple={:.2f}",
+            counters.GetIPC(), counters.GetPer(Event::LLCMisses, tuples),
+            counters.GetPer(Event::BranchMisses, tuples),
+            counters.GetPer(Event::DTLBMisses, tuples));
+      }
+    }
+    os << line << std::endl;
+  }
+
+  os << "Plan:" << std::endl;
+  PrintProfiledPlan(os, *this, plan_, 1);
+}
+
 }  // namespace tpl::sql::codegen
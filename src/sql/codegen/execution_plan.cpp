@@ -3,6 +3,9 @@
 #include "spdlog/fmt/fmt.h"
 
 #include "common/exception.h"
+#include "sql/query_profile.h"
+#include "util/perf_counters.h"
+#include "util/timer.h"
 #include "vm/module.h"
 
 namespace tpl::sql::codegen {
@@ -37,9 +40,23 @@ void ExecutionStep::Run(byte query_state[], vm::ExecutionMode mode) const {
 
 ExecutionPlan::ExecutionPlan(std::vector<ExecutionStep> &&steps) : steps_(std::move(steps)) {}
 
-void ExecutionPlan::Run(byte query_state[], vm::ExecutionMode mode) const {
+void ExecutionPlan::Run(byte query_state[], vm::ExecutionMode mode, QueryProfile *profile) const {
+  if (profile == nullptr) {
+    for (const auto &step : steps_) {
+      step.Run(query_state, mode);
+    }
+    return;
+  }
+
+  util::PerfCounters counters;
   for (const auto &step : steps_) {
-    step.Run(query_state, mode);
+    counters.Start();
+    const double ms = util::Time<std::milli>([&] { step.Run(query_state, mode); });
+    counters.Stop();
+    profile->RecordPipelineTime(step.GetPipelineId(), ms);
+    if (counters.IsAvailable()) {
+      profile->RecordPipelineCounters(step.GetPipelineId(), counters.Read());
+    }
   }
 }
 
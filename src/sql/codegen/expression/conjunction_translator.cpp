@@ -7,6 +7,7 @@
 #include "sql/codegen/compilation_context.h"
 #include "sql/codegen/consumer_context.h"
 #include "sql/codegen/edsl/boolean_ops.h"
+#include "sql/codegen/edsl/ops.h"
 #include "sql/codegen/edsl/value.h"
 #include "sql/codegen/edsl/value_vt.h"
 
@@ -22,8 +23,13 @@ ConjunctionTranslator::ConjunctionTranslator(const planner::ConjunctionExpressio
 
 edsl::ValueVT ConjunctionTranslator::DeriveValue(ConsumerContext *ctx,
                                                  const ColumnValueProvider *cvp) const {
-  auto left_val = ctx->DeriveValue(*GetChild(0), cvp).As<bool>();
-  auto right_val = ctx->DeriveValue(*GetChild(1), cvp).As<bool>();
+  // Children may produce either primitive or SQL booleans (e.g., LIKE).
+  const auto derive_truth = [&](const planner::AbstractExpression &child) {
+    auto val = ctx->DeriveValue(child, cvp);
+    return val.IsSQLType() ? edsl::ForceTruth(val.As<ast::x::BooleanVal>()) : val.As<bool>();
+  };
+  auto left_val = derive_truth(*GetChild(0));
+  auto right_val = derive_truth(*GetChild(1));
 
   switch (auto cmp_kind = GetExpressionAs<planner::ConjunctionExpression>().GetKind(); cmp_kind) {
     case planner::ConjunctionKind::AND:
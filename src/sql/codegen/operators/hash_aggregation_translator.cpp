@@ -1,10 +1,12 @@
 #include "sql/codegen/operators/hash_aggregation_translator.h"
 
+#include <algorithm>
 #include <string_view>
 
 // For string formatting.
 #include "spdlog/fmt/fmt.h"
 
+#include "sql/aggregation_hash_table.h"
 #include "sql/codegen/codegen.h"
 #include "sql/codegen/compilation_context.h"
 #include "sql/codegen/edsl/comparison_ops.h"
@@ -12,6 +14,7 @@
 #include "sql/codegen/function_builder.h"
 #include "sql/codegen/if.h"
 #include "sql/codegen/loop.h"
+#include "sql/planner/cardinality_estimator.h"
 #include "sql/planner/plannodes/aggregate_plan_node.h"
 
 namespace tpl::sql::codegen {
@@ -151,6 +154,20 @@ void HashAggregationTranslator::DefinePipelineFunctions(const PipelineContext &p
 
 void HashAggregationTranslator::InitializeQueryState(FunctionBuilder *function) const {
   auto hash_table = GetQueryStateEntryPtr(global_agg_ht_);
+
+  // Presize the table when statistics predict more groups than fit by default, avoiding repeated
+  // growth during the build. Parallel builds aggregate into thread-local tables sized to fit in
+  // cache and only use the global table to merge partitions, so they're left as is.
+  const auto num_groups = planner::CardinalityEstimator::EstimateGroupCount(GetPlan());
+  if (!build_pipeline_.IsParallel() && num_groups &&
+      *num_groups > AggregationHashTable::kDefaultInitialTableSize) {
+    const auto initial_size = static_cast<uint32_t>(
+        std::min<uint64_t>(*num_groups, AggregationHashTable::kMaxInitialTableSize));
+    function->Append(hash_table->Init(GetMemoryPool(), agg_payload_.GetSize(),
+                                      edsl::Literal<uint32_t>(codegen_, initial_size)));
+    return;
+  }
+
   function->Append(hash_table->Init(GetMemoryPool(), agg_payload_.GetSize()));
 }
 
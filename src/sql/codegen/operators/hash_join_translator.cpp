@@ -114,6 +114,9 @@ edsl::Variable<hash_t> HashJoinTranslator::HashKeys(ConsumerContext *ctx, Functi
 }
 
 edsl::ValueVT HashJoinTranslator::GetBuildRowAttribute(uint32_t attr_idx) const {
+  if (!null_build_row_.empty()) {
+    return null_build_row_[attr_idx];
+  }
   return storage_.ReadSQL(*build_row_, attr_idx);
 }
 
@@ -167,35 +170,62 @@ void HashJoinTranslator::ProbeJoinHashTable(ConsumerContext *ctx, FunctionBuilde
   edsl::Variable<hash_t> hash_val = HashKeys(ctx, function, false);
 
   if (GetJoinPlan().RequiresRightMark()) {
+    const auto join_type = GetJoinPlan().GetLogicalJoinType();
+    const bool is_right_outer = join_type == planner::LogicalJoinType::RIGHT;
+
+    // Consuming advances the context through the pipeline. Right-outer joins
+    // consume matches and non-matches separately, so keep a copy for the latter.
+    ConsumerContext outer_ctx(*ctx);
+
     edsl::Variable<bool> right_mark(codegen_, "right_mark");
     function->Append(edsl::Declare(right_mark, true));
 
-    // Probe hash table and check for a match. Loop condition becomes false as
-    // soon as a match is found.
-    Loop entry_loop(
-        function, edsl::Declare(entry, hash_table->Lookup(hash_val)),
-        edsl::Value<bool>(entry.GetCodeGen(), entry.GetCodeGen()->CompareNe(
-                                                  entry.GetRaw(), entry.GetCodeGen()->Nil())) &&
-            right_mark,
-        edsl::Assign(entry, entry->Next()));
+    // Probe hash table and check for a match. For semi and anti joins, the
+    // loop condition becomes false as soon as a match is found. Outer joins
+    // must visit every match.
+    edsl::Value<bool> valid_entry(entry.GetCodeGen(), entry.GetCodeGen()->CompareNe(
+                                                          entry.GetRaw(), entry.GetCodeGen()->Nil()));
+    Loop entry_loop(function, edsl::Declare(entry, hash_table->Lookup(hash_val)),
+                    is_right_outer ? valid_entry : valid_entry && right_mark,
+                    edsl::Assign(entry, entry->Next()));
     {
       If check_hash(function, hash_val == entry->GetHash());
       {
         function->Append(
             edsl::Declare(*build_row_, edsl::PtrCast(storage_.GetPtrToType(), entry->GetRow())));
-        CheckRightMark(ctx, function, right_mark);
+        if (is_right_outer) {
+          CheckJoinPredicate(ctx, function, &right_mark);
+        } else {
+          CheckRightMark(ctx, function, right_mark);
+        }
       }
     }
     entry_loop.EndLoop();
 
-    if (GetJoinPlan().GetLogicalJoinType() == planner::LogicalJoinType::RIGHT_ANTI) {
+    if (join_type == planner::LogicalJoinType::RIGHT_ANTI) {
       // If the right mark is true, the row didn't find a matches.
       If right_anti_check(function, right_mark);
       ctx->Consume(function);
-    } else if (GetJoinPlan().GetLogicalJoinType() == planner::LogicalJoinType::RIGHT_SEMI) {
+    } else if (join_type == planner::LogicalJoinType::RIGHT_SEMI) {
       // If the right mark is unset, then there is at least one match.
       If right_semi_check(function, !right_mark);
       ctx->Consume(function);
+    } else if (is_right_outer) {
+      // If the right mark is still set, the row didn't find a match. Pass it
+      // along with a NULL-padded build row.
+      If right_outer_check(function, right_mark);
+      {
+        const auto child_schema = GetPlan().GetChild(0)->GetOutputSchema();
+        for (uint32_t attr_idx = 0; attr_idx < child_schema->NumColumns(); attr_idx++) {
+          const auto &type = child_schema->GetColumn(attr_idx).GetType();
+          auto &null_val = null_build_row_.emplace_back(codegen_, "null_build_val",
+                                                        codegen_->GetTPLType(type.GetTypeId()));
+          function->Append(edsl::Declare(null_val));
+          function->Append(edsl::InitSqlNull(null_val));
+        }
+        outer_ctx.Consume(function);
+        null_build_row_.clear();
+      }
     }
   } else {
     Loop entry_loop(
@@ -215,7 +245,8 @@ void HashJoinTranslator::ProbeJoinHashTable(ConsumerContext *ctx, FunctionBuilde
   }
 }
 
-void HashJoinTranslator::CheckJoinPredicate(ConsumerContext *ctx, FunctionBuilder *function) const {
+void HashJoinTranslator::CheckJoinPredicate(ConsumerContext *ctx, FunctionBuilder *function,
+                                            const edsl::Variable<bool> *right_mark) const {
   const auto process = [&](const edsl::Value<bool> &condition) {
     If check_condition(function, condition);
     {  // Valid tuple, pass to next pipeline operator.
@@ -223,6 +254,9 @@ void HashJoinTranslator::CheckJoinPredicate(ConsumerContext *ctx, FunctionBuilde
         storage_.WritePrimitive(*build_row_, build_mark_index_,
                                 edsl::Literal<bool>(codegen_, false));
       }
+      if (right_mark != nullptr) {
+        function->Append(edsl::Assign(*right_mark, false));
+      }
       ctx->Consume(function);
     }
   };
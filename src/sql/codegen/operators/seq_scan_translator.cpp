@@ -98,8 +98,20 @@ void SeqScanTranslator::GenerateFilterClauseFunctions(const planner::AbstractExp
   {
     auto vector_proj = builder.GetParameterByPosition(0).As<ast::x::VectorProjection *>();
     auto tid_list = builder.GetParameterByPosition(1).As<ast::x::TupleIdList *>();
-    if (planner::ExpressionUtil::IsColumnCompareWithConst(*predicate) &&
-        !planner::ExpressionUtil::IsLikeComparison(*predicate)) {
+    if (planner::ExpressionUtil::IsColumnBetweenConsts(*predicate)) {
+      // col BETWEEN lo AND hi is filtered as (col >= lo) followed by (col <= hi).
+      auto cve = static_cast<const planner::ColumnValueExpression *>(predicate->GetChild(0));
+      auto lo = GetCompilationContext()->LookupTranslator(*predicate->GetChild(1));
+      auto hi = GetCompilationContext()->LookupTranslator(*predicate->GetChild(2));
+      builder.Append(edsl::VPIFilter(vector_proj, planner::ComparisonKind::GREATER_THAN_OR_EQUAL_TO,
+                                     cve->GetColumnOid(), lo->DeriveValue(nullptr, nullptr),
+                                     tid_list));
+      builder.Append(edsl::VPIFilter(vector_proj, planner::ComparisonKind::LESS_THAN_OR_EQUAL_TO,
+                                     cve->GetColumnOid(), hi->DeriveValue(nullptr, nullptr),
+                                     tid_list));
+    } else if (planner::ExpressionUtil::IsColumnCompareWithConst(*predicate) &&
+               !planner::ExpressionUtil::IsLikeComparison(*predicate) &&
+               !planner::ExpressionUtil::IsBetweenComparison(*predicate)) {
       auto cmp = static_cast<const planner::ComparisonExpression *>(predicate);
       auto cve = static_cast<const planner::ColumnValueExpression *>(predicate->GetChild(0));
       auto translator = GetCompilationContext()->LookupTranslator(*predicate->GetChild(1));
@@ -1,5 +1,6 @@
 #include "sql/codegen/operators/sort_translator.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "sql/codegen/compilation_context.h"
@@ -8,7 +9,9 @@
 #include "sql/codegen/function_builder.h"
 #include "sql/codegen/if.h"
 #include "sql/codegen/loop.h"
+#include "sql/planner/cardinality_estimator.h"
 #include "sql/planner/plannodes/order_by_plan_node.h"
+#include "sql/sorter.h"
 
 namespace tpl::sql::codegen {
 
@@ -110,6 +113,18 @@ void SortTranslator::DefineStructsAndFunctions() {
 
 void SortTranslator::InitializeQueryState(FunctionBuilder *function) const {
   auto sorter = GetQueryStateEntryPtr(global_sorter_);
+
+  // Reserve room for all rows when statistics can estimate them. Parallel sorts collect rows into
+  // thread-local sorters, so the global sorter is left as is.
+  const auto num_rows = planner::CardinalityEstimator::EstimateOutputRows(GetPlan());
+  if (!build_pipeline_.IsParallel() && num_rows) {
+    const auto expected_rows =
+        static_cast<uint32_t>(std::min<uint64_t>(*num_rows, Sorter::kMaxPresizedTupleCount));
+    function->Append(sorter->Init(GetMemoryPool(), compare_func_, row_struct_.GetSize(),
+                                  edsl::Literal<uint32_t>(codegen_, expected_rows)));
+    return;
+  }
+
   function->Append(sorter->Init(GetMemoryPool(), compare_func_, row_struct_.GetSize()));
 }
 
@@ -11,6 +11,8 @@
 #include "sql/codegen/codegen.h"
 #include "sql/codegen/compilation_context.h"
 #include "sql/codegen/consumer_context.h"
+#include "sql/codegen/edsl/arithmetic_ops.h"
+#include "sql/codegen/edsl/ops.h"
 #include "sql/codegen/function_builder.h"
 #include "sql/codegen/operators/operator_translator.h"
 #include "sql/codegen/pipeline_driver.h"
@@ -67,6 +69,59 @@ edsl::ValueVT PipelineContext::AccessCurrentThreadState() const {
   return edsl::PtrCast(state_.GetPointerToType(), tls_container->AccessCurrentThreadState());
 }
 
+void PipelineContext::DeclareProfileCounters() {
+  if (!pipeline_.GetCompilationContext()->IsProfiling()) {
+    return;
+  }
+  for (auto iter = pipeline_.Begin(), end = pipeline_.End(); iter != end; ++iter) {
+    if (!pipeline_.IsLastOperator(**iter)) {
+      const auto name = fmt::format("profile_tuples{}", tuple_counters_.size());
+      tuple_counters_.emplace_back(*iter, state_.DeclareStateEntry<uint64_t>(name));
+    }
+  }
+  morsel_counter_ = state_.DeclareStateEntry<uint64_t>("profile_morsels");
+}
+
+void PipelineContext::InitializeProfileCounters(FunctionBuilder *function) const {
+  if (!pipeline_.GetCompilationContext()->IsProfiling()) {
+    return;
+  }
+  for (const auto &[_, slot] : tuple_counters_) {
+    function->Append(edsl::Assign(GetStateEntry(slot), edsl::Literal(codegen_, 0ul)));
+  }
+  function->Append(edsl::Assign(GetStateEntry(morsel_counter_), edsl::Literal(codegen_, 0ul)));
+}
+
+void PipelineContext::RecordProfileCounters(FunctionBuilder *function) const {
+  if (!pipeline_.GetCompilationContext()->IsProfiling()) {
+    return;
+  }
+  auto compilation_ctx = pipeline_.GetCompilationContext();
+  auto exec_ctx = compilation_ctx->GetExecutionContextPtrFromQueryState();
+  for (const auto &[op, slot] : tuple_counters_) {
+    const auto operator_id = compilation_ctx->GetOperatorId(op->GetPlan());
+    function->Append(exec_ctx->RecordTuples(operator_id, GetStateEntry(slot)));
+  }
+  function->Append(exec_ctx->RecordMorsels(pipeline_.GetId(), GetStateEntry(morsel_counter_)));
+}
+
+void PipelineContext::CountTuple(const OperatorTranslator &op, FunctionBuilder *function) const {
+  const auto iter = std::ranges::find_if(tuple_counters_, [&](const auto &counter) {
+    return counter.first == &op;
+  });
+  if (iter != tuple_counters_.end()) {
+    auto count = GetStateEntry(iter->second);
+    function->Append(edsl::Assign(count, count + 1ul));
+  }
+}
+
+void PipelineContext::CountMorsel(FunctionBuilder *function) const {
+  if (pipeline_.GetCompilationContext()->IsProfiling()) {
+    auto count = GetStateEntry(morsel_counter_);
+    function->Append(edsl::Assign(count, count + 1ul));
+  }
+}
+
 std::vector<std::pair<ast::Identifier, ast::Type *>> PipelineContext::PipelineParams() const {
   auto query_params = pipeline_.GetCompilationContext()->QueryParams();
   query_params.emplace_back(state_var_, state_.GetPointerToType());
@@ -172,6 +227,7 @@ ast::FunctionDeclaration *Pipeline::GenerateSetupPipelineStateFunction(
     for (auto op : operators_) {
       op->InitializePipelineState(*pipeline_ctx, &builder);
     }
+    pipeline_ctx->InitializeProfileCounters(&builder);
   }
   return builder.Finish();
 }
@@ -182,6 +238,7 @@ ast::FunctionDeclaration *Pipeline::GenerateTearDownPipelineStateFunction(
   FunctionBuilder builder(codegen_, name, pipeline_ctx->PipelineParams(),
                           codegen_->GetType<void>());
   {
+    pipeline_ctx->RecordProfileCounters(&builder);
     for (auto op : operators_) {
       op->TearDownPipelineState(*pipeline_ctx, &builder);
     }
@@ -252,6 +309,7 @@ void Pipeline::DeclarePipelineState(PipelineContext *pipeline_ctx) const {
   for (auto op : operators_) {
     op->DeclarePipelineState(pipeline_ctx);
   }
+  pipeline_ctx->DeclareProfileCounters();
   pipeline_ctx->ConstructPipelineStateType();
 }
 
@@ -306,6 +364,8 @@ void Pipeline::LaunchInternal(
     FunctionBuilder builder(codegen_, worker_name, std::move(pipeline_params),
                             codegen_->GetType<void>());
     {
+      // Count the morsel, if profiling.
+      pipeline_ctx.CountMorsel(&builder);
       // Main pipeline logic.
       ConsumerContext context(compilation_ctx_, pipeline_ctx);
       (*Begin())->Consume(&context, &builder);
@@ -22,7 +22,7 @@ bool ColumnVectorIterator::Advance() noexcept {
   uint32_t next_elem_offset = next_block_pos_ * col_info_->GetStorageSize();
 
   col_data_ = const_cast<byte *>(column_->AccessRaw(next_elem_offset));
-  col_null_bitmap_ = const_cast<uint32_t *>(column_->AccessRawNullBitmap(0));
+  col_null_bitmap_ = GetNullBitmapAt(next_block_pos_);
 
   current_block_pos_ = next_block_pos_;
   next_block_pos_ = std::min(column_->GetTupleCount(), current_block_pos_ + kDefaultVectorSize);
@@ -30,13 +30,23 @@ bool ColumnVectorIterator::Advance() noexcept {
   return true;
 }
 
+uint32_t *ColumnVectorIterator::GetNullBitmapAt(const uint32_t block_pos) const noexcept {
+  // Segments without NULLs don't need their bitmap read at all.
+  if (!column_->HasNulls()) {
+    return nullptr;
+  }
+  TPL_ASSERT(block_pos % util::BitUtil::kBitWordSize == 0, "Vectors must start at a word boundary");
+  const uint32_t word_pos = block_pos / util::BitUtil::kBitWordSize;
+  return const_cast<uint32_t *>(column_->AccessRawNullBitmap(word_pos));
+}
+
 void ColumnVectorIterator::Reset(const ColumnSegment *column) noexcept {
   TPL_ASSERT(column != nullptr, "Cannot reset iterator with NULL block");
   column_ = column;
 
   // Setup the column data and null data pointers
   col_data_ = const_cast<byte *>(column->AccessRaw(0));
-  col_null_bitmap_ = const_cast<uint32_t *>(column->AccessRawNullBitmap(0));
+  col_null_bitmap_ = GetNullBitmapAt(0);
 
   // Setup the current position (0) and the next position (the minimum of the length of the column
   // or one vector's length of data)
@@ -0,0 +1,721 @@
+#include "sql/fused_vector_expression.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+
+#include "spdlog/fmt/fmt.h"
+
+#include "common/exception.h"
+#include "sql/generic_value.h"
+#include "sql/planner/expressions/binary_expression.h"
+#include "sql/planner/expressions/case_expression.h"
+#include "sql/planner/expressions/column_value_expression.h"
+#include "sql/planner/expressions/comparison_expression.h"
+#include "sql/planner/expressions/conjunction_expression.h"
+#include "sql/planner/expressions/constant_value_expression.h"
+#include "sql/tuple_id_list.h"
+#include "sql/vector.h"
+#include "sql/vector_projection.h"
+
+namespace tpl::sql {
+
+namespace {
+
+// Divide 'a' by a non-zero 'b'. Integer division of the smallest value by -1
+// overflows; it wraps around to the smallest value instead.
+template <typename T>
+T Divide(const T a, const T b) {
+  if constexpr (std::is_integral_v<T>) {
+    using U = std::make_unsigned_t<T>;
+    return b == T(-1) ? static_cast<T>(U(0) - static_cast<U>(a)) : a / b;
+  } else {
+    return a / b;
+  }
+}
+
+}  // namespace
+
+template <typename T>
+T FusedVectorExpression::Apply(const OpCode op, const T a, const T b) {
+  switch (op) {
+    case OpCode::Add:
+      return a + b;
+    case OpCode::Sub:
+      return a - b;
+    case OpCode::Mul:
+      return a * b;
+    case OpCode::Div:
+      return b == T(0) ? T(0) : Divide(a, b);
+    case OpCode::Equal:
+      return T(a == b);
+    case OpCode::NotEqual:
+      return T(a != b);
+    case OpCode::LessThan:
+      return T(a < b);
+    case OpCode::LessThanEqual:
+      return T(a <= b);
+    case OpCode::GreaterThan:
+      return T(a > b);
+    case OpCode::GreaterThanEqual:
+      return T(a >= b);
+    case OpCode::And:
+      return T((a != T(0)) & (b != T(0)));
+    default:
+      UNREACHABLE("Loads, fills and casts have no binary form");
+  }
+}
+
+// ---------------------------------------------------------
+// Compiler
+// ---------------------------------------------------------
+
+/**
+ * Compiles a planner expression tree into the register program of a FusedVectorExpression.
+ * Registers are allocated by depth: a node evaluates into register 'r', its left child into 'r'
+ * and its right child into 'r+1'. Constants are folded into the operations that use them.
+ *
+ * Each node is computed in the type of its own inputs: BigInt if they're all integral, and Double
+ * otherwise. An integral child of a floating-point node is cast into the floating-point register
+ * file at the child's register, which is free at that point.
+ *
+ * CASE expressions have no program. Each WHEN and THEN is compiled into its own expression. THEN
+ * and ELSE results keep their own types, and are converted to the CASE's type when stored.
+ */
+class FusedExpressionCompiler {
+  using Operand = FusedVectorExpression::Operand;
+  using OpCode = FusedVectorExpression::OpCode;
+  using Instruction = FusedVectorExpression::Instruction;
+
+  // A generated value, and its type.
+  struct Value {
+    Operand operand;
+    TypeId type;
+  };
+
+ public:
+  explicit FusedExpressionCompiler(FusedVectorExpression *target) : target_(target) {}
+
+  void Compile(const planner::AbstractExpression &expr) {
+    if (expr.GetExpressionType() == planner::ExpressionType::CASE) {
+      CompileCase(static_cast<const planner::CaseExpression &>(expr));
+      return;
+    }
+    target_->is_predicate_ = IsPredicateNode(expr);
+    Validate(expr, target_->is_predicate_);
+    const Value result = Generate(expr, 0);
+    target_->compute_type_ = result.type;
+    if (result.operand.is_constant) {
+      Emit(Instruction{OpCode::Fill, result.type, 0, 0, result.operand, {}});
+    }
+  }
+
+ private:
+  void CompileCase(const planner::CaseExpression &expr) {
+    target_->is_case_ = true;
+    for (std::size_t i = 0; i < expr.GetWhenClauseSize(); i++) {
+      target_->case_clauses_.push_back({CompileBranch(*expr.GetWhenClauseCondition(i), true),
+                                        CompileBranch(*expr.GetWhenClauseResult(i), false)});
+    }
+    if (const auto default_expr = expr.GetDefaultClause(); default_expr != nullptr) {
+      target_->case_default_ = CompileBranch(*default_expr, false);
+    }
+
+    // The CASE is floating-point if any result is.
+    const auto is_floating = [](const auto &branch) {
+      return branch != nullptr && branch->GetResultType() == TypeId::Double;
+    };
+    const bool any_floating =
+        is_floating(target_->case_default_) ||
+        std::any_of(target_->case_clauses_.begin(), target_->case_clauses_.end(),
+                    [&](const auto &clause) { return is_floating(clause.then); });
+    target_->compute_type_ = any_floating ? TypeId::Double : TypeId::BigInt;
+  }
+
+  std::unique_ptr<FusedVectorExpression> CompileBranch(const planner::AbstractExpression &expr,
+                                                       const bool expect_predicate) {
+    std::unique_ptr<FusedVectorExpression> branch(new FusedVectorExpression(target_->col_types_));
+    FusedExpressionCompiler(branch.get()).Compile(expr);
+    if (branch->IsPredicate() != expect_predicate) {
+      throw NotImplementedException(expect_predicate ? "CASE conditions must be predicates"
+                                                     : "CASE results must be arithmetic");
+    }
+    return branch;
+  }
+
+ private:
+  static bool IsPredicateNode(const planner::AbstractExpression &expr) {
+    return expr.GetExpressionType() == planner::ExpressionType::COMPARISON ||
+           expr.GetExpressionType() == planner::ExpressionType::CONJUNCTION;
+  }
+
+  static bool IsSupportedType(TypeId type) {
+    return IsTypeNumeric(type) && type != TypeId::HugeInt;
+  }
+
+  // Check that the expression is supported, and collect the referenced columns.
+  void Validate(const planner::AbstractExpression &expr, const bool expect_predicate) {
+    if (IsPredicateNode(expr) != expect_predicate) {
+      throw NotImplementedException(
+          "Fused expressions cannot mix predicates and arithmetic in the same operand");
+    }
+    switch (expr.GetExpressionType()) {
+      case planner::ExpressionType::COLUMN_VALUE: {
+        const auto &cve = static_cast<const planner::ColumnValueExpression &>(expr);
+        const uint32_t col_idx = cve.GetColumnOid();
+        if (col_idx >= target_->col_types_.size()) {
+          throw Exception(ExceptionType::Index, "Fused expression references unknown column");
+        }
+        const auto type = target_->col_types_[col_idx];
+        if (!IsSupportedType(type)) {
+          throw NotImplementedException(fmt::format(
+              "Fusing expressions over {} columns is not supported", TypeIdToString(type)));
+        }
+        auto &cols = target_->referenced_cols_;
+        if (std::find(cols.begin(), cols.end(), col_idx) == cols.end()) {
+          cols.push_back(col_idx);
+        }
+        break;
+      }
+      case planner::ExpressionType::CONSTANT: {
+        const auto &val = static_cast<const planner::ConstantValueExpression &>(expr).GetValue();
+        if (val.IsNull() || !IsSupportedType(val.GetTypeId())) {
+          throw NotImplementedException(
+              "Fused expressions support only non-NULL numeric constants");
+        }
+        break;
+      }
+      case planner::ExpressionType::BINARY_OPERATOR: {
+        const auto op = static_cast<const planner::BinaryExpression &>(expr).GetOp();
+        if (op != KnownOperator::Add && op != KnownOperator::Sub && op != KnownOperator::Mul &&
+            op != KnownOperator::Div) {
+          throw NotImplementedException("Fused expressions support only +, -, * and /");
+        }
+        Validate(*expr.GetChild(0), false);
+        Validate(*expr.GetChild(1), false);
+        break;
+      }
+      case planner::ExpressionType::COMPARISON: {
+        const auto kind = static_cast<const planner::ComparisonExpression &>(expr).GetKind();
+        if (kind > planner::ComparisonKind::GREATER_THAN_OR_EQUAL_TO) {
+          throw NotImplementedException("Fused expressions support only simple comparisons");
+        }
+        Validate(*expr.GetChild(0), false);
+        Validate(*expr.GetChild(1), false);
+        break;
+      }
+      case planner::ExpressionType::CONJUNCTION: {
+        const auto kind = static_cast<const planner::ConjunctionExpression &>(expr).GetKind();
+        if (kind != planner::ConjunctionKind::AND) {
+          throw NotImplementedException("Fused expressions support only AND conjunctions");
+        }
+        for (uint32_t i = 0; i < expr.NumChildren(); i++) {
+          Validate(*expr.GetChild(i), true);
+        }
+        break;
+      }
+      default:
+        throw NotImplementedException("Unsupported node in fused expression");
+    }
+  }
+
+  // Generate code evaluating the expression into register 'reg'.
+  Value Generate(const planner::AbstractExpression &expr, const uint16_t reg) {
+    switch (expr.GetExpressionType()) {
+      case planner::ExpressionType::COLUMN_VALUE: {
+        const auto &cve = static_cast<const planner::ColumnValueExpression &>(expr);
+        const uint32_t col_idx = cve.GetColumnOid();
+        const TypeId type =
+            IsTypeFloatingPoint(target_->col_types_[col_idx]) ? TypeId::Double : TypeId::BigInt;
+        Emit(Instruction{OpCode::Load, type, reg, col_idx, {}, {}});
+        return Value{Register(reg), type};
+      }
+      case planner::ExpressionType::CONSTANT: {
+        const auto &val = static_cast<const planner::ConstantValueExpression &>(expr).GetValue();
+        return Value{Constant(val),
+                     IsTypeFloatingPoint(val.GetTypeId()) ? TypeId::Double : TypeId::BigInt};
+      }
+      case planner::ExpressionType::BINARY_OPERATOR: {
+        const auto op = static_cast<const planner::BinaryExpression &>(expr).GetOp();
+        return GenerateBinary(ArithmeticOpCode(op), expr, reg);
+      }
+      case planner::ExpressionType::COMPARISON: {
+        const auto kind = static_cast<const planner::ComparisonExpression &>(expr).GetKind();
+        return GenerateBinary(ComparisonOpCode(kind), expr, reg);
+      }
+      case planner::ExpressionType::CONJUNCTION: {
+        Value result = Generate(*expr.GetChild(0), reg);
+        for (uint32_t i = 1; i < expr.NumChildren(); i++) {
+          const auto rhs = Generate(*expr.GetChild(i), result.operand.is_constant ? reg : reg + 1);
+          result = EmitOrFold(OpCode::And, TypeId::BigInt, reg, result.operand, rhs.operand);
+        }
+        return result;
+      }
+      default:
+        UNREACHABLE("Expression was validated");
+    }
+  }
+
+  Value GenerateBinary(OpCode op, const planner::AbstractExpression &expr, const uint16_t reg) {
+    const auto lhs = Generate(*expr.GetChild(0), reg);
+    const auto rhs = Generate(*expr.GetChild(1), lhs.operand.is_constant ? reg : reg + 1);
+    const TypeId type =
+        lhs.type == TypeId::Double || rhs.type == TypeId::Double ? TypeId::Double : TypeId::BigInt;
+    return EmitOrFold(op, type, reg, Convert(lhs, type), Convert(rhs, type));
+  }
+
+  // Convert the value to the given type, if it isn't of that type already.
+  Operand Convert(const Value &value, const TypeId type) {
+    // Constants carry both representations.
+    if (value.type == type || value.operand.is_constant) {
+      return value.operand;
+    }
+    TPL_ASSERT(type == TypeId::Double, "Only integers are converted, into floating-point");
+    const uint16_t reg = value.operand.reg;
+    Emit(Instruction{OpCode::Cast, TypeId::Double, reg, 0, value.operand, {}});
+    return Register(reg);
+  }
+
+  // Emit 'dst = lhs <op> rhs' computed in 'type', or fold it if both inputs are constant.
+  Value EmitOrFold(OpCode op, const TypeId type, const uint16_t dst, const Operand &lhs,
+                   const Operand &rhs) {
+    const bool is_double = type == TypeId::Double;
+    const bool is_arithmetic =
+        op == OpCode::Add || op == OpCode::Sub || op == OpCode::Mul || op == OpCode::Div;
+    const TypeId result_type = is_arithmetic ? type : TypeId::BigInt;
+    // Division by a constant zero is NULL, which constants can't represent. It's left to the
+    // program, with a constant dividend filled into a register first.
+    const bool is_null = op == OpCode::Div && rhs.is_constant &&
+                         (is_double ? rhs.double_val == 0.0 : rhs.int_val == 0);
+    if (is_null && lhs.is_constant) {
+      Emit(Instruction{OpCode::Fill, type, dst, 0, lhs, {}});
+      Emit(Instruction{op, type, dst, 0, Register(dst), rhs});
+      return Value{Register(dst), result_type};
+    }
+    if (lhs.is_constant && rhs.is_constant) {
+      Operand result{true, 0, 0, 0.0};
+      if (is_double) {
+        result.double_val = FusedVectorExpression::Apply(op, lhs.double_val, rhs.double_val);
+        result.int_val = static_cast<int64_t>(result.double_val);
+      } else {
+        result.int_val = FusedVectorExpression::Apply(op, lhs.int_val, rhs.int_val);
+        result.double_val = static_cast<double>(result.int_val);
+      }
+      return Value{result, result_type};
+    }
+    Emit(Instruction{op, type, dst, 0, lhs, rhs});
+    return Value{Register(dst), result_type};
+  }
+
+  void Emit(const Instruction &instruction) {
+    target_->num_registers_ = std::max<uint16_t>(target_->num_registers_, instruction.dst + 1);
+    target_->program_.push_back(instruction);
+  }
+
+  static Operand Register(const uint16_t reg) { return Operand{false, reg, 0, 0.0}; }
+
+  static Operand Constant(const GenericValue &val) {
+    switch (val.GetTypeId()) {
+      case TypeId::TinyInt:
+        return IntegerConstant(val.value_.tinyint);
+      case TypeId::SmallInt:
+        return IntegerConstant(val.value_.smallint);
+      case TypeId::Integer:
+        return IntegerConstant(val.value_.integer);
+      case TypeId::BigInt:
+        return IntegerConstant(val.value_.bigint);
+      case TypeId::Float:
+        return Operand{true, 0, static_cast<int64_t>(val.value_.float_), val.value_.float_};
+      case TypeId::Double:
+        return Operand{true, 0, static_cast<int64_t>(val.value_.double_), val.value_.double_};
+      default:
+        UNREACHABLE("Constant was validated");
+    }
+  }
+
+  static Operand IntegerConstant(const int64_t val) {
+    return Operand{true, 0, val, static_cast<double>(val)};
+  }
+
+  static OpCode ArithmeticOpCode(KnownOperator op) {
+    switch (op) {
+      case KnownOperator::Add:
+        return OpCode::Add;
+      case KnownOperator::Sub:
+        return OpCode::Sub;
+      case KnownOperator::Mul:
+        return OpCode::Mul;
+      case KnownOperator::Div:
+        return OpCode::Div;
+      default:
+        UNREACHABLE("Operator was validated");
+    }
+  }
+
+  static OpCode ComparisonOpCode(planner::ComparisonKind kind) {
+    switch (kind) {
+      case planner::ComparisonKind::EQUAL:
+        return OpCode::Equal;
+      case planner::ComparisonKind::NOT_EQUAL:
+        return OpCode::NotEqual;
+      case planner::ComparisonKind::LESS_THAN:
+        return OpCode::LessThan;
+      case planner::ComparisonKind::LESS_THAN_OR_EQUAL_TO:
+        return OpCode::LessThanEqual;
+      case planner::ComparisonKind::GREATER_THAN:
+        return OpCode::GreaterThan;
+      case planner::ComparisonKind::GREATER_THAN_OR_EQUAL_TO:
+        return OpCode::GreaterThanEqual;
+      default:
+        UNREACHABLE("Comparison was validated");
+    }
+  }
+
+ private:
+  // The expression being compiled.
+  FusedVectorExpression *target_;
+};
+
+// ---------------------------------------------------------
+// Fused Vector Expression
+// ---------------------------------------------------------
+
+FusedVectorExpression::FusedVectorExpression(std::vector<TypeId> col_types)
+    : col_types_(std::move(col_types)),
+      num_registers_(0),
+      compute_type_(TypeId::BigInt),
+      is_predicate_(false),
+      is_case_(false) {}
+
+std::unique_ptr<FusedVectorExpression> FusedVectorExpression::Compile(
+    const planner::AbstractExpression &expr, const std::vector<TypeId> &col_types) {
+  std::unique_ptr<FusedVectorExpression> result(new FusedVectorExpression(col_types));
+  FusedExpressionCompiler(result.get()).Compile(expr);
+  return result;
+}
+
+namespace {
+
+// Gather the values of column 'col' at the given TIDs into 'dst', converting to T.
+template <typename T, typename ColType>
+void Gather(const Vector &col, const sel_t *RESTRICT tids, const uint32_t n, T *RESTRICT dst) {
+  const auto *RESTRICT data = reinterpret_cast<const ColType *>(col.GetData());
+  for (uint32_t j = 0; j < n; j++) {
+    dst[j] = static_cast<T>(data[tids[j]]);
+  }
+}
+
+template <typename T>
+void Load(const Vector &col, const sel_t *tids, const uint32_t n, T *dst) {
+  switch (col.GetTypeId()) {
+    case TypeId::TinyInt:
+      Gather<T, int8_t>(col, tids, n, dst);
+      break;
+    case TypeId::SmallInt:
+      Gather<T, int16_t>(col, tids, n, dst);
+      break;
+    case TypeId::Integer:
+      Gather<T, int32_t>(col, tids, n, dst);
+      break;
+    case TypeId::BigInt:
+      Gather<T, int64_t>(col, tids, n, dst);
+      break;
+    case TypeId::Float:
+      Gather<T, float>(col, tids, n, dst);
+      break;
+    case TypeId::Double:
+      Gather<T, double>(col, tids, n, dst);
+      break;
+    default:
+      throw TypeMismatchException(col.GetTypeId(), GetTypeId<T>(),
+                                  "fused expression input doesn't match compiled column type");
+  }
+}
+
+}  // namespace
+
+template <typename T>
+void FusedVectorExpression::Execute(const Instruction &instr,
+                                    const VectorProjection &vector_projection, const sel_t *tids,
+                                    const uint32_t n, int64_t *int_registers,
+                                    double *double_registers, uint8_t *invalid) {
+  const auto registers = [&](auto type_tag, const uint16_t reg) {
+    using U = decltype(type_tag);
+    if constexpr (std::is_same_v<U, double>) {
+      return &double_registers[reg * kChunkSize];
+    } else {
+      return &int_registers[reg * kChunkSize];
+    }
+  };
+
+  switch (instr.op) {
+    case OpCode::Load:
+      Load(*vector_projection.GetColumn(instr.col_idx), tids, n, registers(T{}, instr.dst));
+      return;
+    case OpCode::Fill: {
+      T *dst = registers(T{}, instr.dst);
+      std::fill(dst, dst + n, ConstantValue<T>(instr.lhs));
+      return;
+    }
+    case OpCode::Cast: {
+      const int64_t *src = registers(int64_t{}, instr.lhs.reg);
+      T *dst = registers(T{}, instr.dst);
+      for (uint32_t j = 0; j < n; j++) dst[j] = static_cast<T>(src[j]);
+      return;
+    }
+    default:
+      break;
+  }
+
+  // Operands are computed in T. Registers may be overwritten in place, so there's no RESTRICT.
+  const T *lhs = instr.lhs.is_constant ? nullptr : registers(T{}, instr.lhs.reg);
+  const T *rhs = instr.rhs.is_constant ? nullptr : registers(T{}, instr.rhs.reg);
+  const T lhs_val = ConstantValue<T>(instr.lhs);
+  const T rhs_val = ConstantValue<T>(instr.rhs);
+
+  // Division by zero produces NULL.
+  if (instr.op == OpCode::Div && rhs != nullptr) {
+    for (uint32_t j = 0; j < n; j++) {
+      invalid[j] |= rhs[j] == T(0);
+    }
+  } else if (instr.op == OpCode::Div && rhs_val == T(0)) {
+    std::fill(invalid, invalid + n, uint8_t{1});
+  }
+
+  // Each operation is a tight loop over the chunk, specialized on the operand kinds. Arithmetic
+  // writes T, while comparisons and conjunctions write integer truth values.
+  const auto execute = [&](auto op) {
+    auto *dst = registers(decltype(op(T{}, T{})){}, instr.dst);
+    if (lhs == nullptr) {
+      for (uint32_t j = 0; j < n; j++) dst[j] = op(lhs_val, rhs[j]);
+    } else if (rhs == nullptr) {
+      for (uint32_t j = 0; j < n; j++) dst[j] = op(lhs[j], rhs_val);
+    } else {
+      for (uint32_t j = 0; j < n; j++) dst[j] = op(lhs[j], rhs[j]);
+    }
+  };
+
+  switch (instr.op) {
+    case OpCode::Add:
+      execute([](T a, T b) { return a + b; });
+      break;
+    case OpCode::Sub:
+      execute([](T a, T b) { return a - b; });
+      break;
+    case OpCode::Mul:
+      execute([](T a, T b) { return a * b; });
+      break;
+    case OpCode::Div:
+      execute([](T a, T b) { return Divide(a, b == T(0) ? T(1) : b); });
+      break;
+    case OpCode::Equal:
+      execute([](T a, T b) { return int64_t(a == b); });
+      break;
+    case OpCode::NotEqual:
+      execute([](T a, T b) { return int64_t(a != b); });
+      break;
+    case OpCode::LessThan:
+      execute([](T a, T b) { return int64_t(a < b); });
+      break;
+    case OpCode::LessThanEqual:
+      execute([](T a, T b) { return int64_t(a <= b); });
+      break;
+    case OpCode::GreaterThan:
+      execute([](T a, T b) { return int64_t(a > b); });
+      break;
+    case OpCode::GreaterThanEqual:
+      execute([](T a, T b) { return int64_t(a >= b); });
+      break;
+    case OpCode::And:
+      execute([](T a, T b) { return int64_t((a != T(0)) & (b != T(0))); });
+      break;
+    default:
+      UNREACHABLE("Impossible operation");
+  }
+}
+
+template <typename T, typename F>
+void FusedVectorExpression::Run(const VectorProjection &vector_projection, const sel_t *tids,
+                                const uint32_t num_tids, F &&consumer) const {
+  // Scratch registers of both types, and a per-lane flag marking division by zero.
+  std::vector<int64_t> int_registers(std::size_t{num_registers_} * kChunkSize);
+  std::vector<double> double_registers(std::size_t{num_registers_} * kChunkSize);
+  std::array<uint8_t, kChunkSize> invalid;
+
+  for (uint32_t start = 0; start < num_tids; start += kChunkSize) {
+    const uint32_t n = std::min(kChunkSize, num_tids - start);
+    const sel_t *chunk_tids = tids + start;
+    invalid.fill(0);
+
+    for (const auto &instr : program_) {
+      if (instr.type == TypeId::Double) {
+        Execute<double>(instr, vector_projection, chunk_tids, n, int_registers.data(),
+                        double_registers.data(), invalid.data());
+      } else {
+        Execute<int64_t>(instr, vector_projection, chunk_tids, n, int_registers.data(),
+                         double_registers.data(), invalid.data());
+      }
+    }
+
+    // The result of the program is always in the first register of its type.
+    if constexpr (std::is_same_v<T, double>) {
+      consumer(chunk_tids, n, double_registers.data(), invalid.data());
+    } else {
+      consumer(chunk_tids, n, int_registers.data(), invalid.data());
+    }
+  }
+}
+
+namespace {
+
+// Collect the TIDs in the given list, or all TIDs if there's no list.
+uint32_t CollectTids(const TupleIdList *tid_list, const uint32_t num_tuples, sel_t *tids) {
+  if (tid_list != nullptr) {
+    return tid_list->ToSelectionVector(tids);
+  }
+  std::iota(tids, tids + num_tuples, sel_t{0});
+  return num_tuples;
+}
+
+}  // namespace
+
+void FusedVectorExpression::Evaluate(const VectorProjection &vector_projection,
+                                     Vector *result) const {
+  TPL_ASSERT(!IsPredicate(), "Predicates must be evaluated through Select()");
+  if (result->GetTypeId() != compute_type_) {
+    throw TypeMismatchException(result->GetTypeId(), compute_type_,
+                                "fused expression result vector has the wrong type");
+  }
+
+  const TupleIdList *filter = vector_projection.GetFilteredTupleIdList();
+  result->Resize(vector_projection.GetTotalTupleCount());
+  result->SetFilteredTupleIdList(filter, vector_projection.GetSelectedTupleCount());
+  result->GetMutableNullMask()->Reset();
+
+  sel_t tids[kDefaultVectorSize];
+  const uint32_t num_tids = CollectTids(filter, vector_projection.GetTotalTupleCount(), tids);
+  EvaluateInto(vector_projection, tids, num_tids, result);
+}
+
+void FusedVectorExpression::EvaluateInto(const VectorProjection &vector_projection,
+                                         const sel_t *tids, const uint32_t num_tids,
+                                         Vector *result) const {
+  if (is_case_) {
+    EvaluateCase(vector_projection, tids, num_tids, result);
+    return;
+  }
+
+  // A NULL in any input produces a NULL.
+  auto *null_mask = result->GetMutableNullMask();
+  for (const auto col_idx : referenced_cols_) {
+    const Vector *input = vector_projection.GetColumn(col_idx);
+    if (input->HasNoNulls() || !input->GetNullMask().Any()) {
+      continue;
+    }
+    const auto &input_nulls = input->GetNullMask();
+    for (uint32_t i = 0; i < num_tids; i++) {
+      if (input_nulls.Test(tids[i])) null_mask->Set(tids[i]);
+    }
+  }
+
+  // Values are computed in this expression's type, and stored in the result's. The results of a
+  // CASE may be of a narrower type than the CASE itself.
+  const auto write = [&](auto type_tag, auto *data) {
+    using T = decltype(type_tag);
+    using ResultType = std::remove_pointer_t<decltype(data)>;
+    Run<T>(vector_projection, tids, num_tids,
+           [&](const sel_t *chunk_tids, uint32_t n, const T *values, const uint8_t *invalid) {
+             for (uint32_t j = 0; j < n; j++) {
+               data[chunk_tids[j]] = static_cast<ResultType>(values[j]);
+             }
+             for (uint32_t j = 0; j < n; j++) {
+               if (invalid[j]) null_mask->Set(chunk_tids[j]);
+             }
+           });
+  };
+  const auto write_as = [&](auto type_tag) {
+    if (result->GetTypeId() == TypeId::Double) {
+      write(type_tag, reinterpret_cast<double *>(result->GetData()));
+    } else {
+      write(type_tag, reinterpret_cast<int64_t *>(result->GetData()));
+    }
+  };
+
+  if (compute_type_ == TypeId::Double) {
+    TPL_ASSERT(result->GetTypeId() == TypeId::Double, "Floating-point results can't be narrowed");
+    write_as(double{});
+  } else {
+    write_as(int64_t{});
+  }
+}
+
+void FusedVectorExpression::EvaluateCase(const VectorProjection &vector_projection,
+                                         const sel_t *tids, const uint32_t num_tids,
+                                         Vector *result) const {
+  // The TIDs not matched by any clause so far, and the TIDs matching the current clause.
+  TupleIdList remaining(vector_projection.GetTotalTupleCount());
+  TupleIdList matches(vector_projection.GetTotalTupleCount());
+  remaining.BuildFromSelectionVector(tids, num_tids);
+
+  sel_t branch_tids[kDefaultVectorSize];
+  for (const auto &[when, then] : case_clauses_) {
+    if (remaining.IsEmpty()) {
+      return;
+    }
+    matches.AssignFrom(remaining);
+    when->Select(vector_projection, &matches);
+    if (!matches.IsEmpty()) {
+      then->EvaluateInto(vector_projection, branch_tids, matches.ToSelectionVector(branch_tids),
+                         result);
+      remaining.UnsetFrom(matches);
+    }
+  }
+
+  // Whatever is left gets the ELSE result, or NULL if there isn't one.
+  const uint32_t num_remaining = remaining.ToSelectionVector(branch_tids);
+  if (case_default_ != nullptr) {
+    case_default_->EvaluateInto(vector_projection, branch_tids, num_remaining, result);
+  } else {
+    auto *null_mask = result->GetMutableNullMask();
+    for (uint32_t i = 0; i < num_remaining; i++) {
+      null_mask->Set(branch_tids[i]);
+    }
+  }
+}
+
+void FusedVectorExpression::Select(const VectorProjection &vector_projection,
+                                   TupleIdList *tid_list) const {
+  TPL_ASSERT(IsPredicate(), "Arithmetic expressions must be evaluated through Evaluate()");
+
+  // Tuples with a NULL in any input never qualify.
+  const bool has_nulls =
+      std::any_of(referenced_cols_.begin(), referenced_cols_.end(), [&](const uint32_t col_idx) {
+        return vector_projection.GetColumn(col_idx)->GetNullMask().Any();
+      });
+  Vector::NullMask nulls(has_nulls ? vector_projection.GetTotalTupleCount() : 0);
+  for (const auto col_idx : referenced_cols_) {
+    if (has_nulls) nulls.Union(vector_projection.GetColumn(col_idx)->GetNullMask());
+  }
+
+  sel_t tids[kDefaultVectorSize];
+  const uint32_t num_tids = tid_list->ToSelectionVector(tids);
+
+  const auto filter = [&](auto type_tag) {
+    using T = decltype(type_tag);
+    Run<T>(vector_projection, tids, num_tids,
+           [&](const sel_t *chunk_tids, uint32_t n, const T *values, const uint8_t *invalid) {
+             for (uint32_t j = 0; j < n; j++) {
+               const auto tid = chunk_tids[j];
+               if (values[j] == T(0) || invalid[j] || (has_nulls && nulls.Test(tid))) {
+                 tid_list->Remove(tid);
+               }
+             }
+           });
+  };
+
+  // Truth values are always integers.
+  filter(int64_t{});
+}
+
+}  // namespace tpl::sql
@@ -43,6 +43,8 @@ bool GenericValue::Equals(const GenericValue &other) const {
       return util::MathUtil::ApproxEqual(value_.double_, other.value_.double_);
     case TypeId::Date:
       return value_.date_ == other.value_.date_;
+    case TypeId::Timestamp:
+      return value_.timestamp_ == other.value_.timestamp_;
     case TypeId::Varchar:
       return str_value_ == other.str_value_;
     default:
@@ -52,6 +54,42 @@ bool GenericValue::Equals(const GenericValue &other) const {
   return false;
 }
 
+bool GenericValue::LessThan(const GenericValue &other) const {
+  TPL_ASSERT(type_id_ == other.type_id_, "Generic values must have the same type");
+  if (is_null_ || other.is_null_) {
+    return is_null_ && !other.is_null_;
+  }
+  switch (type_id_) {
+    case TypeId::Boolean:
+      return value_.boolean < other.value_.boolean;
+    case TypeId::TinyInt:
+      return value_.tinyint < other.value_.tinyint;
+    case TypeId::SmallInt:
+      return value_.smallint < other.value_.smallint;
+    case TypeId::Integer:
+      return value_.integer < other.value_.integer;
+    case TypeId::BigInt:
+      return value_.bigint < other.value_.bigint;
+    case TypeId::Hash:
+      return value_.hash < other.value_.hash;
+    case TypeId::Pointer:
+      return value_.pointer < other.value_.pointer;
+    case TypeId::Float:
+      return value_.float_ < other.value_.float_;
+    case TypeId::Double:
+      return value_.double_ < other.value_.double_;
+    case TypeId::Date:
+      return value_.date_ < other.value_.date_;
+    case TypeId::Timestamp:
+      return value_.timestamp_ < other.value_.timestamp_;
+    case TypeId::Varchar:
+      return str_value_ < other.str_value_;
+    default:
+      throw NotImplementedException(
+          fmt::format("Ordering of '{}' generic value is unsupported", TypeIdToString(type_id_)));
+  }
+}
+
 GenericValue GenericValue::CastTo(TypeId type) {
   // Copy if same type
   if (type_id_ == type) {
@@ -1,5 +1,8 @@
 #include "sql/operators/cast_operators.h"
 
+#include <cstring>
+#include <string>
+
 #include "util/fast_double_parser.h"
 
 namespace tpl::sql {
@@ -13,7 +16,18 @@ bool TryCast<VarlenEntry, float>::operator()(const VarlenEntry &input, float *ou
 }
 
 bool TryCast<VarlenEntry, double>::operator()(const VarlenEntry &input, double *output) const {
-  const auto buf = reinterpret_cast<const char *>(input.GetContent());
+  // The parser reads until the first character that can't belong to a number, but the content of
+  // a varlen isn't terminated. Inlined varlens in particular are followed by garbage. Parse from a
+  // terminated copy on the stack instead; numbers are short, so this is cheap.
+  constexpr std::size_t kMaxLength = 63;
+  char buf[kMaxLength + 1];
+  const auto size = input.GetSize();
+  if (TPL_UNLIKELY(size > kMaxLength)) {
+    const std::string str(input.GetStringView());
+    return util::fast_double_parser::parse_number(str.c_str(), output);
+  }
+  std::memcpy(buf, input.GetContent(), size);
+  buf[size] = '\0';
   return util::fast_double_parser::parse_number(buf, output);
 }
 
@@ -0,0 +1,188 @@
+#include "sql/planner/cardinality_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sql/catalog.h"
+#include "sql/planner/expressions/column_value_expression.h"
+#include "sql/planner/expressions/comparison_expression.h"
+#include "sql/planner/expressions/conjunction_expression.h"
+#include "sql/planner/expressions/constant_value_expression.h"
+#include "sql/planner/expressions/derived_value_expression.h"
+#include "sql/planner/expressions/expression_util.h"
+#include "sql/planner/plannodes/aggregate_plan_node.h"
+#include "sql/planner/plannodes/limit_plan_node.h"
+#include "sql/planner/plannodes/order_by_plan_node.h"
+#include "sql/planner/plannodes/output_schema.h"
+#include "sql/planner/plannodes/seq_scan_plan_node.h"
+#include "sql/table_statistics.h"
+
+namespace tpl::sql::planner {
+
+namespace {
+
+const TableStatistics *LookupStatistics(const SeqScanPlanNode &scan) {
+  return Catalog::Instance()->LookupTableStatisticsById(scan.GetTableOid());
+}
+
+// Estimate the fraction of rows in the scanned table that satisfy the predicate. Only comparisons
+// between a column and a constant of the column's type are estimated; all others are assumed to
+// select every row.
+double EstimateSelectivity(const TableStatistics &stats, const AbstractExpression &predicate) {
+  if (predicate.Is<ExpressionType::CONJUNCTION>()) {
+    const double lhs = EstimateSelectivity(stats, *predicate.GetChild(0));
+    const double rhs = EstimateSelectivity(stats, *predicate.GetChild(1));
+    const auto kind = static_cast<const ConjunctionExpression &>(predicate).GetKind();
+    return kind == ConjunctionKind::AND ? lhs * rhs : std::min(1.0, lhs + rhs);
+  }
+
+  if (!ExpressionUtil::IsColumnCompareWithConst(predicate)) {
+    return 1.0;
+  }
+
+  const auto column = static_cast<const ColumnValueExpression *>(predicate.GetChild(0));
+  const auto constant = static_cast<const ConstantValueExpression *>(predicate.GetChild(1));
+  const auto &value = constant->GetValue();
+  const auto &col_stats = stats.GetColumnStatistics(column->GetColumnOid());
+  if (col_stats.GetMin().IsNull() || value.GetTypeId() != col_stats.GetMin().GetTypeId()) {
+    return 1.0;
+  }
+
+  const double eq = col_stats.EstimateEqualSelectivity(value);
+  const double lt = col_stats.EstimateLessThanSelectivity(value);
+  const double non_null = 1.0 - col_stats.GetNullFraction();
+  switch (static_cast<const ComparisonExpression &>(predicate).GetKind()) {
+    case ComparisonKind::EQUAL:
+      return eq;
+    case ComparisonKind::NOT_EQUAL:
+      return std::max(0.0, non_null - eq);
+    case ComparisonKind::LESS_THAN:
+      return lt;
+    case ComparisonKind::LESS_THAN_OR_EQUAL_TO:
+      return std::min(non_null, lt + eq);
+    case ComparisonKind::GREATER_THAN:
+      return std::max(0.0, non_null - lt - eq);
+    case ComparisonKind::GREATER_THAN_OR_EQUAL_TO:
+      return std::max(0.0, non_null - lt);
+    default:
+      return 1.0;
+  }
+}
+
+}  // namespace
+
+std::optional<uint64_t> CardinalityEstimator::EstimateOutputRows(const AbstractPlanNode &plan) {
+  switch (plan.GetPlanNodeType()) {
+    case PlanNodeType::SEQSCAN: {
+      const auto &scan = static_cast<const SeqScanPlanNode &>(plan);
+      const auto stats = LookupStatistics(scan);
+      if (stats == nullptr) {
+        return std::nullopt;
+      }
+      double selectivity = 1.0;
+      if (const auto predicate = scan.GetScanPredicate(); predicate != nullptr) {
+        selectivity = EstimateSelectivity(*stats, *predicate);
+      }
+      return static_cast<uint64_t>(std::ceil(stats->GetRowCount() * selectivity));
+    }
+    case PlanNodeType::AGGREGATE: {
+      return EstimateGroupCount(plan);
+    }
+    case PlanNodeType::HASHJOIN: {
+      // Assume a foreign-key join: every probe row finds exactly one match.
+      return EstimateOutputRows(*plan.GetChild(1));
+    }
+    case PlanNodeType::NESTLOOP: {
+      const auto outer = EstimateOutputRows(*plan.GetChild(0));
+      const auto inner = EstimateOutputRows(*plan.GetChild(1));
+      if (!outer || !inner) {
+        return std::nullopt;
+      }
+      return *outer * *inner;
+    }
+    case PlanNodeType::LIMIT: {
+      const auto &limit = static_cast<const LimitPlanNode &>(plan);
+      const auto child_rows = EstimateOutputRows(*plan.GetChild(0));
+      return std::min<uint64_t>(child_rows.value_or(limit.GetLimit()), limit.GetLimit());
+    }
+    case PlanNodeType::ORDERBY: {
+      const auto &order_by = static_cast<const OrderByPlanNode &>(plan);
+      const auto child_rows = EstimateOutputRows(*plan.GetChild(0));
+      if (!order_by.HasLimit()) {
+        return child_rows;
+      }
+      return std::min<uint64_t>(child_rows.value_or(order_by.GetLimit()), order_by.GetLimit());
+    }
+    case PlanNodeType::PROJECTION: {
+      return EstimateOutputRows(*plan.GetChild(0));
+    }
+    default: {
+      return std::nullopt;
+    }
+  }
+}
+
+std::optional<uint64_t> CardinalityEstimator::EstimateDistinctValues(
+    const AbstractPlanNode &plan, const AbstractExpression &expr) {
+  if (expr.Is<ExpressionType::COLUMN_VALUE>()) {
+    // Columns read directly from an analyzed table.
+    if (plan.GetPlanNodeType() != PlanNodeType::SEQSCAN) {
+      return std::nullopt;
+    }
+    const auto stats = LookupStatistics(static_cast<const SeqScanPlanNode &>(plan));
+    if (stats == nullptr) {
+      return std::nullopt;
+    }
+    // A filtered column can't take more distinct values than there are rows.
+    const auto col_oid = static_cast<const ColumnValueExpression &>(expr).GetColumnOid();
+    const auto distinct = stats->GetColumnStatistics(col_oid).GetDistinctCount();
+    return std::min(distinct, std::max(EstimateOutputRows(plan).value_or(distinct), uint64_t{1}));
+  }
+
+  if (expr.Is<ExpressionType::DERIVED_VALUE>()) {
+    // Attributes of a child, traced through the expression that produces them.
+    const auto &derived = static_cast<const DerivedValueExpression &>(expr);
+    const auto &child = *plan.GetChild(derived.GetTupleIdx());
+    const auto child_expr = child.GetOutputSchema()->GetColumn(derived.GetValueIdx()).GetExpr();
+    if (child.GetPlanNodeType() != PlanNodeType::AGGREGATE) {
+      return EstimateDistinctValues(child, *child_expr);
+    }
+    // The outputs of an aggregation reference its grouping keys (tuple 0) or aggregates (tuple 1).
+    // Grouping keys are themselves evaluated in the context of the aggregation.
+    if (!child_expr->Is<ExpressionType::DERIVED_VALUE>()) {
+      return std::nullopt;
+    }
+    const auto &agg = static_cast<const AggregatePlanNode &>(child);
+    const auto &agg_derived = static_cast<const DerivedValueExpression &>(*child_expr);
+    if (agg_derived.GetTupleIdx() != 0) {
+      return std::nullopt;
+    }
+    return EstimateDistinctValues(agg, *agg.GetGroupByTerms()[agg_derived.GetValueIdx()]);
+  }
+
+  return std::nullopt;
+}
+
+std::optional<uint64_t> CardinalityEstimator::EstimateGroupCount(const AbstractPlanNode &plan) {
+  TPL_ASSERT(plan.GetPlanNodeType() == PlanNodeType::AGGREGATE, "Plan is not an aggregation");
+  const auto &agg = static_cast<const AggregatePlanNode &>(plan);
+  if (agg.GetGroupByTerms().empty()) {
+    return 1;
+  }
+
+  const auto child_rows = EstimateOutputRows(*agg.GetChild(0));
+
+  // Assume grouping keys are independent. The number of groups is the product of the distinct
+  // counts of each key, but no more than the number of input rows.
+  uint64_t groups = 1;
+  for (const auto term : agg.GetGroupByTerms()) {
+    const auto distinct = EstimateDistinctValues(agg, *term);
+    if (!distinct) {
+      return child_rows;
+    }
+    groups = child_rows ? std::min(groups * *distinct, *child_rows) : groups * *distinct;
+  }
+  return groups;
+}
+
+}  // namespace tpl::sql::planner
@@ -22,4 +22,15 @@ bool ExpressionUtil::IsLikeComparison(const AbstractExpression &expr) {
   return cmp.GetKind() == ComparisonKind::LIKE || cmp.GetKind() == ComparisonKind::NOT_LIKE;
 }
 
+bool ExpressionUtil::IsBetweenComparison(const AbstractExpression &expr) {
+  return expr.Is<ExpressionType::COMPARISON>() &&
+         static_cast<const ComparisonExpression &>(expr).GetKind() == ComparisonKind::BETWEEN;
+}
+
+bool ExpressionUtil::IsColumnBetweenConsts(const AbstractExpression &expr) {
+  return IsBetweenComparison(expr) && expr.GetChild(0)->Is<ExpressionType::COLUMN_VALUE>() &&
+         expr.GetChild(1)->Is<ExpressionType::CONSTANT>() &&
+         expr.GetChild(2)->Is<ExpressionType::CONSTANT>();
+}
+
 }  // namespace tpl::sql::planner
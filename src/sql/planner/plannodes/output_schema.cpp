@@ -1,13 +1,16 @@
 #include "sql/planner/plannodes/output_schema.h"
 
+#include "spdlog/fmt/fmt.h"
+
+#include "common/exception.h"
 #include "sql/value.h"
 
 namespace tpl::sql::planner {
 
 namespace {
 
-std::pair<std::size_t, std::size_t> GetTypeSizeAndAlignment(SqlTypeId type) {
-  switch (type) {
+std::pair<std::size_t, std::size_t> GetTypeSizeAndAlignment(const Type &type) {
+  switch (type.GetTypeId()) {
     case SqlTypeId::Boolean:
       return {sizeof(BoolVal), alignof(BoolVal)};
     case SqlTypeId::TinyInt:
@@ -17,8 +20,14 @@ std::pair<std::size_t, std::size_t> GetTypeSizeAndAlignment(SqlTypeId type) {
       return {sizeof(Integer), alignof(Integer)};
     case SqlTypeId::Real:
     case SqlTypeId::Double:
-    case SqlTypeId::Decimal:
       return {sizeof(Real), alignof(Real)};
+    case SqlTypeId::Decimal:
+      // Wider decimals are stored in 128-bit integers, which have no SQL value type.
+      if (type.GetPrecision() > Decimal64::kMaxPrecision) {
+        throw NotImplementedException(fmt::format("{} columns aren't supported in output",
+                                                  type.ToStringWithoutNullability()));
+      }
+      return {sizeof(DecimalVal), alignof(DecimalVal)};
     case SqlTypeId::Date:
       return {sizeof(DateVal), alignof(DateVal)};
     case SqlTypeId::Timestamp:
@@ -40,8 +49,7 @@ OutputSchema::OutputSchema(std::vector<Column> columns) : columns_(std::move(col
   std::size_t offset = 0;
   // Compute offset for each column.
   for (std::size_t i = 0; i < columns_.size(); i++) {
-    const auto sql_type_id = columns_[i].GetType().GetTypeId();
-    const auto [size, align] = GetTypeSizeAndAlignment(sql_type_id);
+    const auto [size, align] = GetTypeSizeAndAlignment(columns_[i].GetType());
     if (i != 0) {
       offset = util::MathUtil::AlignTo(offset, align);
     }
@@ -60,8 +68,7 @@ const std::vector<OutputSchema::Column> &OutputSchema::GetColumns() const { retu
 const std::vector<std::size_t> &OutputSchema::GetColumnOffsets() const { return column_offsets_; }
 
 std::size_t OutputSchema::ComputeOutputRowSize() const {
-  const auto sql_type_id = columns_.back().GetType().GetTypeId();
-  const auto [size, align] = GetTypeSizeAndAlignment(sql_type_id);
+  const auto [size, align] = GetTypeSizeAndAlignment(columns_.back().GetType());
   return column_offsets_.back() + size;
 }
 
@@ -39,8 +39,7 @@ void PrintingConsumer::PrintTuple(const byte *const tuple) const {
         break;
       }
       case SqlTypeId::Real:
-      case SqlTypeId::Double:
-      case SqlTypeId::Decimal: {
+      case SqlTypeId::Double: {
         const auto val = reinterpret_cast<const Real *>(col_ptr);
         if (val->is_null) {
           os_ << "NULL";
@@ -49,6 +48,12 @@ void PrintingConsumer::PrintTuple(const byte *const tuple) const {
         }
         break;
       }
+      case SqlTypeId::Decimal: {
+        // The output schema only admits decimals that fit in 64 bits.
+        const auto val = reinterpret_cast<const DecimalVal *>(col_ptr);
+        os_ << (val->is_null ? "NULL" : val->val.ToString(cols[i].GetType().GetScale()));
+        break;
+      }
       case SqlTypeId::Date: {
         const auto val = reinterpret_cast<const DateVal *>(col_ptr);
         os_ << (val->is_null ? "NULL" : val->val.ToString());
@@ -0,0 +1,57 @@
+#include "sql/query_profile.h"
+
+namespace tpl::sql {
+
+QueryProfile::QueryProfile(uint32_t num_operators, uint32_t num_pipelines)
+    : operator_tuples_(num_operators, 0), pipelines_(num_pipelines) {}
+
+void QueryProfile::RecordTuples(uint32_t operator_id, uint64_t num_tuples) {
+  TPL_ASSERT(operator_id < operator_tuples_.size(), "Invalid operator ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  operator_tuples_[operator_id] += num_tuples;
+}
+
+void QueryProfile::RecordMorsels(uint32_t pipeline_id, uint64_t num_morsels) {
+  TPL_ASSERT(pipeline_id < pipelines_.size(), "Invalid pipeline ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  pipelines_[pipeline_id].thread_morsels.push_back(num_morsels);
+}
+
+void QueryProfile::RecordPipelineTime(uint32_t pipeline_id, double ms) {
+  TPL_ASSERT(pipeline_id < pipelines_.size(), "Invalid pipeline ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  pipelines_[pipeline_id].time_ms += ms;
+}
+
+void QueryProfile::RecordPipelineCounters(uint32_t pipeline_id,
+                                          const util::PerfCounters::Sample &counters) {
+  TPL_ASSERT(pipeline_id < pipelines_.size(), "Invalid pipeline ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  pipelines_[pipeline_id].counters += counters;
+}
+
+uint64_t QueryProfile::GetNumTuples(uint32_t operator_id) const {
+  TPL_ASSERT(operator_id < operator_tuples_.size(), "Invalid operator ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  return operator_tuples_[operator_id];
+}
+
+double QueryProfile::GetPipelineTime(uint32_t pipeline_id) const {
+  TPL_ASSERT(pipeline_id < pipelines_.size(), "Invalid pipeline ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pipelines_[pipeline_id].time_ms;
+}
+
+std::vector<uint64_t> QueryProfile::GetMorselsPerThread(uint32_t pipeline_id) const {
+  TPL_ASSERT(pipeline_id < pipelines_.size(), "Invalid pipeline ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pipelines_[pipeline_id].thread_morsels;
+}
+
+util::PerfCounters::Sample QueryProfile::GetPipelineCounters(uint32_t pipeline_id) const {
+  TPL_ASSERT(pipeline_id < pipelines_.size(), "Invalid pipeline ID");
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pipelines_[pipeline_id].counters;
+}
+
+}  // namespace tpl::sql
@@ -1,6 +1,8 @@
 #include "sql/runtime_types.h"
 
+#include <algorithm>
 #include <array>
+#include <cctype>
 #include <charconv>
 #include <string>
 
@@ -8,6 +10,7 @@
 
 #include "common/exception.h"
 #include "sql/sql.h"
+#include "util/arithmetic_overflow.h"
 
 namespace tpl::sql {
 
@@ -402,6 +405,17 @@ Date Date::FromString(const char *str, std::size_t len) {
   while (ptr != limit && std::isspace(*ptr)) ptr++;
   while (ptr != limit && std::isspace(*(limit - 1))) limit--;
 
+  // Fast path for the common fixed-format YYYY-MM-DD.
+  if (limit - ptr == 10 && ptr[4] == '-' && ptr[7] == '-') {
+    const auto y0 = static_cast<uint8_t>(ptr[0] - '0'), y1 = static_cast<uint8_t>(ptr[1] - '0');
+    const auto y2 = static_cast<uint8_t>(ptr[2] - '0'), y3 = static_cast<uint8_t>(ptr[3] - '0');
+    const auto m0 = static_cast<uint8_t>(ptr[5] - '0'), m1 = static_cast<uint8_t>(ptr[6] - '0');
+    const auto d0 = static_cast<uint8_t>(ptr[8] - '0'), d1 = static_cast<uint8_t>(ptr[9] - '0');
+    if (y0 < 10 && y1 < 10 && y2 < 10 && y3 < 10 && m0 < 10 && m1 < 10 && d0 < 10 && d1 < 10) {
+      return Date::FromYMD(y0 * 1000 + y1 * 100 + y2 * 10 + y3, m0 * 10 + m1, d0 * 10 + d1);
+    }
+  }
+
   uint32_t year = 0, month = 0, day = 0;
 
 #define ERROR \
@@ -626,6 +640,117 @@ Timestamp Timestamp::FromString(const char *str, std::size_t len) {
   throw NotImplementedException("Converting strings to timestamps not implemented.");
 }
 
+//===----------------------------------------------------------------------===//
+//
+// Fixed point decimals
+//
+//===----------------------------------------------------------------------===//
+
+template <typename T>
+Decimal<T> Decimal<T>::Rescale(uint32_t from_scale, uint32_t to_scale) const {
+  if (to_scale >= from_scale) {
+    T result;
+    if (to_scale - from_scale > kMaxPrecision ||
+        util::ArithmeticOverflow::Mul<T>(value_, PowerOfTen(to_scale - from_scale), &result)) {
+      throw Exception(ExceptionType::Decimal,
+                      fmt::format("numeric field overflow rescaling {} to scale {}",
+                                  ToString(from_scale), to_scale));
+    }
+    return Decimal<T>(result);
+  }
+
+  if (from_scale - to_scale > kMaxPrecision) {
+    return Decimal<T>(0);
+  }
+  const T divisor = PowerOfTen(from_scale - to_scale);
+  const T quotient = value_ / divisor, remainder = value_ % divisor;
+  if (remainder >= divisor / 2) return Decimal<T>(quotient + 1);
+  if (remainder <= -(divisor / 2)) return Decimal<T>(quotient - 1);
+  return Decimal<T>(quotient);
+}
+
+template <typename T>
+std::string Decimal<T>::ToString(uint32_t scale) const {
+  // Decimals have at most 38 digits, a sign, and a decimal point. Digits are written backwards.
+  std::array<char, 48> buf;
+  auto pos = buf.end();
+  const bool negative = value_ < 0;
+  // Work with negative values to handle the minimum value of the type.
+  T remaining = negative ? value_ : -value_;
+  for (uint32_t digits = 0; remaining != 0 || digits <= scale; digits++) {
+    if (scale != 0 && digits == scale) *--pos = '.';
+    *--pos = static_cast<char>('0' - remaining % 10);
+    remaining /= 10;
+  }
+  if (negative) *--pos = '-';
+  return std::string(pos, buf.end());
+}
+
+template <typename T>
+Decimal<T> Decimal<T>::FromString(std::string_view str, uint32_t precision, uint32_t scale) {
+  TPL_ASSERT(precision <= kMaxPrecision && scale <= precision, "Invalid precision or scale");
+
+  const auto invalid = [&]() {
+    return ConversionException(fmt::format("invalid input syntax for decimal: '{}'", str));
+  };
+
+  auto iter = str.begin(), end = str.end();
+  while (iter != end && std::isspace(static_cast<unsigned char>(*iter))) iter++;
+  while (iter != end && std::isspace(static_cast<unsigned char>(*(end - 1)))) end--;
+
+  bool negative = false;
+  if (iter != end && (*iter == '-' || *iter == '+')) {
+    negative = *iter++ == '-';
+  }
+
+  // Accumulate the integral and up to 'scale' fractional digits. Values are accumulated as
+  // negative numbers to handle the minimum value of the type.
+  T result = 0;
+  uint32_t integral_digits = 0, fractional_digits = 0;
+  bool any_digits = false, round_up = false;
+  for (; iter != end && std::isdigit(static_cast<unsigned char>(*iter)); iter++) {
+    any_digits = true;
+    if (integral_digits == 0 && *iter == '0') continue;
+    if (++integral_digits > precision - scale) {
+      throw Exception(ExceptionType::Decimal,
+                      fmt::format("numeric field overflow: '{}' exceeds decimal({},{})", str,
+                                  precision, scale));
+    }
+    result = result * 10 - (*iter - '0');
+  }
+  if (iter != end && *iter == '.') {
+    for (iter++; iter != end && std::isdigit(static_cast<unsigned char>(*iter)); iter++) {
+      any_digits = true;
+      if (fractional_digits < scale) {
+        result = result * 10 - (*iter - '0');
+        fractional_digits++;
+      } else if (fractional_digits++ == scale) {
+        round_up = *iter >= '5';
+      }
+    }
+  }
+  if (!any_digits || iter != end) {
+    throw invalid();
+  }
+
+  result *= PowerOfTen(scale - std::min(scale, fractional_digits));
+  if (round_up) {
+    result -= 1;
+    if (result <= -PowerOfTen(precision)) {
+      throw Exception(ExceptionType::Decimal,
+                      fmt::format("numeric field overflow: '{}' exceeds decimal({},{})", str,
+                                  precision, scale));
+    }
+  }
+  return Decimal<T>(negative ? result : -result);
+}
+
+template class Decimal<int32_t>;
+template class Decimal<int64_t>;
+template Decimal128 Decimal128::Rescale(uint32_t, uint32_t) const;
+template std::string Decimal128::ToString(uint32_t) const;
+template Decimal128 Decimal128::FromString(std::string_view, uint32_t, uint32_t);
+
 //===----------------------------------------------------------------------===//
 //
 // Varlen Entry
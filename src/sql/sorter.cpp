@@ -14,6 +14,7 @@
 #include "logging/logger.h"
 #include "sql/thread_state_container.h"
 #include "util/stage_timer.h"
+#include "util/trace_recorder.h"
 
 namespace tpl::sql {
 
@@ -31,6 +32,12 @@ Sorter::Sorter(MemoryPool *memory, ComparisonFunction cmp_fn, uint32_t tuple_siz
       tuples_(memory),
       sorted_(false) {}
 
+Sorter::Sorter(MemoryPool *memory, ComparisonFunction cmp_fn, uint32_t tuple_size,
+               uint32_t expected_tuple_count)
+    : Sorter(memory, cmp_fn, tuple_size) {
+  tuples_.reserve(std::min(expected_tuple_count, kMaxPresizedTupleCount));
+}
+
 Sorter::~Sorter() = default;
 
 byte *Sorter::AllocInputTuple() {
@@ -200,7 +207,10 @@ void Sorter::SortParallel(const ThreadStateContainer *thread_state_container,
   util::StageTimer<std::milli> timer;
   timer.EnterStage("Parallel Sort Thread-Local Instances");
 
-  tbb::parallel_for_each(tl_sorters, [](Sorter *sorter) { sorter->Sort(); });
+  tbb::parallel_for_each(tl_sorters, [](Sorter *sorter) {
+    util::TraceScope trace("sort", "SortThreadLocal", "tuples", sorter->GetTupleCount());
+    sorter->Sort();
+  });
 
   timer.ExitStage();
 
@@ -307,6 +317,7 @@ void Sorter::SortParallel(const ThreadStateContainer *thread_state_container,
   };
 
   tbb::parallel_for_each(merge_work, [&heap_cmp](const MergeWork<SeqTypeIter> &work) {
+    util::TraceScope trace("sort", "MergeTask", "inputs", work.input_ranges.size());
     std::priority_queue<MergeWorkType::Range, std::vector<MergeWorkType::Range>, decltype(heap_cmp)>
         heap(heap_cmp, work.input_ranges);
     SeqTypeIter dest = work.destination;
@@ -25,6 +25,8 @@ SqlTypeId GetSqlTypeFromInternalType(TypeId type) {
       return SqlTypeId::Double;
     case TypeId::Date:
       return SqlTypeId::Date;
+    case TypeId::Timestamp:
+      return SqlTypeId::Timestamp;
     case TypeId::Varchar:
       return SqlTypeId::Varchar;
     case TypeId::Varbinary:
@@ -47,6 +49,8 @@ std::size_t GetTypeIdSize(TypeId type) {
       return sizeof(int32_t);
     case TypeId::BigInt:
       return sizeof(int64_t);
+    case TypeId::HugeInt:
+      return sizeof(int128_t);
     case TypeId::Hash:
       return sizeof(hash_t);
     case TypeId::Pointer:
@@ -81,6 +85,8 @@ std::size_t GetTypeIdAlignment(TypeId type) {
       return alignof(int32_t);
     case TypeId::BigInt:
       return alignof(int64_t);
+    case TypeId::HugeInt:
+      return alignof(int128_t);
     case TypeId::Hash:
       return alignof(hash_t);
     case TypeId::Pointer:
@@ -109,6 +115,7 @@ bool IsTypeFixedSize(TypeId type) {
     case TypeId::SmallInt:
     case TypeId::Integer:
     case TypeId::BigInt:
+    case TypeId::HugeInt:
     case TypeId::Hash:
     case TypeId::Pointer:
     case TypeId::Float:
@@ -129,6 +136,7 @@ bool IsTypeIntegral(TypeId type) {
     case TypeId::SmallInt:
     case TypeId::Integer:
     case TypeId::BigInt:
+    case TypeId::HugeInt:
       return true;
     case TypeId::Boolean:
     case TypeId::Hash:
@@ -154,6 +162,7 @@ bool IsTypeFloatingPoint(TypeId type) {
     case TypeId::SmallInt:
     case TypeId::Integer:
     case TypeId::BigInt:
+    case TypeId::HugeInt:
     case TypeId::Hash:
     case TypeId::Pointer:
     case TypeId::Date:
@@ -173,6 +182,7 @@ bool IsTypeNumeric(TypeId type) {
     case TypeId::SmallInt:
     case TypeId::Integer:
     case TypeId::BigInt:
+    case TypeId::HugeInt:
     case TypeId::Hash:
     case TypeId::Pointer:
     case TypeId::Float:
@@ -201,6 +211,8 @@ std::string TypeIdToString(TypeId type) {
       return "Integer";
     case TypeId::BigInt:
       return "BigInt";
+    case TypeId::HugeInt:
+      return "HugeInt";
     case TypeId::Hash:
       return "Hash";
     case TypeId::Pointer:
@@ -211,6 +223,8 @@ std::string TypeIdToString(TypeId type) {
       return "Double";
     case TypeId::Date:
       return "Date";
+    case TypeId::Timestamp:
+      return "Timestamp";
     case TypeId::Varchar:
       return "VarChar";
     case TypeId::Varbinary:
@@ -70,6 +70,11 @@ void DumpColValue(std::ostream &os, Type type, const ColumnSegment &col, uint32_
       os << col.TypedAccessAt<VarlenEntry>(row_idx).GetStringView();
       break;
     case SqlTypeId::Decimal:
+      if (type.GetPrimitiveTypeId() == TypeId::BigInt) {
+        os << col.TypedAccessAt<Decimal64>(row_idx).ToString(type.GetScale());
+      } else {
+        os << col.TypedAccessAt<Decimal128>(row_idx).ToString(type.GetScale());
+      }
       break;
   }
 }
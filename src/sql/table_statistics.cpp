@@ -0,0 +1,283 @@
+#include "sql/table_statistics.h"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// For HLL distinct value estimations.
+#include "count/hll.h"
+
+#include "tbb/parallel_for.h"
+
+#include "sql/runtime_types.h"
+#include "sql/table.h"
+#include "util/hash_util.h"
+
+namespace tpl::sql {
+
+// ---------------------------------------------------------
+// Column Statistics
+// ---------------------------------------------------------
+
+ColumnStatistics::ColumnStatistics(uint64_t num_rows, uint64_t null_count, uint64_t distinct_count,
+                                   GenericValue min, GenericValue max,
+                                   std::vector<GenericValue> histogram_bounds,
+                                   std::vector<ValueFrequency> most_common_values)
+    : num_rows_(num_rows),
+      null_count_(null_count),
+      distinct_count_(distinct_count),
+      min_(std::move(min)),
+      max_(std::move(max)),
+      histogram_bounds_(std::move(histogram_bounds)),
+      most_common_values_(std::move(most_common_values)) {}
+
+double ColumnStatistics::EstimateEqualSelectivity(const GenericValue &value) const {
+  if (value.IsNull() || min_.IsNull() || value < min_ || max_ < value) {
+    return 0.0;
+  }
+
+  // Common values have an exact frequency.
+  double common_fraction = 0.0;
+  for (const auto &[common_value, frequency] : most_common_values_) {
+    if (common_value == value) {
+      return frequency;
+    }
+    common_fraction += frequency;
+  }
+
+  // Otherwise, assume the remaining rows are evenly spread over the remaining distinct values.
+  const double remaining_fraction = std::max(0.0, 1.0 - GetNullFraction() - common_fraction);
+  const uint64_t remaining_distinct =
+      std::max(uint64_t{1}, distinct_count_ - std::min(distinct_count_,
+                                                       uint64_t(most_common_values_.size())));
+  return std::min(1.0, remaining_fraction / remaining_distinct);
+}
+
+double ColumnStatistics::EstimateLessThanSelectivity(const GenericValue &value) const {
+  if (value.IsNull() || min_.IsNull() || !(min_ < value)) {
+    return 0.0;
+  }
+
+  const double non_null_fraction = 1.0 - GetNullFraction();
+  if (max_ < value) {
+    return non_null_fraction;
+  }
+
+  // Without a histogram, assume values are split evenly around the input.
+  if (histogram_bounds_.size() < 2) {
+    return non_null_fraction / 2;
+  }
+
+  // Each bucket holds an equal share of rows. All buckets whose upper bound is below the value
+  // qualify completely; the bucket containing the value is assumed to qualify half-way.
+  const auto num_buckets = histogram_bounds_.size() - 1;
+  const auto pos = std::lower_bound(histogram_bounds_.begin(), histogram_bounds_.end(), value);
+  const auto full_buckets = static_cast<double>(std::distance(histogram_bounds_.begin(), pos)) - 1;
+  return std::clamp((full_buckets + 0.5) / num_buckets, 0.0, 1.0) * non_null_fraction;
+}
+
+// ---------------------------------------------------------
+// Table Statistics
+// ---------------------------------------------------------
+
+namespace {
+
+// Precision of the HLL estimators. Gives a standard error of roughly 1%.
+constexpr int kHLLPrecision = 14;
+
+template <typename T>
+hash_t HashValue(const T &val) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return util::HashUtil::Hash(val);
+  } else {
+    return val.Hash();
+  }
+}
+
+template <typename T>
+GenericValue MakeValue(const T &val) {
+  if constexpr (std::is_same_v<T, bool>) {
+    return GenericValue::CreateBoolean(val);
+  } else if constexpr (std::is_same_v<T, int8_t>) {
+    return GenericValue::CreateTinyInt(val);
+  } else if constexpr (std::is_same_v<T, int16_t>) {
+    return GenericValue::CreateSmallInt(val);
+  } else if constexpr (std::is_same_v<T, int32_t>) {
+    return GenericValue::CreateInteger(val);
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return GenericValue::CreateBigInt(val);
+  } else if constexpr (std::is_same_v<T, float>) {
+    return GenericValue::CreateReal(val);
+  } else if constexpr (std::is_same_v<T, double>) {
+    return GenericValue::CreateDouble(val);
+  } else if constexpr (std::is_same_v<T, Date>) {
+    return GenericValue::CreateDate(val);
+  } else if constexpr (std::is_same_v<T, Timestamp>) {
+    return GenericValue::CreateTimestamp(val);
+  } else {
+    static_assert(std::is_same_v<T, VarlenEntry>, "Unsupported column type");
+    return GenericValue::CreateVarchar(val.GetStringView());
+  }
+}
+
+// Statistics over a single block of a column. Blocks are analyzed in parallel and then merged.
+template <typename T>
+struct BlockStatistics {
+  uint64_t null_count = 0;
+  std::optional<T> min, max;
+  std::unique_ptr<libcount::HLL> estimator;
+  std::vector<T> sample;
+};
+
+// Compute the statistics for the column at index 'col_idx' in the table. Every 'sample_stride'-th
+// row of the table is sampled to build the histogram and common values.
+template <typename T>
+ColumnStatistics ComputeColumnStatistics(const Table &table, const uint32_t col_idx,
+                                         const uint64_t sample_stride) {
+  const auto num_blocks = table.GetBlockCount();
+
+  // The position of the first row of each block in the table, to sample consistently.
+  std::vector<uint64_t> block_offsets(num_blocks);
+  std::transform_exclusive_scan(
+      table.begin(), table.end(), block_offsets.begin(), uint64_t{0}, std::plus<>(),
+      [](const Table::Block &block) { return uint64_t{block.num_tuples()}; });
+
+  std::vector<BlockStatistics<T>> block_stats(num_blocks);
+  tbb::parallel_for(uint32_t{0}, num_blocks, [&](const uint32_t block_idx) {
+    const auto &block = *(table.begin() + block_idx);
+    const auto *column = block.GetColumnData(col_idx);
+    auto &stats = block_stats[block_idx];
+    const bool nullable = column->GetSqlType().IsNullable();
+    stats.estimator = libcount::HLL::Create(kHLLPrecision);
+    for (uint32_t i = 0; i < column->GetTupleCount(); i++) {
+      if (nullable && column->IsNullAt(i)) {
+        stats.null_count++;
+        continue;
+      }
+      const T &val = column->TypedAccessAt<T>(i);
+      if (!stats.min || val < *stats.min) stats.min = val;
+      if (!stats.max || *stats.max < val) stats.max = val;
+      stats.estimator->Update(HashValue(val));
+      if ((block_offsets[block_idx] + i) % sample_stride == 0) {
+        stats.sample.push_back(val);
+      }
+    }
+  });
+
+  // Merge.
+  uint64_t null_count = 0;
+  std::optional<T> min, max;
+  auto estimator = libcount::HLL::Create(kHLLPrecision);
+  std::vector<T> sample;
+  for (const auto &stats : block_stats) {
+    null_count += stats.null_count;
+    if (stats.min && (!min || *stats.min < *min)) min = stats.min;
+    if (stats.max && (!max || *max < *stats.max)) max = stats.max;
+    estimator->Merge(stats.estimator.get());
+    sample.insert(sample.end(), stats.sample.begin(), stats.sample.end());
+  }
+
+  const uint64_t num_rows = table.GetTupleCount();
+  const uint64_t non_null_count = num_rows - null_count;
+  if (non_null_count == 0) {
+    const auto null = GenericValue::CreateNull(GetTypeId<T>());
+    return ColumnStatistics(num_rows, null_count, 0, null, null, {}, {});
+  }
+
+  // The estimate is approximate; keep it within the possible range.
+  const uint64_t distinct_count = std::clamp(estimator->Estimate(), uint64_t{1}, non_null_count);
+
+  std::sort(sample.begin(), sample.end());
+
+  // Equi-depth histogram. The sample is sorted, so bucket boundaries are evenly spaced sample
+  // values. The outer boundaries are the true minimum and maximum.
+  std::vector<GenericValue> histogram_bounds;
+  if (!sample.empty()) {
+    const uint64_t num_buckets =
+        std::min<uint64_t>(ColumnStatistics::kMaxHistogramBuckets, sample.size());
+    histogram_bounds.reserve(num_buckets + 1);
+    histogram_bounds.emplace_back(MakeValue(*min));
+    for (uint64_t i = 1; i < num_buckets; i++) {
+      histogram_bounds.emplace_back(MakeValue<T>(sample[i * (sample.size() - 1) / num_buckets]));
+    }
+    histogram_bounds.emplace_back(MakeValue(*max));
+  }
+
+  // Most common values. Only values that appear noticeably more often than an average value are
+  // considered common.
+  std::vector<std::pair<uint64_t, uint64_t>> runs;  // (count, position in sample)
+  for (auto iter = sample.begin(); iter != sample.end();) {
+    const auto end = std::upper_bound(iter, sample.end(), *iter);
+    runs.emplace_back(std::distance(iter, end), std::distance(sample.begin(), iter));
+    iter = end;
+  }
+  const double avg_count = static_cast<double>(sample.size()) / distinct_count;
+  std::stable_sort(runs.begin(), runs.end(),
+                   [](const auto &a, const auto &b) { return a.first > b.first; });
+  std::vector<ColumnStatistics::ValueFrequency> most_common_values;
+  const double non_null_fraction = static_cast<double>(non_null_count) / num_rows;
+  for (const auto &[count, pos] : runs) {
+    if (most_common_values.size() == ColumnStatistics::kMaxMostCommonValues || count < 2 ||
+        count < avg_count * 1.25) {
+      break;
+    }
+    const double frequency = static_cast<double>(count) / sample.size() * non_null_fraction;
+    most_common_values.emplace_back(MakeValue<T>(sample[pos]), frequency);
+  }
+
+  return ColumnStatistics(num_rows, null_count, distinct_count, MakeValue(*min), MakeValue(*max),
+                          std::move(histogram_bounds), std::move(most_common_values));
+}
+
+}  // namespace
+
+std::unique_ptr<TableStatistics> TableStatistics::Compute(const Table &table) {
+  const uint64_t num_rows = table.GetTupleCount();
+  const uint64_t sample_stride = std::max(uint64_t{1}, num_rows / kTargetSampleSize);
+
+  std::vector<ColumnStatistics> columns;
+  const auto &schema = table.GetSchema();
+  for (uint32_t col_idx = 0; col_idx < schema.GetColumnCount(); col_idx++) {
+    const auto type_id = schema.GetColumnInfo(col_idx)->type.GetPrimitiveTypeId();
+    switch (type_id) {
+#define COMPUTE(TYPE_ID, CPP_TYPE)                                                          \
+  case TypeId::TYPE_ID:                                                                     \
+    columns.emplace_back(ComputeColumnStatistics<CPP_TYPE>(table, col_idx, sample_stride)); \
+    break;
+      COMPUTE(Boolean, bool)
+      COMPUTE(TinyInt, int8_t)
+      COMPUTE(SmallInt, int16_t)
+      COMPUTE(Integer, int32_t)
+      COMPUTE(BigInt, int64_t)
+      COMPUTE(Float, float)
+      COMPUTE(Double, double)
+      COMPUTE(Date, Date)
+      COMPUTE(Timestamp, Timestamp)
+      COMPUTE(Varchar, VarlenEntry)
+#undef COMPUTE
+      default: {
+        // Only count NULLs for types without an ordering. Assume all values are distinct.
+        uint64_t null_count = 0;
+        for (const auto &block : table) {
+          const auto *column = block.GetColumnData(col_idx);
+          for (uint32_t i = 0; column->GetSqlType().IsNullable() && i < column->GetTupleCount();
+               i++) {
+            null_count += column->IsNullAt(i);
+          }
+        }
+        const auto null = GenericValue::CreateNull(type_id);
+        columns.emplace_back(num_rows, null_count, num_rows - null_count, null, null,
+                             std::vector<GenericValue>{},
+                             std::vector<ColumnStatistics::ValueFrequency>{});
+        break;
+      }
+    }
+  }
+
+  return std::make_unique<TableStatistics>(num_rows, std::move(columns));
+}
+
+}  // namespace tpl::sql
@@ -11,6 +11,7 @@
 #include "sql/catalog.h"
 #include "sql/thread_state_container.h"
 #include "util/timer.h"
+#include "util/trace_recorder.h"
 
 namespace tpl::sql {
 
@@ -59,7 +60,7 @@ bool TableVectorIterator::Init() {
   // Collect column metadata for the iterators
   std::vector<const Schema::ColumnInfo *> col_infos(column_indexes_.size());
   for (uint64_t idx = 0; idx < column_indexes_.size(); idx++) {
-    col_infos[idx] = table_schema.GetColumnInfo(idx);
+    col_infos[idx] = table_schema.GetColumnInfo(column_indexes_[idx]);
   }
 
   // Configure the vector projection
@@ -81,8 +82,10 @@ bool TableVectorIterator::Init() {
 }
 
 void TableVectorIterator::RefreshVectorProjection() {
-  // Reset our projection and refresh all columns with new data from the column
-  // iterators.
+  // Reset our projection and point all columns to new data from the column
+  // iterators. Columns are only loaded when first accessed. Thus, filters load
+  // the columns they read first, and the remaining columns are only loaded for
+  // blocks with surviving tuples.
 
   const uint32_t tuple_count = column_iterators_[0].GetTupleCount();
 
@@ -91,11 +94,8 @@ void TableVectorIterator::RefreshVectorProjection() {
              "Not all iterators have the same size?");
 
   vector_projection_.Reset(tuple_count);
-  for (uint64_t col_idx = 0; col_idx < column_iterators_.size(); col_idx++) {
-    Vector *column_vector = vector_projection_.GetColumn(col_idx);
-    column_vector->Reference(column_iterators_[col_idx].GetColumnData(),
-                             column_iterators_[col_idx].GetColumnNullBitmap(),
-                             column_iterators_[col_idx].GetTupleCount());
+  for (uint32_t col_idx = 0; col_idx < column_iterators_.size(); col_idx++) {
+    vector_projection_.DeferColumn(col_idx, &column_iterators_[col_idx]);
   }
   vector_projection_.CheckIntegrity();
 
@@ -138,7 +138,7 @@ bool TableVectorIterator::Advance() {
   if (block_iterator_.Advance()) {
     const Table::Block *block = block_iterator_.GetCurrentBlock();
     for (uint64_t i = 0; i < column_iterators_.size(); i++) {
-      const ColumnSegment *col = block->GetColumnData(i);
+      const ColumnSegment *col = block->GetColumnData(column_indexes_[i]);
       column_iterators_[i].Reset(col);
     }
     RefreshVectorProjection();
@@ -160,6 +160,8 @@ class ScanTask {
         scanner_(scanner) {}
 
   void operator()(const tbb::blocked_range<uint32_t> &block_range) const {
+    util::TraceScope trace("scan", "ParallelScanRange", "first_block", block_range.begin());
+
     // Create the iterator over the specified block range
     TableVectorIterator iter(table_id_, block_range.begin(), block_range.end());
 
@@ -1,7 +1,11 @@
 #include "sql/tablegen/table_generator.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -9,6 +13,8 @@
 
 #include "spdlog/fmt/fmt.h"
 
+#include "tbb/parallel_for.h"
+
 #include "common/exception.h"
 #include "common/memory.h"
 #include "logging/logger.h"
@@ -16,12 +22,16 @@
 #include "sql/schema.h"
 #include "sql/table.h"
 #include "util/bit_util.h"
+#include "util/sfc_gen.h"
 #include "util/timer.h"
 
 namespace tpl::sql::tablegen {
 
 namespace {
 
+// The number of tuples in each table block, whether loaded or generated.
+constexpr uint32_t kBlockSize = 10000;
+
 std::unique_ptr<Schema> MakeSchema(std::initializer_list<Schema::ColumnInfo> cols) {
   return std::make_unique<Schema>(cols);
 }
@@ -37,6 +47,188 @@ Table *CreateTable(Catalog *catalog, const std::string &table_name,
   return catalog->LookupTableByName(table_name);
 }
 
+//===----------------------------------------------------------------------===//
+//
+// Schemas
+//
+//===----------------------------------------------------------------------===//
+
+std::unique_ptr<Schema> TpchCustomerSchema() {
+  return MakeSchema({
+      {"c_custkey", Type::IntegerType(false)},
+      {"c_name", Type::VarcharType(false, 25)},
+      {"c_address", Type::VarcharType(false, 40)},
+      {"c_nationkey", Type::IntegerType(false)},
+      {"c_phone", Type::VarcharType(false, 15)},
+      {"c_acctbal", Type::RealType(false)},
+      {"c_mktsegment", Type::VarcharType(false, 10)},
+      {"c_comment", Type::VarcharType(false, 117)},
+  });
+}
+
+std::unique_ptr<Schema> TpchPartSchema() {
+  return MakeSchema({{"p_partkey", Type::IntegerType(false)},
+                     {"p_name", Type::VarcharType(false, 55)},
+                     {"p_mfgr", Type::VarcharType(false, 25)},
+                     {"p_brand", Type::VarcharType(false, 10)},
+                     {"p_type", Type::VarcharType(false, 25)},
+                     {"p_size", Type::IntegerType(false)},
+                     {"p_container", Type::VarcharType(false, 10)},
+                     {"p_retailprice", Type::RealType(false)},
+                     {"p_comment", Type::VarcharType(false, 23)}});
+}
+
+std::unique_ptr<Schema> TpchSupplierSchema() {
+  return MakeSchema({{"s_suppkey", Type::IntegerType(false)},
+                     {"s_name", Type::VarcharType(false, 25)},
+                     {"s_address", Type::VarcharType(false, 40)},
+                     {"s_nationkey", Type::IntegerType(false)},
+                     {"s_phone", Type::VarcharType(false, 15)},
+                     {"s_acctbal", Type::RealType(false)},
+                     {"s_comment", Type::VarcharType(false, 101)}});
+}
+
+std::unique_ptr<Schema> TpchPartsuppSchema() {
+  return MakeSchema({{"ps_partkey", Type::IntegerType(false)},
+                     {"ps_suppkey", Type::IntegerType(false)},
+                     {"ps_availqty", Type::IntegerType(false)},
+                     {"ps_supplycost", Type::RealType(false)},
+                     {"ps_comment", Type::VarcharType(false, 199)}});
+}
+
+std::unique_ptr<Schema> TpchOrdersSchema() {
+  return MakeSchema({{"o_orderkey", Type::IntegerType(false)},
+                     {"o_custkey", Type::IntegerType(false)},
+                     {"o_orderstatus", Type::VarcharType(false, 1)},
+                     {"o_totalprice", Type::RealType(false)},
+                     {"o_orderdate", Type::Type::DateType(false)},
+                     {"o_orderpriority", Type::VarcharType(false, 15)},
+                     {"o_clerk", Type::VarcharType(false, 15)},
+                     {"o_shippriority", Type::IntegerType(false)},
+                     {"o_comment", Type::VarcharType(false, 79)}});
+}
+
+std::unique_ptr<Schema> TpchLineitemSchema() {
+  return MakeSchema({{"l_orderkey", Type::IntegerType(false)},
+                     {"l_partkey", Type::IntegerType(false)},
+                     {"l_suppkey", Type::IntegerType(false)},
+                     {"l_linenumber", Type::IntegerType(false)},
+                     {"l_quantity", Type::RealType(false)},
+                     {"l_extendedprice", Type::RealType(false)},
+                     {"l_discount", Type::RealType(false)},
+                     {"l_tax", Type::RealType(false)},
+                     {"l_returnflag", Type::VarcharType(false, 1)},
+                     {"l_linestatus", Type::VarcharType(false, 1)},
+                     {"l_shipdate", Type::DateType(false)},
+                     {"l_commitdate", Type::DateType(false)},
+                     {"l_receiptdate", Type::DateType(false)},
+                     {"l_shipinstruct", Type::VarcharType(false, 25)},
+                     {"l_shipmode", Type::VarcharType(false, 10)},
+                     {"l_comment", Type::VarcharType(false, 44)}});
+}
+
+std::unique_ptr<Schema> TpchNationSchema() {
+  return MakeSchema({{"n_nationkey", Type::IntegerType(false)},
+                     {"n_name", Type::VarcharType(false, 25)},
+                     {"n_regionkey", Type::IntegerType(false)},
+                     {"n_comment", Type::VarcharType(false, 152)}});
+}
+
+std::unique_ptr<Schema> TpchRegionSchema() {
+  return MakeSchema({{"r_regionkey", Type::IntegerType(false)},
+                     {"r_name", Type::VarcharType(false, 25)},
+                     {"r_comment", Type::VarcharType(false, 152)}});
+}
+
+std::unique_ptr<Schema> SsbmPartSchema() {
+  return MakeSchema({
+      {"p_partkey", Type::IntegerType(false)},
+      {"p_name", Type::VarcharType(false, 22)},
+      {"p_mfgr", Type::VarcharType(false, 6)},
+      {"p_category", Type::VarcharType(false, 7)},
+      {"p_brand1", Type::VarcharType(false, 9)},
+      {"p_color", Type::VarcharType(false, 11)},
+      {"p_type", Type::VarcharType(false, 25)},
+      {"p_size", Type::IntegerType(false)},
+      {"p_container", Type::VarcharType(false, 10)},
+  });
+}
+
+std::unique_ptr<Schema> SsbmSupplierSchema() {
+  return MakeSchema({
+      {"s_suppkey", Type::IntegerType(false)},
+      {"s_name", Type::VarcharType(false, 25)},
+      {"s_address", Type::VarcharType(false, 25)},
+      {"s_city", Type::VarcharType(false, 10)},
+      {"s_nation", Type::VarcharType(false, 15)},
+      {"s_region", Type::VarcharType(false, 12)},
+      {"s_phone", Type::VarcharType(false, 15)},
+  });
+}
+
+std::unique_ptr<Schema> SsbmCustomerSchema() {
+  return MakeSchema({
+      {"c_custkey", Type::IntegerType(false)},
+      {"c_name", Type::VarcharType(false, 25)},
+      {"c_address", Type::VarcharType(false, 25)},
+      {"c_city", Type::VarcharType(false, 10)},
+      {"c_nation", Type::VarcharType(false, 15)},
+      {"c_region", Type::VarcharType(false, 12)},
+      {"c_phone", Type::VarcharType(false, 15)},
+      {"c_mktsegment", Type::VarcharType(false, 10)},
+  });
+}
+
+std::unique_ptr<Schema> SsbmDateSchema() {
+  return MakeSchema({
+      {"d_datekey", Type::IntegerType(false)},
+      {"d_date", Type::VarcharType(false, 19)},
+      {"d_dayofweek", Type::VarcharType(false, 10)},
+      {"d_month", Type::VarcharType(false, 10)},
+      {"d_year", Type::IntegerType(false)},
+      {"d_yearmonthnum", Type::IntegerType(false)},
+      {"d_yearmonth", Type::VarcharType(false, 8)},
+      {"d_daynuminweek", Type::IntegerType(false)},
+      {"d_daynuminmonth", Type::IntegerType(false)},
+      {"d_daynuminyear", Type::IntegerType(false)},
+      {"d_monthnuminyear", Type::IntegerType(false)},
+      {"d_weeknuminyear", Type::IntegerType(false)},
+      {"d_sellingseason", Type::VarcharType(false, 13)},
+      {"d_lasdayinweekfl", Type::VarcharType(false, 1)},
+      {"d_lastdayinmonthfl", Type::VarcharType(false, 1)},
+      {"d_holidyfl", Type::VarcharType(false, 1)},
+      {"d_weekdayfl", Type::VarcharType(false, 1)},
+  });
+}
+
+std::unique_ptr<Schema> SsbmLineorderSchema() {
+  return MakeSchema({
+      {"lo_orderkey", Type::IntegerType(false)},
+      {"lo_linenumber", Type::IntegerType(false)},
+      {"lo_custkey", Type::IntegerType(false)},
+      {"lo_partkey", Type::IntegerType(false)},
+      {"lo_suppkey", Type::IntegerType(false)},
+      {"lo_orderdate", Type::IntegerType(false)},
+      {"lo_orderpriority", Type::VarcharType(false, 15)},
+      {"lo_shippriority", Type::VarcharType(false, 1)},
+      {"lo_quantity", Type::IntegerType(false)},
+      {"lo_extendedprice", Type::IntegerType(false)},
+      {"lo_ordertotalprice", Type::IntegerType(false)},
+      {"lo_discount", Type::IntegerType(false)},
+      {"lo_revenue", Type::IntegerType(false)},
+      {"lo_supplycost", Type::IntegerType(false)},
+      {"lo_tax", Type::IntegerType(false)},
+      {"lo_commitdate", Type::IntegerType(false)},
+      {"lo_shipmode", Type::VarcharType(false, 10)},
+  });
+}
+
+//===----------------------------------------------------------------------===//
+//
+// CSV Import
+//
+//===----------------------------------------------------------------------===//
+
 // Postgres NULL string
 constexpr const char *kNullString = "\\N";
 
@@ -77,6 +269,18 @@ void ParseCol(byte *data, uint32_t *null_bitmap, const Schema::ColumnInfo &col,
       *reinterpret_cast<double *>(insert_offset) = field.get<double>();
       break;
     }
+    case SqlTypeId::Decimal: {
+      auto val = field.get<std::string_view>();
+      const auto precision = col.type.GetPrecision(), scale = col.type.GetScale();
+      if (col.type.GetPrimitiveTypeId() == TypeId::BigInt) {
+        *reinterpret_cast<Decimal64 *>(insert_offset) =
+            Decimal64::FromString(val, precision, scale);
+      } else {
+        *reinterpret_cast<Decimal128 *>(insert_offset) =
+            Decimal128::FromString(val, precision, scale);
+      }
+      break;
+    }
     case SqlTypeId::Date: {
       auto val = field.get<std::string_view>();
       *reinterpret_cast<Date *>(insert_offset) = Date::FromString(val.data(), val.length());
@@ -109,7 +313,6 @@ void CreateAndAppendBlockToTable(Table *table,
 
 // If table name is 'test_table', look for a file in data_dir/test_table.tbl
 void ImportTable(const std::string &table_name, Table *table, const std::string &data_dir) {
-  const uint32_t kBatchSize = 10000;
   uint32_t total_written = 0, num_vals = 0;
 
   const auto &cols = table->GetSchema().GetColumns();
@@ -129,11 +332,11 @@ void ImportTable(const std::string &table_name, Table *table, const std::string
     if (num_vals == 0) {
       for (const auto &col : table->GetSchema().GetColumns()) {
         byte *data = static_cast<byte *>(
-            Memory::MallocAligned(col.GetStorageSize() * kBatchSize, CACHELINE_SIZE));
+            Memory::MallocAligned(col.GetStorageSize() * kBlockSize, CACHELINE_SIZE));
         uint32_t *nulls = nullptr;
         if (col.type.IsNullable()) {
           nulls = static_cast<uint32_t *>(Memory::MallocAligned(
-              util::BitUtil::Num32BitWordsFor(kBatchSize) * sizeof(uint32_t), CACHELINE_SIZE));
+              util::BitUtil::Num32BitWordsFor(kBlockSize) * sizeof(uint32_t), CACHELINE_SIZE));
         }
         col_data.emplace_back(data, nulls);
       }
@@ -149,7 +352,7 @@ void ImportTable(const std::string &table_name, Table *table, const std::string
     num_vals++;
 
     // If we've reached batch size, construct block and append to table
-    if (num_vals == kBatchSize) {
+    if (num_vals == kBlockSize) {
       CreateAndAppendBlockToTable(table, col_data, num_vals);
       col_data.clear();
       total_written += num_vals;
@@ -169,284 +372,786 @@ void ImportTable(const std::string &table_name, Table *table, const std::string
   LOG_INFO("Loaded '{}' with {} rows ({:.2f} rows/sec)", table_name, total_written, rps);
 }
 
+//===----------------------------------------------------------------------===//
+//
+// Native Generation
+//
+//===----------------------------------------------------------------------===//
+
+/**
+ * Builds table blocks row-by-row directly into column segment buffers. All string data that cannot
+ * be inlined into a VarlenEntry is stored in a heap owned by the builder, which is handed off to
+ * the table along with the blocks. Builders are not thread-safe; each generation task uses its own.
+ */
+class BlockBuilder {
+ public:
+  explicit BlockBuilder(const Schema &schema) : schema_(schema), num_rows_(0) {
+    for (const auto &col : schema_.GetColumns()) {
+      TPL_ASSERT(!col.type.IsNullable(), "Generated columns cannot be nullable");
+      (void)col;
+    }
+    AllocateColumns();
+  }
+
+  DISALLOW_COPY_AND_MOVE(BlockBuilder);
+
+  ~BlockBuilder() {
+    for (byte *col : cols_) std::free(col);
+  }
+
+  // Write the value of the column at the given index in the current row.
+  template <typename T>
+  void Set(uint32_t col_idx, T val) {
+    TPL_ASSERT(schema_.GetColumnInfo(col_idx)->GetStorageSize() == sizeof(T), "Size mismatch");
+    reinterpret_cast<T *>(cols_[col_idx])[num_rows_] = val;
+  }
+
+  // Write the string value of the column at the given index in the current row.
+  void SetString(uint32_t col_idx, std::string_view str) {
+    Set(col_idx, str.size() <= VarlenEntry::GetInlineThreshold()
+                     ? VarlenEntry::Create(str)
+                     : strings_.AddVarlen(str.data(), str.size()));
+  }
+
+  // Complete the current row, sealing the active block if it is full.
+  void FinishRow() {
+    if (++num_rows_ == kBlockSize) {
+      SealBlock();
+    }
+  }
+
+  // Append all completed blocks to the given table, transferring ownership of strings, too.
+  void AppendTo(Table *table) {
+    SealBlock();
+    for (auto &block : blocks_) {
+      table->Insert(std::move(block));
+    }
+    blocks_.clear();
+    table->AdoptStringHeap(std::move(strings_));
+  }
+
+ private:
+  void AllocateColumns() {
+    cols_.clear();
+    for (const auto &col : schema_.GetColumns()) {
+      cols_.push_back(static_cast<byte *>(
+          Memory::MallocAligned(col.GetStorageSize() * kBlockSize, CACHELINE_SIZE)));
+    }
+  }
+
+  void SealBlock() {
+    if (num_rows_ == 0) {
+      return;
+    }
+    std::vector<ColumnSegment> columns;
+    columns.reserve(cols_.size());
+    for (uint32_t i = 0; i < cols_.size(); i++) {
+      columns.emplace_back(schema_.GetColumnInfo(i)->type, cols_[i], nullptr, num_rows_);
+    }
+    blocks_.emplace_back(std::move(columns), num_rows_);
+    num_rows_ = 0;
+    AllocateColumns();
+  }
+
+ private:
+  // The schema of the table being generated.
+  const Schema &schema_;
+  // The column buffers for the active block.
+  std::vector<byte *> cols_;
+  // The number of rows in the active block.
+  uint32_t num_rows_;
+  // All completed blocks.
+  std::vector<Table::Block> blocks_;
+  // Storage for non-inlined strings.
+  VarlenHeap strings_;
+};
+
+/**
+ * A deterministic random stream. Each generation task uses a stream seeded from the table and the
+ * task's chunk index, so generated data is identical regardless of the degree of parallelism.
+ */
+class RandomStream {
+ public:
+  RandomStream(uint64_t table_seed, uint64_t chunk_idx) : gen_(table_seed, chunk_idx, 0x7e1) {}
+
+  // Return a uniformly random integer in the range [lo, hi].
+  int64_t Uniform(int64_t lo, int64_t hi) {
+    TPL_ASSERT(lo <= hi, "Invalid range");
+    return lo + static_cast<int64_t>(gen_() % static_cast<uint64_t>(hi - lo + 1));
+  }
+
+  // Return a uniformly random element from the provided list.
+  template <typename T, std::size_t N>
+  const T &Pick(const std::array<T, N> &list) {
+    return list[gen_() % N];
+  }
+
+  // Return true with the given probability.
+  bool Chance(double probability) {
+    return static_cast<double>(gen_() >> 11) * 0x1.0p-53 < probability;
+  }
+
+  // Fill the buffer with a random string of [min_len, max_len] letters and digits.
+  std::string_view AlphaNumeric(uint32_t min_len, uint32_t max_len, std::string *buf) {
+    static constexpr char kChars[] =
+        "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ,";
+    buf->resize(Uniform(min_len, max_len));
+    for (auto &c : *buf) c = kChars[gen_() % (sizeof(kChars) - 1)];
+    return *buf;
+  }
+
+  // Fill the buffer with [min_len, max_len] characters of random pseudo-text.
+  std::string_view Text(uint32_t min_len, uint32_t max_len, std::string *buf);
+
+ private:
+  util::SFC64 gen_;
+};
+
+// clang-format off
+constexpr std::array<std::string_view, 104> kTextWords = {
+    "furious", "sly", "careful", "blithe", "quick", "fluffy", "slow", "quiet", "ruthless", "thin",
+    "close", "dogged", "daring", "brave", "stealthy", "permanent", "enticing", "idle", "busy",
+    "regular", "final", "ironic", "even", "bold", "silent", "special", "pending", "unusual",
+    "express", "foxes", "ideas", "theodolites", "pinto", "beans", "instructions", "dependencies",
+    "excuses", "platelets", "asymptotes", "courts", "dolphins", "multipliers", "sauternes",
+    "warthogs", "frets", "dinos", "attainments", "somas", "patterns", "forges", "braids",
+    "frays", "warhorses", "dugouts", "epitaphs", "pearls", "tithes", "waters", "orbits", "gifts",
+    "sheaves", "depths", "sentiments", "decoys", "realms", "pains", "grouches", "escapades",
+    "packages", "requests", "accounts", "deposits", "sleep", "wake", "are", "cajole", "haggle",
+    "nag", "use", "boost", "affix", "detect", "integrate", "maintain", "nod", "lose", "solve",
+    "thrash", "promise", "engage", "hinder", "print", "x-ray", "breach", "eat", "grow", "impress",
+    "serve", "about", "above", "across", "after", "along", "among"};
+
+constexpr std::array<std::string_view, 92> kColors = {
+    "almond", "antique", "aquamarine", "azure", "beige", "bisque", "black", "blanched", "blue",
+    "blush", "brown", "burlywood", "burnished", "chartreuse", "chiffon", "chocolate", "coral",
+    "cornflower", "cornsilk", "cream", "cyan", "dark", "deep", "dim", "dodger", "drab",
+    "firebrick", "floral", "forest", "frosted", "gainsboro", "ghost", "goldenrod", "green",
+    "grey", "honeydew", "hot", "indian", "ivory", "khaki", "lace", "lavender", "lawn", "lemon",
+    "light", "lime", "linen", "magenta", "maroon", "medium", "metallic", "midnight", "mint",
+    "misty", "moccasin", "navajo", "navy", "olive", "orange", "orchid", "pale", "papaya", "peach",
+    "peru", "pink", "plum", "powder", "puff", "purple", "red", "rose", "rosy", "royal", "saddle",
+    "salmon", "sandy", "seashell", "sienna", "sky", "slate", "smoke", "snow", "spring", "steel",
+    "tan", "thistle", "tomato", "turquoise", "violet", "wheat", "white", "yellow"};
+
+constexpr std::array<std::string_view, 6> kTypeSyllable1 = {
+    "STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+constexpr std::array<std::string_view, 5> kTypeSyllable2 = {
+    "ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+constexpr std::array<std::string_view, 5> kTypeSyllable3 = {
+    "TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+constexpr std::array<std::string_view, 5> kContainerSyllable1 = {
+    "SM", "LG", "MED", "JUMBO", "WRAP"};
+constexpr std::array<std::string_view, 8> kContainerSyllable2 = {
+    "CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+constexpr std::array<std::string_view, 5> kMarketSegments = {
+    "AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+constexpr std::array<std::string_view, 5> kOrderPriorities = {
+    "1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+constexpr std::array<std::string_view, 4> kShipInstructions = {
+    "DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+constexpr std::array<std::string_view, 7> kShipModes = {
+    "REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+constexpr std::array<std::string_view, 5> kRegions = {
+    "AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+struct NationInfo {
+  std::string_view name;
+  int32_t region_key;
+};
+
+constexpr std::array<NationInfo, 25> kNations = {{
+    {"ALGERIA", 0}, {"ARGENTINA", 1}, {"BRAZIL", 1}, {"CANADA", 1}, {"EGYPT", 4},
+    {"ETHIOPIA", 0}, {"FRANCE", 3}, {"GERMANY", 3}, {"INDIA", 2}, {"INDONESIA", 2},
+    {"IRAN", 4}, {"IRAQ", 4}, {"JAPAN", 2}, {"JORDAN", 4}, {"KENYA", 0},
+    {"MOROCCO", 0}, {"MOZAMBIQUE", 0}, {"PERU", 1}, {"CHINA", 2}, {"ROMANIA", 3},
+    {"SAUDI ARABIA", 4}, {"VIETNAM", 2}, {"RUSSIA", 3}, {"UNITED KINGDOM", 3}, {"UNITED STATES", 1},
+}};
+
+constexpr std::array<std::string_view, 12> kMonthNames = {
+    "January", "February", "March", "April", "May", "June",
+    "July", "August", "September", "October", "November", "December"};
+constexpr std::array<std::string_view, 7> kDayNames = {
+    "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+// clang-format on
+
+std::string_view RandomStream::Text(uint32_t min_len, uint32_t max_len, std::string *buf) {
+  const auto len = static_cast<std::size_t>(Uniform(min_len, max_len));
+  buf->clear();
+  while (buf->size() < len) {
+    if (!buf->empty()) buf->push_back(' ');
+    buf->append(Pick(kTextWords));
+  }
+  buf->resize(len);
+  return *buf;
+}
+
+/**
+ * A calendar of all dates in the TPC-H/SSB date range [1992-01-01, 1998-12-31]. Dates are addressed
+ * by their day offset from the start of the range, making date arithmetic simple index arithmetic.
+ */
+class Calendar {
+ public:
+  // Offset of the TPC-H "current date" (1995-06-17) from the start date.
+  static constexpr int32_t kCurrentDate = 1263;
+  // The last valid order date offset, i.e., (1998-12-31) - 151 days.
+  static constexpr int32_t kLastOrderDate = 2405;
+
+  Calendar() {
+    static constexpr std::array<int32_t, 12> kDaysInMonth = {31, 28, 31, 30, 31, 30,
+                                                             31, 31, 30, 31, 30, 31};
+    for (int32_t year = 1992; year <= 1998; year++) {
+      const bool leap = (year % 4 == 0);
+      int32_t day_in_year = 0;
+      for (int32_t month = 1; month <= 12; month++) {
+        const int32_t days = kDaysInMonth[month - 1] + (leap && month == 2 ? 1 : 0);
+        for (int32_t day = 1; day <= days; day++) {
+          days_.push_back({Date::FromYMD(year, month, day), year, month, day, ++day_in_year,
+                           day == days});
+        }
+      }
+    }
+  }
+
+  struct Day {
+    Date date;
+    int32_t year, month, day, day_in_year;
+    bool last_in_month;
+  };
+
+  const Day &operator[](int32_t offset) const { return days_[offset]; }
+
+  int32_t NumDays() const { return static_cast<int32_t>(days_.size()); }
+
+  // Return the integer key of the form YYYYMMDD used by SSB for the date at the given offset.
+  int32_t DateKey(int32_t offset) const {
+    const auto &d = days_[offset];
+    return d.year * 10000 + d.month * 100 + d.day;
+  }
+
+ private:
+  std::vector<Day> days_;
+};
+
+const Calendar &GetCalendar() {
+  static const Calendar kCalendar;
+  return kCalendar;
+}
+
+// Compute the number of rows of a table at the given scale factor, ensuring at least one row.
+uint64_t ScaledCount(uint64_t base, double scale_factor) {
+  return std::max<uint64_t>(1, static_cast<uint64_t>(static_cast<double>(base) * scale_factor));
+}
+
+// The TPC-H retail price of a part, in cents.
+int64_t PartRetailPriceCents(int64_t part_key) {
+  return 90000 + ((part_key / 10) % 20001) + 100 * (part_key % 1000);
+}
+
+// The TPC-H key of the i-th supplier (i in [0,3]) of the given part.
+int64_t PartSupplierKey(int64_t part_key, int64_t i, int64_t num_suppliers) {
+  return (part_key + (i * ((num_suppliers / 4) + (part_key - 1) / num_suppliers))) %
+             num_suppliers +
+         1;
+}
+
+// TPC-H order keys are sparse: only the first eight of every 32 keys are used.
+int32_t SparseOrderKey(uint64_t idx) { return static_cast<int32_t>((idx / 8) * 32 + idx % 8 + 1); }
+
+// Format a TPC-H phone number for an entity in the given nation.
+std::string_view PhoneNumber(RandomStream *rand, int32_t nation_key, std::string *buf) {
+  *buf = fmt::format("{:02d}-{:03d}-{:03d}-{:04d}", nation_key + 10, rand->Uniform(100, 999),
+                     rand->Uniform(100, 999), rand->Uniform(1000, 9999));
+  return *buf;
+}
+
+/**
+ * Generate the rows [0, num_rows) of one or more tables in parallel. The row space is divided into
+ * chunks of one block each, and chunks are generated concurrently, each into its own set of
+ * builders with its own random stream. Completed blocks are appended to the tables in chunk order,
+ * so the result is deterministic. Tables whose rows are generated together (i.e., orders and their
+ * line items) are provided together.
+ *
+ * @param tables The tables to generate. Generation functions receive one builder per table.
+ * @param num_rows The number of "driving" rows to generate.
+ * @param seed The seed for this table's random streams.
+ * @param gen_fn The function to generate a range of rows: (begin, end, random, builders).
+ */
+template <std::size_t N, typename F>
+void GenerateTables(const std::array<Table *, N> &tables, uint64_t num_rows, uint64_t seed,
+                    const F &gen_fn) {
+  util::Timer<std::milli> timer;
+  timer.Start();
+
+  const uint64_t num_chunks = (num_rows + kBlockSize - 1) / kBlockSize;
+  std::vector<std::array<std::unique_ptr<BlockBuilder>, N>> chunks(num_chunks);
+
+  tbb::parallel_for(tbb::blocked_range<uint64_t>(0, num_chunks, 1),
+                    [&](const tbb::blocked_range<uint64_t> &range) {
+                      for (uint64_t chunk_idx = range.begin(); chunk_idx < range.end();
+                           chunk_idx++) {
+                        auto &builders = chunks[chunk_idx];
+                        std::array<BlockBuilder *, N> out;
+                        for (std::size_t i = 0; i < N; i++) {
+                          builders[i] = std::make_unique<BlockBuilder>(tables[i]->GetSchema());
+                          out[i] = builders[i].get();
+                        }
+                        RandomStream rand(seed, chunk_idx);
+                        const uint64_t begin = chunk_idx * kBlockSize;
+                        const uint64_t end = std::min(num_rows, begin + kBlockSize);
+                        gen_fn(begin, end, &rand, out);
+                      }
+                    });
+
+  for (auto &builders : chunks) {
+    for (std::size_t i = 0; i < N; i++) {
+      builders[i]->AppendTo(tables[i]);
+    }
+  }
+
+  timer.Stop();
+
+  for (const auto table : tables) {
+    auto rps = table->GetTupleCount() / timer.GetElapsed() * 1000.0;
+    LOG_INFO("Generated '{}' with {} rows ({:.2f} rows/sec)", table->GetName(),
+             table->GetTupleCount(), rps);
+  }
+}
+
+// Generate a single table.
+template <typename F>
+void GenerateTable(Table *table, uint64_t num_rows, uint64_t seed, const F &gen_fn) {
+  GenerateTables<1>({table}, num_rows, seed,
+                    [&](uint64_t begin, uint64_t end, RandomStream *rand,
+                        const std::array<BlockBuilder *, 1> &out) {
+                      for (uint64_t i = begin; i < end; i++) {
+                        gen_fn(i, rand, out[0]);
+                        out[0]->FinishRow();
+                      }
+                    });
+}
+
 }  // namespace
 
 void TableGenerator::GenerateTPCHTables(Catalog *catalog, const std::string &data_dir,
                                         bool compress) {
   LOG_INFO("Loading TPC-H {} tables ...", compress ? "compressed" : "");
+  ImportTable("customer", CreateTable(catalog, "tpch.customer", TpchCustomerSchema()), data_dir);
+  ImportTable("part", CreateTable(catalog, "tpch.part", TpchPartSchema()), data_dir);
+  ImportTable("supplier", CreateTable(catalog, "tpch.supplier", TpchSupplierSchema()), data_dir);
+  ImportTable("partsupp", CreateTable(catalog, "tpch.partsupp", TpchPartsuppSchema()), data_dir);
+  ImportTable("orders", CreateTable(catalog, "tpch.orders", TpchOrdersSchema()), data_dir);
+  ImportTable("lineitem", CreateTable(catalog, "tpch.lineitem", TpchLineitemSchema()), data_dir);
+  ImportTable("nation", CreateTable(catalog, "tpch.nation", TpchNationSchema()), data_dir);
+  ImportTable("region", CreateTable(catalog, "tpch.region", TpchRegionSchema()), data_dir);
+  LOG_INFO("Completed loading TPC-H tables ...");
+}
+
+void TableGenerator::GenerateTPCHTables(Catalog *catalog, double scale_factor) {
+  LOG_INFO("Generating TPC-H tables at scale factor {} ...", scale_factor);
+
+  const Calendar &calendar = GetCalendar();
+  const auto num_parts = static_cast<int64_t>(ScaledCount(200000, scale_factor));
+  const auto num_suppliers = static_cast<int64_t>(ScaledCount(10000, scale_factor));
+  const auto num_customers = static_cast<int64_t>(ScaledCount(150000, scale_factor));
+  const auto num_orders = ScaledCount(1500000, scale_factor);
+  const auto num_clerks = static_cast<int64_t>(ScaledCount(1000, scale_factor));
 
   // -------------------------------------------------------
-  //
   // Customer
-  //
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({
-        {"c_custkey", Type::IntegerType(false)},
-        {"c_name", Type::VarcharType(false, 25)},
-        {"c_address", Type::VarcharType(false, 40)},
-        {"c_nationkey", Type::IntegerType(false)},
-        {"c_phone", Type::VarcharType(false, 15)},
-        {"c_acctbal", Type::RealType(false)},
-        {"c_mktsegment", Type::VarcharType(false, 10)},
-        {"c_comment", Type::VarcharType(false, 117)},
-    });
-    auto table = CreateTable(catalog, "tpch.customer", std::move(schema));
-    ImportTable("customer", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "tpch.customer", TpchCustomerSchema()), num_customers, 1,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  const auto key = static_cast<int32_t>(i + 1);
+                  const auto nation_key = static_cast<int32_t>(rand->Uniform(0, 24));
+                  out->Set<int32_t>(0, key);
+                  out->SetString(1, buf = fmt::format("Customer#{:09d}", key));
+                  out->SetString(2, rand->AlphaNumeric(10, 40, &buf));
+                  out->Set<int32_t>(3, nation_key);
+                  out->SetString(4, PhoneNumber(rand, nation_key, &buf));
+                  out->Set<float>(5, rand->Uniform(-99999, 999999) / 100.0f);
+                  out->SetString(6, rand->Pick(kMarketSegments));
+                  out->SetString(7, rand->Text(29, 116, &buf));
+                });
 
   // -------------------------------------------------------
-  //
   // Part
-  //
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({{"p_partkey", Type::IntegerType(false)},
-                              {"p_name", Type::VarcharType(false, 55)},
-                              {"p_mfgr", Type::VarcharType(false, 25)},
-                              {"p_brand", Type::VarcharType(false, 10)},
-                              {"p_type", Type::VarcharType(false, 25)},
-                              {"p_size", Type::IntegerType(false)},
-                              {"p_container", Type::VarcharType(false, 10)},
-                              {"p_retailprice", Type::RealType(false)},
-                              {"p_comment", Type::VarcharType(false, 23)}});
-    auto table = CreateTable(catalog, "tpch.part", std::move(schema));
-    ImportTable("part", table, data_dir);
-  }
+  GenerateTable(
+      CreateTable(catalog, "tpch.part", TpchPartSchema()), num_parts, 2,
+      [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+        std::string buf;
+        const auto key = static_cast<int32_t>(i + 1);
+        const auto mfgr = rand->Uniform(1, 5);
+        // Name is five distinct colors.
+        std::array<std::string_view, 5> colors;
+        for (uint32_t c = 0; c < colors.size(); c++) {
+          do {
+            colors[c] = rand->Pick(kColors);
+          } while (std::find(colors.begin(), colors.begin() + c, colors[c]) !=
+                   colors.begin() + c);
+        }
+        out->Set<int32_t>(0, key);
+        out->SetString(1, buf = fmt::format("{} {} {} {} {}", colors[0], colors[1], colors[2],
+                                            colors[3], colors[4]));
+        out->SetString(2, buf = fmt::format("Manufacturer#{}", mfgr));
+        out->SetString(3, buf = fmt::format("Brand#{}{}", mfgr, rand->Uniform(1, 5)));
+        out->SetString(4, buf = fmt::format("{} {} {}", rand->Pick(kTypeSyllable1),
+                                            rand->Pick(kTypeSyllable2),
+                                            rand->Pick(kTypeSyllable3)));
+        out->Set<int32_t>(5, static_cast<int32_t>(rand->Uniform(1, 50)));
+        out->SetString(6, buf = fmt::format("{} {}", rand->Pick(kContainerSyllable1),
+                                            rand->Pick(kContainerSyllable2)));
+        out->Set<float>(7, PartRetailPriceCents(key) / 100.0f);
+        out->SetString(8, rand->Text(5, 22, &buf));
+      });
 
   // -------------------------------------------------------
-  //
   // Supplier
-  //
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({{"s_suppkey", Type::IntegerType(false)},
-                              {"s_name", Type::VarcharType(false, 25)},
-                              {"s_address", Type::VarcharType(false, 40)},
-                              {"s_nationkey", Type::IntegerType(false)},
-                              {"s_phone", Type::VarcharType(false, 15)},
-                              {"s_acctbal", Type::RealType(false)},
-                              {"s_comment", Type::VarcharType(false, 101)}});
-    auto table = CreateTable(catalog, "tpch.supplier", std::move(schema));
-    ImportTable("supplier", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "tpch.supplier", TpchSupplierSchema()), num_suppliers, 3,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  const auto key = static_cast<int32_t>(i + 1);
+                  const auto nation_key = static_cast<int32_t>(rand->Uniform(0, 24));
+                  out->Set<int32_t>(0, key);
+                  out->SetString(1, buf = fmt::format("Supplier#{:09d}", key));
+                  out->SetString(2, rand->AlphaNumeric(10, 40, &buf));
+                  out->Set<int32_t>(3, nation_key);
+                  out->SetString(4, PhoneNumber(rand, nation_key, &buf));
+                  out->Set<float>(5, rand->Uniform(-99999, 999999) / 100.0f);
+                  // A few suppliers have customer complaints or recommendations (see Q16).
+                  rand->Text(25, 100, &buf);
+                  if (rand->Chance(0.001)) {
+                    const bool complaint = rand->Chance(0.5);
+                    buf.replace(0, std::min<std::size_t>(buf.size(), 25),
+                                complaint ? "Customer Complaints " : "Customer Recommends ");
+                  }
+                  out->SetString(6, buf);
+                });
 
   // -------------------------------------------------------
-  //
   // Partsupp
-  //
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({{"ps_partkey", Type::IntegerType(false)},
-                              {"ps_suppkey", Type::IntegerType(false)},
-                              {"ps_availqty", Type::IntegerType(false)},
-                              {"ps_supplycost", Type::RealType(false)},
-                              {"ps_comment", Type::VarcharType(false, 199)}});
-    auto table = CreateTable(catalog, "tpch.partsupp", std::move(schema));
-    ImportTable("partsupp", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "tpch.partsupp", TpchPartsuppSchema()), num_parts * 4, 4,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  const auto part_key = static_cast<int64_t>(i / 4 + 1);
+                  const auto supp_idx = static_cast<int64_t>(i % 4);
+                  out->Set<int32_t>(0, static_cast<int32_t>(part_key));
+                  out->Set<int32_t>(1, static_cast<int32_t>(
+                                           PartSupplierKey(part_key, supp_idx, num_suppliers)));
+                  out->Set<int32_t>(2, static_cast<int32_t>(rand->Uniform(1, 9999)));
+                  out->Set<float>(3, rand->Uniform(100, 100000) / 100.0f);
+                  out->SetString(4, rand->Text(49, 198, &buf));
+                });
 
   // -------------------------------------------------------
-  //
-  // Orders
-  //
+  // Orders and Lineitem
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({{"o_orderkey", Type::IntegerType(false)},
-                              {"o_custkey", Type::IntegerType(false)},
-                              {"o_orderstatus", Type::VarcharType(false, 1)},
-                              {"o_totalprice", Type::RealType(false)},
-                              {"o_orderdate", Type::Type::DateType(false)},
-                              {"o_orderpriority", Type::VarcharType(false, 15)},
-                              {"o_clerk", Type::VarcharType(false, 15)},
-                              {"o_shippriority", Type::IntegerType(false)},
-                              {"o_comment", Type::VarcharType(false, 79)}});
-    auto table = CreateTable(catalog, "tpch.orders", std::move(schema));
-    ImportTable("orders", table, data_dir);
-  }
+  GenerateTables<2>(
+      {CreateTable(catalog, "tpch.orders", TpchOrdersSchema()),
+       CreateTable(catalog, "tpch.lineitem", TpchLineitemSchema())},
+      num_orders, 5,
+      [&](uint64_t begin, uint64_t end, RandomStream *rand,
+          const std::array<BlockBuilder *, 2> &out) {
+        BlockBuilder *orders = out[0], *lineitem = out[1];
+        std::string buf;
+        for (uint64_t i = begin; i < end; i++) {
+          const int32_t order_key = SparseOrderKey(i);
+          const auto order_date = static_cast<int32_t>(rand->Uniform(0, Calendar::kLastOrderDate));
 
-  // -------------------------------------------------------
-  //
-  // Lineitem
-  //
-  // -------------------------------------------------------
+          // Line items first, since the order's price and status depend on them.
+          const auto num_lines = static_cast<int32_t>(rand->Uniform(1, 7));
+          double total_price = 0.0;
+          int32_t num_shipped = 0;
+          for (int32_t line = 1; line <= num_lines; line++) {
+            const int64_t part_key = rand->Uniform(1, num_parts);
+            const int64_t supp_key =
+                PartSupplierKey(part_key, rand->Uniform(0, 3), num_suppliers);
+            const auto quantity = static_cast<float>(rand->Uniform(1, 50));
+            const float price = quantity * (PartRetailPriceCents(part_key) / 100.0f);
+            const float discount = rand->Uniform(0, 10) / 100.0f;
+            const float tax = rand->Uniform(0, 8) / 100.0f;
+            const auto ship_date = order_date + static_cast<int32_t>(rand->Uniform(1, 121));
+            const auto commit_date = order_date + static_cast<int32_t>(rand->Uniform(30, 90));
+            const auto receipt_date = ship_date + static_cast<int32_t>(rand->Uniform(1, 30));
+            const bool shipped = ship_date <= Calendar::kCurrentDate;
 
-  {
-    auto schema = MakeSchema({{"l_orderkey", Type::IntegerType(false)},
-                              {"l_partkey", Type::IntegerType(false)},
-                              {"l_suppkey", Type::IntegerType(false)},
-                              {"l_linenumber", Type::IntegerType(false)},
-                              {"l_quantity", Type::RealType(false)},
-                              {"l_extendedprice", Type::RealType(false)},
-                              {"l_discount", Type::RealType(false)},
-                              {"l_tax", Type::RealType(false)},
-                              {"l_returnflag", Type::VarcharType(false, 1)},
-                              {"l_linestatus", Type::VarcharType(false, 1)},
-                              {"l_shipdate", Type::DateType(false)},
-                              {"l_commitdate", Type::DateType(false)},
-                              {"l_receiptdate", Type::DateType(false)},
-                              {"l_shipinstruct", Type::VarcharType(false, 25)},
-                              {"l_shipmode", Type::VarcharType(false, 10)},
-                              {"l_comment", Type::VarcharType(false, 44)}});
-
-    auto table = CreateTable(catalog, "tpch.lineitem", std::move(schema));
-    ImportTable("lineitem", table, data_dir);
-  }
+            lineitem->Set<int32_t>(0, order_key);
+            lineitem->Set<int32_t>(1, static_cast<int32_t>(part_key));
+            lineitem->Set<int32_t>(2, static_cast<int32_t>(supp_key));
+            lineitem->Set<int32_t>(3, line);
+            lineitem->Set<float>(4, quantity);
+            lineitem->Set<float>(5, price);
+            lineitem->Set<float>(6, discount);
+            lineitem->Set<float>(7, tax);
+            lineitem->SetString(8, receipt_date <= Calendar::kCurrentDate
+                                       ? (rand->Chance(0.5) ? "R" : "A")
+                                       : "N");
+            lineitem->SetString(9, shipped ? "F" : "O");
+            lineitem->Set<Date>(10, calendar[ship_date].date);
+            lineitem->Set<Date>(11, calendar[commit_date].date);
+            lineitem->Set<Date>(12, calendar[receipt_date].date);
+            lineitem->SetString(13, rand->Pick(kShipInstructions));
+            lineitem->SetString(14, rand->Pick(kShipModes));
+            lineitem->SetString(15, rand->Text(10, 43, &buf));
+            lineitem->FinishRow();
+
+            total_price += price * (1.0 + tax) * (1.0 - discount);
+            num_shipped += shipped;
+          }
+
+          // Every third customer never places an order.
+          int64_t cust_key;
+          do {
+            cust_key = rand->Uniform(1, num_customers);
+          } while (cust_key % 3 == 0 && num_customers > 2);
+
+          orders->Set<int32_t>(0, order_key);
+          orders->Set<int32_t>(1, static_cast<int32_t>(cust_key));
+          orders->SetString(2, num_shipped == num_lines ? "F" : num_shipped == 0 ? "O" : "P");
+          orders->Set<float>(3, static_cast<float>(total_price));
+          orders->Set<Date>(4, calendar[order_date].date);
+          orders->SetString(5, rand->Pick(kOrderPriorities));
+          orders->SetString(6, buf = fmt::format("Clerk#{:09d}", rand->Uniform(1, num_clerks)));
+          orders->Set<int32_t>(7, 0);
+          orders->SetString(8, rand->Text(19, 78, &buf));
+          orders->FinishRow();
+        }
+      });
 
   // -------------------------------------------------------
-  //
   // Nation
-  //
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({{"n_nationkey", Type::IntegerType(false)},
-                              {"n_name", Type::VarcharType(false, 25)},
-                              {"n_regionkey", Type::IntegerType(false)},
-                              {"n_comment", Type::VarcharType(false, 152)}});
-    auto table = CreateTable(catalog, "tpch.nation", std::move(schema));
-    ImportTable("nation", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "tpch.nation", TpchNationSchema()), kNations.size(), 6,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  out->Set<int32_t>(0, static_cast<int32_t>(i));
+                  out->SetString(1, kNations[i].name);
+                  out->Set<int32_t>(2, kNations[i].region_key);
+                  out->SetString(3, rand->Text(31, 114, &buf));
+                });
 
   // -------------------------------------------------------
-  //
   // Region
-  //
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({{"r_regionkey", Type::IntegerType(false)},
-                              {"r_name", Type::VarcharType(false, 25)},
-                              {"r_comment", Type::VarcharType(false, 152)}});
-    auto table = CreateTable(catalog, "tpch.region", std::move(schema));
-    ImportTable("region", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "tpch.region", TpchRegionSchema()), kRegions.size(), 7,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  out->Set<int32_t>(0, static_cast<int32_t>(i));
+                  out->SetString(1, kRegions[i]);
+                  out->SetString(2, rand->Text(31, 115, &buf));
+                });
 
-  LOG_INFO("Completed loading TPC-H tables ...");
+  LOG_INFO("Completed generating TPC-H tables ...");
 }
 
 void TableGenerator::GenerateSSBMTables(sql::Catalog *catalog, const std::string &data_dir) {
   LOG_INFO("Loading SSBM tables ...");
+  ImportTable("part", CreateTable(catalog, "ssbm.part", SsbmPartSchema()), data_dir);
+  ImportTable("supplier", CreateTable(catalog, "ssbm.supplier", SsbmSupplierSchema()), data_dir);
+  ImportTable("customer", CreateTable(catalog, "ssbm.customer", SsbmCustomerSchema()), data_dir);
+  ImportTable("date", CreateTable(catalog, "ssbm.date", SsbmDateSchema()), data_dir);
+  ImportTable("lineorder", CreateTable(catalog, "ssbm.lineorder", SsbmLineorderSchema()),
+              data_dir);
+  LOG_INFO("Completed loading SSBM tables ...");
+}
+
+void TableGenerator::GenerateSSBMTables(sql::Catalog *catalog, double scale_factor) {
+  LOG_INFO("Generating SSBM tables at scale factor {} ...", scale_factor);
+
+  const Calendar &calendar = GetCalendar();
+  // Unlike TPC-H, the SSB part table grows logarithmically with the scale factor.
+  const auto num_parts = static_cast<int64_t>(
+      scale_factor < 1.0 ? ScaledCount(200000, scale_factor)
+                         : ScaledCount(200000, std::floor(1.0 + std::log2(scale_factor))));
+  const auto num_suppliers = static_cast<int64_t>(ScaledCount(2000, scale_factor));
+  const auto num_customers = static_cast<int64_t>(ScaledCount(30000, scale_factor));
+  const auto num_orders = ScaledCount(1500000, scale_factor);
+
+  // SSB cities are the first nine characters of the nation name, padded, plus a digit.
+  const auto city = [](std::string_view nation, int64_t digit, std::string *buf) {
+    *buf = fmt::format("{:<9.9}{}", nation, digit);
+    return std::string_view(*buf);
+  };
 
   // -------------------------------------------------------
   // Part
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({
-        {"p_partkey", Type::IntegerType(false)},
-        {"p_name", Type::VarcharType(false, 22)},
-        {"p_mfgr", Type::VarcharType(false, 6)},
-        {"p_category", Type::VarcharType(false, 7)},
-        {"p_brand1", Type::VarcharType(false, 9)},
-        {"p_color", Type::VarcharType(false, 11)},
-        {"p_type", Type::VarcharType(false, 25)},
-        {"p_size", Type::IntegerType(false)},
-        {"p_container", Type::VarcharType(false, 10)},
-    });
-    auto table = CreateTable(catalog, "ssbm.part", std::move(schema));
-    ImportTable("part", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "ssbm.part", SsbmPartSchema()), num_parts, 11,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  const auto mfgr = rand->Uniform(1, 5);
+                  const auto category = rand->Uniform(1, 5);
+                  out->Set<int32_t>(0, static_cast<int32_t>(i + 1));
+                  out->SetString(1, buf = fmt::format("{} {}", rand->Pick(kColors),
+                                                      rand->Pick(kColors)));
+                  out->SetString(2, buf = fmt::format("MFGR#{}", mfgr));
+                  out->SetString(3, buf = fmt::format("MFGR#{}{}", mfgr, category));
+                  out->SetString(4, buf = fmt::format("MFGR#{}{}{}", mfgr, category,
+                                                      rand->Uniform(1, 40)));
+                  out->SetString(5, rand->Pick(kColors));
+                  out->SetString(6, buf = fmt::format("{} {} {}", rand->Pick(kTypeSyllable1),
+                                                      rand->Pick(kTypeSyllable2),
+                                                      rand->Pick(kTypeSyllable3)));
+                  out->Set<int32_t>(7, static_cast<int32_t>(rand->Uniform(1, 50)));
+                  out->SetString(8, buf = fmt::format("{} {}", rand->Pick(kContainerSyllable1),
+                                                      rand->Pick(kContainerSyllable2)));
+                });
 
   // -------------------------------------------------------
   // Supplier
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({
-        {"s_suppkey", Type::IntegerType(false)},
-        {"s_name", Type::VarcharType(false, 25)},
-        {"s_address", Type::VarcharType(false, 25)},
-        {"s_city", Type::VarcharType(false, 10)},
-        {"s_nation", Type::VarcharType(false, 15)},
-        {"s_region", Type::VarcharType(false, 12)},
-        {"s_phone", Type::VarcharType(false, 15)},
-    });
-    auto table = CreateTable(catalog, "ssbm.supplier", std::move(schema));
-    ImportTable("supplier", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "ssbm.supplier", SsbmSupplierSchema()), num_suppliers, 12,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  const auto key = static_cast<int32_t>(i + 1);
+                  const auto nation_key = static_cast<int32_t>(rand->Uniform(0, 24));
+                  const auto &nation = kNations[nation_key];
+                  out->Set<int32_t>(0, key);
+                  out->SetString(1, buf = fmt::format("Supplier#{:09d}", key));
+                  out->SetString(2, rand->AlphaNumeric(10, 25, &buf));
+                  out->SetString(3, city(nation.name, rand->Uniform(0, 9), &buf));
+                  out->SetString(4, nation.name);
+                  out->SetString(5, kRegions[nation.region_key]);
+                  out->SetString(6, PhoneNumber(rand, nation_key, &buf));
+                });
 
   // -------------------------------------------------------
   // Customer
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({
-        {"c_custkey", Type::IntegerType(false)},
-        {"c_name", Type::VarcharType(false, 25)},
-        {"c_address", Type::VarcharType(false, 25)},
-        {"c_city", Type::VarcharType(false, 10)},
-        {"c_nation", Type::VarcharType(false, 15)},
-        {"c_region", Type::VarcharType(false, 12)},
-        {"c_phone", Type::VarcharType(false, 15)},
-        {"c_mktsegment", Type::VarcharType(false, 10)},
-    });
-    auto table = CreateTable(catalog, "ssbm.customer", std::move(schema));
-    ImportTable("customer", table, data_dir);
-  }
+  GenerateTable(CreateTable(catalog, "ssbm.customer", SsbmCustomerSchema()), num_customers, 13,
+                [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+                  std::string buf;
+                  const auto key = static_cast<int32_t>(i + 1);
+                  const auto nation_key = static_cast<int32_t>(rand->Uniform(0, 24));
+                  const auto &nation = kNations[nation_key];
+                  out->Set<int32_t>(0, key);
+                  out->SetString(1, buf = fmt::format("Customer#{:09d}", key));
+                  out->SetString(2, rand->AlphaNumeric(10, 25, &buf));
+                  out->SetString(3, city(nation.name, rand->Uniform(0, 9), &buf));
+                  out->SetString(4, nation.name);
+                  out->SetString(5, kRegions[nation.region_key]);
+                  out->SetString(6, PhoneNumber(rand, nation_key, &buf));
+                  out->SetString(7, rand->Pick(kMarketSegments));
+                });
 
   // -------------------------------------------------------
   // Date
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({
-        {"d_datekey", Type::IntegerType(false)},
-        {"d_date", Type::VarcharType(false, 19)},
-        {"d_dayofweek", Type::VarcharType(false, 10)},
-        {"d_month", Type::VarcharType(false, 10)},
-        {"d_year", Type::IntegerType(false)},
-        {"d_yearmonthnum", Type::IntegerType(false)},
-        {"d_yearmonth", Type::VarcharType(false, 8)},
-        {"d_daynuminweek", Type::IntegerType(false)},
-        {"d_daynuminmonth", Type::IntegerType(false)},
-        {"d_daynuminyear", Type::IntegerType(false)},
-        {"d_monthnuminyear", Type::IntegerType(false)},
-        {"d_weeknuminyear", Type::IntegerType(false)},
-        {"d_sellingseason", Type::VarcharType(false, 13)},
-        {"d_lasdayinweekfl", Type::VarcharType(false, 1)},
-        {"d_lastdayinmonthfl", Type::VarcharType(false, 1)},
-        {"d_holidyfl", Type::VarcharType(false, 1)},
-        {"d_weekdayfl", Type::VarcharType(false, 1)},
-    });
-    auto table = CreateTable(catalog, "ssbm.date", std::move(schema));
-    ImportTable("date", table, data_dir);
-  }
+  GenerateTable(
+      CreateTable(catalog, "ssbm.date", SsbmDateSchema()), calendar.NumDays(), 14,
+      [&](uint64_t i, RandomStream *rand, BlockBuilder *out) {
+        std::string buf;
+        const auto &day = calendar[i];
+        // 1992-01-01 was a Wednesday.
+        const auto day_of_week = static_cast<int32_t>((i + 3) % 7);
+        std::string_view season;
+        if (day.month == 12) {
+          season = "Christmas";
+        } else if (day.month >= 6 && day.month <= 8) {
+          season = "Summer";
+        } else if (day.month <= 2) {
+          season = "Winter";
+        } else if (day.month <= 5) {
+          season = "Spring";
+        } else {
+          season = "Fall";
+        }
+        out->Set<int32_t>(0, calendar.DateKey(i));
+        out->SetString(1, buf = fmt::format("{} {}, {}", kMonthNames[day.month - 1], day.day,
+                                            day.year));
+        out->SetString(2, kDayNames[day_of_week]);
+        out->SetString(3, kMonthNames[day.month - 1]);
+        out->Set<int32_t>(4, day.year);
+        out->Set<int32_t>(5, day.year * 100 + day.month);
+        out->SetString(6, buf = fmt::format("{:.3}{}", kMonthNames[day.month - 1], day.year));
+        out->Set<int32_t>(7, day_of_week + 1);
+        out->Set<int32_t>(8, day.day);
+        out->Set<int32_t>(9, day.day_in_year);
+        out->Set<int32_t>(10, day.month);
+        out->Set<int32_t>(11, (day.day_in_year - 1) / 7 + 1);
+        out->SetString(12, season);
+        out->SetString(13, day_of_week == 6 ? "1" : "0");
+        out->SetString(14, day.last_in_month ? "1" : "0");
+        out->SetString(15, "0");
+        out->SetString(16, day_of_week >= 1 && day_of_week <= 5 ? "1" : "0");
+      });
 
   // -------------------------------------------------------
   // Line-Order
   // -------------------------------------------------------
 
-  {
-    auto schema = MakeSchema({
-        {"lo_orderkey", Type::IntegerType(false)},
-        {"lo_linenumber", Type::IntegerType(false)},
-        {"lo_custkey", Type::IntegerType(false)},
-        {"lo_partkey", Type::IntegerType(false)},
-        {"lo_suppkey", Type::IntegerType(false)},
-        {"lo_orderdate", Type::IntegerType(false)},
-        {"lo_orderpriority", Type::VarcharType(false, 15)},
-        {"lo_shippriority", Type::VarcharType(false, 1)},
-        {"lo_quantity", Type::IntegerType(false)},
-        {"lo_extendedprice", Type::IntegerType(false)},
-        {"lo_ordertotalprice", Type::IntegerType(false)},
-        {"lo_discount", Type::IntegerType(false)},
-        {"lo_revenue", Type::IntegerType(false)},
-        {"lo_supplycost", Type::IntegerType(false)},
-        {"lo_tax", Type::IntegerType(false)},
-        {"lo_commitdate", Type::IntegerType(false)},
-        {"lo_shipmode", Type::VarcharType(false, 10)},
-    });
-    auto table = CreateTable(catalog, "ssbm.lineorder", std::move(schema));
-    ImportTable("lineorder", table, data_dir);
-  }
+  GenerateTables<1>(
+      {CreateTable(catalog, "ssbm.lineorder", SsbmLineorderSchema())}, num_orders, 15,
+      [&](uint64_t begin, uint64_t end, RandomStream *rand,
+          const std::array<BlockBuilder *, 1> &out) {
+        BlockBuilder *lineorder = out[0];
+        struct Line {
+          int64_t part_key, supp_key, quantity, price, supply_cost, discount, tax;
+        };
+        std::array<Line, 7> lines;
+        for (uint64_t i = begin; i < end; i++) {
+          const int32_t order_key = SparseOrderKey(i);
+          const auto order_date = static_cast<int32_t>(rand->Uniform(0, Calendar::kLastOrderDate));
+          const auto cust_key = static_cast<int32_t>(rand->Uniform(1, num_customers));
+          const auto priority = rand->Pick(kOrderPriorities);
+          const auto num_lines = static_cast<int32_t>(rand->Uniform(1, 7));
 
-  LOG_INFO("Completed loading SSBM tables ...");
+          // Every line carries the order's total price, so generate all lines before writing.
+          int64_t total_price = 0;
+          for (int32_t l = 0; l < num_lines; l++) {
+            auto &line = lines[l];
+            line.part_key = rand->Uniform(1, num_parts);
+            line.supp_key = rand->Uniform(1, num_suppliers);
+            line.quantity = rand->Uniform(1, 50);
+            line.price = line.quantity * PartRetailPriceCents(line.part_key);
+            line.supply_cost = 6 * PartRetailPriceCents(line.part_key) / 10;
+            line.discount = rand->Uniform(0, 10);
+            line.tax = rand->Uniform(0, 8);
+            total_price += line.price * (100 - line.discount) * (100 + line.tax) / 10000;
+          }
+
+          for (int32_t l = 0; l < num_lines; l++) {
+            const auto &line = lines[l];
+            lineorder->Set<int32_t>(0, order_key);
+            lineorder->Set<int32_t>(1, l + 1);
+            lineorder->Set<int32_t>(2, cust_key);
+            lineorder->Set<int32_t>(3, static_cast<int32_t>(line.part_key));
+            lineorder->Set<int32_t>(4, static_cast<int32_t>(line.supp_key));
+            lineorder->Set<int32_t>(5, calendar.DateKey(order_date));
+            lineorder->SetString(6, priority);
+            lineorder->SetString(7, "0");
+            lineorder->Set<int32_t>(8, static_cast<int32_t>(line.quantity));
+            lineorder->Set<int32_t>(9, static_cast<int32_t>(line.price));
+            lineorder->Set<int32_t>(10, static_cast<int32_t>(total_price));
+            lineorder->Set<int32_t>(11, static_cast<int32_t>(line.discount));
+            lineorder->Set<int32_t>(12,
+                                    static_cast<int32_t>(line.price * (100 - line.discount) / 100));
+            lineorder->Set<int32_t>(13, static_cast<int32_t>(line.supply_cost));
+            lineorder->Set<int32_t>(14, static_cast<int32_t>(line.tax));
+            lineorder->Set<int32_t>(
+                15, calendar.DateKey(order_date + static_cast<int32_t>(rand->Uniform(30, 90))));
+            lineorder->SetString(16, rand->Pick(kShipModes));
+            lineorder->FinishRow();
+          }
+        }
+      });
+
+  LOG_INFO("Completed generating SSBM tables ...");
 }
 
 }  // namespace tpl::sql::tablegen
@@ -1,21 +1,243 @@
 #include "sql/tuple_id_list.h"
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <numeric>
 #include <string>
 
 #include "util/vector_util.h"
 
 namespace tpl::sql {
 
+void TupleIdList::Resize(const uint32_t num_tuples) {
+  switch (repr_) {
+    case Representation::Range:
+      range_end_ = std::min(range_end_, num_tuples);
+      range_begin_ = std::min(range_begin_, range_end_);
+      break;
+    case Representation::Selection:
+      sel_size_ = static_cast<uint32_t>(
+          std::lower_bound(sel_.begin(), sel_.begin() + sel_size_, num_tuples) - sel_.begin());
+      break;
+    case Representation::Bitmap:
+      break;
+  }
+  // Resizing the bitmap drops TIDs beyond the new capacity, so a valid bitmap remains valid.
+  bit_vector_.Resize(num_tuples);
+}
+
+void TupleIdList::AddRange(const uint32_t start_tid, const uint32_t end_tid) {
+  // Ranges that touch or overlap merge into a single range.
+  if (repr_ == Representation::Range) {
+    if (range_begin_ == range_end_) {
+      SetRange(start_tid, end_tid);
+      return;
+    }
+    if (start_tid <= range_end_ && range_begin_ <= end_tid) {
+      SetRange(std::min(range_begin_, start_tid), std::max(range_end_, end_tid));
+      return;
+    }
+  }
+  ConvertToBitmap();
+  bit_vector_.SetRange(start_tid, end_tid);
+}
+
+void TupleIdList::AssignFrom(const TupleIdList &other) {
+  TPL_ASSERT(GetCapacity() == other.GetCapacity(), "Mismatched TID list capacities");
+  switch (other.repr_) {
+    case Representation::Range:
+      SetRange(other.range_begin_, other.range_end_);
+      break;
+    case Representation::Selection:
+      sel_.resize(std::max(sel_.size(), other.sel_.size()));
+      std::copy(other.sel_.begin(), other.sel_.begin() + other.sel_size_, sel_.begin());
+      sel_size_ = other.sel_size_;
+      repr_ = Representation::Selection;
+      bits_valid_ = false;
+      break;
+    case Representation::Bitmap:
+      bit_vector_.Copy(other.bit_vector_);
+      repr_ = Representation::Bitmap;
+      bits_valid_ = true;
+      break;
+  }
+}
+
+void TupleIdList::IntersectWith(const TupleIdList &other) {
+  if (other.repr_ == Representation::Range) {
+    if (repr_ == Representation::Range) {
+      const uint32_t begin = std::max(range_begin_, other.range_begin_);
+      SetRange(begin, std::max(begin, std::min(range_end_, other.range_end_)));
+      return;
+    }
+    if (other.IsFull()) {
+      return;
+    }
+  }
+  if (repr_ == Representation::Range && IsFull()) {
+    AssignFrom(other);
+    return;
+  }
+  if (repr_ == Representation::Selection) {
+    FilterSelection([&](const uint64_t i) { return other.Contains(i); });
+    return;
+  }
+  ConvertToBitmap();
+  bit_vector_.Intersect(other.GetBits());
+}
+
+void TupleIdList::IntersectWith(const BitVectorType &bits) {
+  if (repr_ == Representation::Selection) {
+    FilterSelection([&](const uint64_t i) { return bits.Test(i); });
+    return;
+  }
+  ConvertToBitmap();
+  bit_vector_.Intersect(bits);
+}
+
+void TupleIdList::UnionWith(const TupleIdList &other) {
+  if (other.repr_ == Representation::Range) {
+    if (other.range_begin_ != other.range_end_) {
+      AddRange(other.range_begin_, other.range_end_);
+    }
+    return;
+  }
+  if (repr_ == Representation::Range) {
+    if (IsFull()) {
+      return;
+    }
+    if (IsEmpty()) {
+      AssignFrom(other);
+      return;
+    }
+  }
+  ConvertToBitmap();
+  if (other.repr_ == Representation::Selection) {
+    for (uint32_t i = 0; i < other.sel_size_; i++) {
+      bit_vector_.Set(other.sel_[i]);
+    }
+  } else {
+    bit_vector_.Union(other.bit_vector_);
+  }
+}
+
+void TupleIdList::UnsetFrom(const TupleIdList &other) {
+  if (other.repr_ == Representation::Range) {
+    // Nothing to remove.
+    if (other.range_begin_ == other.range_end_) {
+      return;
+    }
+    // Removing a range from either end of a range leaves a range.
+    if (repr_ == Representation::Range) {
+      if (other.range_end_ <= range_begin_ || range_end_ <= other.range_begin_) {
+        return;
+      }
+      if (other.range_begin_ <= range_begin_) {
+        SetRange(std::min(range_end_, other.range_end_), range_end_);
+        return;
+      }
+      if (range_end_ <= other.range_end_) {
+        SetRange(range_begin_, other.range_begin_);
+        return;
+      }
+    }
+  }
+  if (repr_ == Representation::Selection) {
+    FilterSelection([&](const uint64_t i) { return !other.Contains(i); });
+    return;
+  }
+  ConvertToBitmap();
+  bit_vector_.Difference(other.GetBits());
+}
+
+void TupleIdList::UnsetFrom(const BitVectorType &bits) {
+  switch (repr_) {
+    case Representation::Range:
+      // Keep the range if there's nothing to remove, e.g., when removing NULLs from a vector
+      // without any.
+      if (IsEmpty() || bits.None()) {
+        return;
+      }
+      break;
+    case Representation::Selection:
+      FilterSelection([&](const uint64_t i) { return !bits.Test(i); });
+      return;
+    case Representation::Bitmap:
+      break;
+  }
+  ConvertToBitmap();
+  bit_vector_.Difference(bits);
+}
+
 void TupleIdList::BuildFromSelectionVector(const sel_t *sel_vector, uint32_t size) {
+  // If the list is empty, adopt the selection vector as is if it's sorted, or as a range if it's
+  // also contiguous.
+  if (repr_ != Representation::Bitmap && IsEmpty() && size > 0 &&
+      std::is_sorted(sel_vector, sel_vector + size, std::less_equal<>())) {
+    if (sel_vector[size - 1] - sel_vector[0] + 1u == size) {
+      SetRange(sel_vector[0], sel_vector[size - 1] + 1);
+      return;
+    }
+    if (ShouldUseSelectionVector(size)) {
+      sel_.resize(std::max<std::size_t>(sel_.size(), GetCapacity()));
+      std::copy(sel_vector, sel_vector + size, sel_.begin());
+      sel_size_ = size;
+      repr_ = Representation::Selection;
+      bits_valid_ = false;
+      return;
+    }
+  }
+
+  ConvertToBitmap();
   for (uint32_t i = 0; i < size; i++) {
     bit_vector_.Set(sel_vector[i]);
   }
 }
 
 uint32_t TupleIdList::ToSelectionVector(sel_t *sel_vec) const {
-  return util::VectorUtil::BitVectorToSelectionVector(bit_vector_.GetWords(),
-                                                      bit_vector_.GetNumBits(), sel_vec);
+  switch (repr_) {
+    case Representation::Range:
+      std::iota(sel_vec, sel_vec + GetTupleCount(), static_cast<sel_t>(range_begin_));
+      return GetTupleCount();
+    case Representation::Selection:
+      std::copy(sel_.begin(), sel_.begin() + sel_size_, sel_vec);
+      return sel_size_;
+    default:
+      return util::VectorUtil::BitVectorToSelectionVector(bit_vector_.GetWords(),
+                                                          bit_vector_.GetNumBits(), sel_vec);
+  }
+}
+
+void TupleIdList::ConvertToSelection() {
+  TPL_ASSERT(GetCapacity() <= kMaxSelectionVectorCapacity, "List too large for selection vector");
+  sel_.resize(std::max<std::size_t>(sel_.size(), GetCapacity()));
+  if (repr_ == Representation::Range) {
+    std::iota(sel_.begin(), sel_.begin() + GetTupleCount(), static_cast<sel_t>(range_begin_));
+    sel_size_ = GetTupleCount();
+  } else if (repr_ == Representation::Bitmap) {
+    sel_size_ = 0;
+    bit_vector_.ForEachSet([&](const std::size_t i) { sel_[sel_size_++] = i; });
+  }
+  // The contents haven't changed, so the bitmap stays as valid as it was.
+  repr_ = Representation::Selection;
+}
+
+void TupleIdList::MaterializeBits() const {
+  if (bits_valid_) {
+    return;
+  }
+  bit_vector_.Reset();
+  if (repr_ == Representation::Range) {
+    if (range_begin_ != range_end_) {
+      bit_vector_.SetRange(range_begin_, range_end_);
+    }
+  } else {
+    for (uint32_t i = 0; i < sel_size_; i++) {
+      bit_vector_.Set(sel_[i]);
+    }
+  }
+  bits_valid_ = true;
 }
 
 std::string TupleIdList::ToString() const {
@@ -1,5 +1,7 @@
 #include "sql/type.h"
 
+#include <algorithm>
+
 #include "spdlog/fmt/fmt.h"
 
 namespace tpl::sql {
@@ -18,6 +20,39 @@ Type::Type(SqlTypeId type, bool nullable, Type::NumericInfo numeric_info) : Type
   numeric_info_ = numeric_info;
 }
 
+// static
+Type Type::DecimalArithmeticResultType(KnownOperator op, const Type &left, const Type &right) {
+  TPL_ASSERT(left.GetTypeId() == SqlTypeId::Decimal && right.GetTypeId() == SqlTypeId::Decimal,
+             "Inputs must be decimals");
+  const uint32_t p1 = left.GetPrecision(), s1 = left.GetScale();
+  const uint32_t p2 = right.GetPrecision(), s2 = right.GetScale();
+  const bool nullable = left.IsNullable() || right.IsNullable();
+  constexpr uint32_t kMaxPrecision = Decimal128::kMaxPrecision;
+  switch (op) {
+    case KnownOperator::Add:
+    case KnownOperator::Sub: {
+      const uint32_t scale = std::max(s1, s2);
+      const uint32_t precision = std::max(p1 - s1, p2 - s2) + scale + 1;
+      return DecimalType(nullable, std::min(precision, kMaxPrecision), scale);
+    }
+    case KnownOperator::Mul: {
+      const uint32_t scale = std::min(s1 + s2, kMaxPrecision);
+      return DecimalType(nullable, std::min(p1 + p2 + 1, kMaxPrecision), scale);
+    }
+    case KnownOperator::Div: {
+      uint32_t scale = std::max(6u, s1 + p2 + 1);
+      const uint32_t integral = p1 - s1 + s2;
+      if (integral + scale > kMaxPrecision) {
+        const uint32_t min_scale = std::min(scale, 6u);
+        scale = std::max(min_scale, kMaxPrecision - std::min(integral, kMaxPrecision));
+      }
+      return DecimalType(nullable, std::min(integral + scale, kMaxPrecision), scale);
+    }
+    default:
+      UNREACHABLE("Not a decimal arithmetic operator.");
+  }
+}
+
 bool Type::operator==(const Type &that) const {
   if (type_id_ != that.GetTypeId()) {
     return false;
@@ -100,7 +135,7 @@ TypeId Type::GetPrimitiveTypeId() const {
     case SqlTypeId::Double:
       return TypeId::Double;
     case SqlTypeId::Decimal:
-      return TypeId::Double;
+      return numeric_info_.precision <= Decimal64::kMaxPrecision ? TypeId::BigInt : TypeId::HugeInt;
     case SqlTypeId::Date:
       return TypeId::Date;
     case SqlTypeId::Timestamp:
@@ -1,5 +1,6 @@
 #include "sql/vector.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <limits>
@@ -16,7 +17,12 @@
 namespace tpl::sql {
 
 Vector::Vector(TypeId type)
-    : type_(type), count_(0), num_elements_(0), data_(nullptr), tid_list_(nullptr) {
+    : type_(type),
+      count_(0),
+      num_elements_(0),
+      data_(nullptr),
+      tid_list_(nullptr),
+      no_nulls_(true) {
   // Since vector capacity can never exceed kDefaultVectorSize, we reserve upon
   // creation to remove allocations as the vector is resized.
   null_mask_.Reserve(kDefaultVectorSize);
@@ -24,7 +30,12 @@ Vector::Vector(TypeId type)
 }
 
 Vector::Vector(TypeId type, bool create_data, bool clear)
-    : type_(type), count_(0), num_elements_(0), data_(nullptr), tid_list_(nullptr) {
+    : type_(type),
+      count_(0),
+      num_elements_(0),
+      data_(nullptr),
+      tid_list_(nullptr),
+      no_nulls_(true) {
   // Since vector capacity can never exceed kDefaultVectorSize, we reserve upon
   // creation to remove allocations as the vector is resized.
   null_mask_.Reserve(kDefaultVectorSize);
@@ -59,6 +70,7 @@ void Vector::Destroy() {
   num_elements_ = 0;
   tid_list_ = nullptr;
   null_mask_.Reset();
+  no_nulls_ = true;
 }
 
 GenericValue Vector::GetValue(const uint32_t index) const {
@@ -98,6 +110,9 @@ GenericValue Vector::GetValue(const uint32_t index) const {
     case TypeId::Date: {
       return GenericValue::CreateDate(reinterpret_cast<Date *>(data_)[actual_index]);
     }
+    case TypeId::Timestamp: {
+      return GenericValue::CreateTimestamp(reinterpret_cast<Timestamp *>(data_)[actual_index]);
+    }
     case TypeId::Varchar: {
       const auto &varlen_str = reinterpret_cast<const VarlenEntry *>(data_)[actual_index];
       TPL_ASSERT(varlen_str.GetContent() != nullptr, "Null string in position not marked NULL!");
@@ -165,6 +180,11 @@ void Vector::SetValue(const uint32_t index, const GenericValue &val) {
       reinterpret_cast<Date *>(data_)[actual_index] = new_date;
       break;
     }
+    case TypeId::Timestamp: {
+      const auto new_timestamp = val.IsNull() ? Timestamp() : val.value_.timestamp_;
+      reinterpret_cast<Timestamp *>(data_)[actual_index] = new_timestamp;
+      break;
+    }
     case TypeId::Hash: {
       const auto new_hash = val.IsNull() ? 0 : val.value_.hash;
       reinterpret_cast<hash_t *>(data_)[actual_index] = new_hash;
@@ -235,6 +255,10 @@ void Vector::Reference(GenericValue *value) {
       data_ = reinterpret_cast<byte *>(&value->value_.date_);
       break;
     }
+    case TypeId::Timestamp: {
+      data_ = reinterpret_cast<byte *>(&value->value_.timestamp_);
+      break;
+    }
     case TypeId::Hash: {
       data_ = reinterpret_cast<byte *>(&value->value_.hash);
       break;
@@ -266,13 +290,16 @@ void Vector::Reference(byte *data, const uint32_t *null_mask, uint32_t size) {
   tid_list_ = nullptr;
   null_mask_.Resize(num_elements_);
 
+  // Column segments without NULLs don't provide a NULL bitmap.
   // TODO(pmenon): Optimize me if this is a bottleneck
   if (null_mask == nullptr) {
     null_mask_.Reset();
+    no_nulls_ = true;
   } else {
     for (uint32_t i = 0; i < size; i++) {
       null_mask_[i] = util::BitUtil::Test(null_mask, i);
     }
+    no_nulls_ = null_mask_.None();
   }
 }
 
@@ -284,6 +311,7 @@ void Vector::Reference(const Vector *other) {
   data_ = other->data_;
   tid_list_ = other->tid_list_;
   null_mask_ = other->null_mask_;
+  no_nulls_ = other->no_nulls_;
 }
 
 void Vector::Pack() {
@@ -300,9 +328,6 @@ void Vector::GetNonNullSelections(TupleIdList *non_null_tids, TupleIdList *null_
   non_null_tids->Resize(GetSize());
   null_tids->Resize(GetSize());
 
-  // Copy NULLs directly
-  null_tids->GetMutableBits()->Copy(null_mask_);
-
   // Copy selections
   if (tid_list_ != nullptr) {
     non_null_tids->AssignFrom(*tid_list_);
@@ -310,11 +335,44 @@ void Vector::GetNonNullSelections(TupleIdList *non_null_tids, TupleIdList *null_
     non_null_tids->AddAll();
   }
 
+  if (no_nulls_) {
+    null_tids->Clear();
+    return;
+  }
+
+  // Copy NULLs directly
+  null_tids->GetMutableBits()->Copy(null_mask_);
+
   // Ensure NULL list only refers to selected TIDs
-  null_tids->GetMutableBits()->Intersect(*non_null_tids->GetMutableBits());
+  null_tids->IntersectWith(*non_null_tids);
 
   // Remove NULLs from filtered TIDs
-  non_null_tids->GetMutableBits()->Difference(null_mask_);
+  non_null_tids->UnsetFrom(null_mask_);
+}
+
+void Vector::SetNullMaskFrom(std::initializer_list<const Vector *> inputs) {
+  // If this vector is an input with NULLs, its mask is the starting point. Otherwise, start from
+  // the first input that may have NULLs.
+  const bool self_has_nulls =
+      !no_nulls_ && std::find(inputs.begin(), inputs.end(), this) != inputs.end();
+  bool empty = !self_has_nulls;
+  for (const Vector *input : inputs) {
+    if (input == this || input->no_nulls_) {
+      continue;
+    }
+    TPL_ASSERT(input->num_elements_ == num_elements_, "Mismatched vector sizes");
+    if (empty) {
+      null_mask_.Copy(input->null_mask_);
+      empty = false;
+    } else {
+      null_mask_.Union(input->null_mask_);
+    }
+  }
+
+  if (empty) {
+    null_mask_.Reset();
+  }
+  no_nulls_ = empty;
 }
 
 void Vector::MoveTo(Vector *other) {
@@ -325,6 +383,7 @@ void Vector::MoveTo(Vector *other) {
   other->data_ = data_;
   other->tid_list_ = tid_list_;
   other->null_mask_ = std::move(null_mask_);
+  other->no_nulls_ = no_nulls_;
   other->owned_data_ = std::move(owned_data_);
   other->varlen_heap_ = std::move(varlen_heap_);
 
@@ -340,6 +399,7 @@ void Vector::Clone(Vector *target) {
   target->num_elements_ = num_elements_;
   target->tid_list_ = tid_list_;
   target->null_mask_.Copy(null_mask_);
+  target->no_nulls_ = no_nulls_;
 
   if (IsTypeFixedSize(type_)) {
     std::memcpy(target->GetData(), GetData(), GetTypeIdSize(type_) * num_elements_);
@@ -0,0 +1,348 @@
+#include "sql/vector_calibration.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "common/cpu_info.h"
+#include "common/defer.h"
+#include "common/exception.h"
+#include "logging/logger.h"
+#include "sql/constant_vector.h"
+#include "sql/generic_value.h"
+#include "sql/tuple_id_list.h"
+#include "sql/vector.h"
+#include "sql/vector_operations/vector_operations.h"
+#include "util/timer.h"
+
+namespace tpl::sql {
+
+namespace {
+
+// The number of selectivities sampled, evenly spaced in [0, 1].
+constexpr uint32_t kNumSelectivities = 21;
+
+// Each measurement is the best of this many trials ...
+constexpr uint32_t kNumTrials = 5;
+
+// ... each of which times this many kernel invocations.
+constexpr uint32_t kRunsPerTrial = 16;
+
+// The number of sweeps over all selectivities. A strategy wins at a selectivity only if it wins in
+// a majority of sweeps, so a single noisy measurement can't move the crossover.
+constexpr uint32_t kNumSweeps = 3;
+
+// The types each typed kernel is calibrated for.
+constexpr std::array<TypeId, 3> kCalibrationTypes = {TypeId::Integer, TypeId::BigInt,
+                                                     TypeId::Double};
+
+// The name of each calibrated setting, as it appears in the cache file.
+constexpr std::array<std::pair<Settings::Name, const char *>, 5> kSettingNames = {{
+    {Settings::Name::FullSelectOptThreshold, "FullSelectOptThreshold"},
+    {Settings::Name::FullSelectBetweenOptThreshold, "FullSelectBetweenOptThreshold"},
+    {Settings::Name::FullHashOptThreshold, "FullHashOptThreshold"},
+    {Settings::Name::ArithmeticFullComputeOptThreshold, "ArithmeticFullComputeOptThreshold"},
+    {Settings::Name::BitDensityThresholdForAVXIndexDecode, "BitDensityThresholdForAVXIndexDecode"},
+}};
+
+// The seed for all random inputs, so calibration is repeatable.
+constexpr uint32_t kSeed = 42;
+
+const char *GetSettingName(Settings::Name setting) {
+  for (const auto &[name, str] : kSettingNames) {
+    if (name == setting) return str;
+  }
+  UNREACHABLE("Setting is not calibrated");
+}
+
+double SelectivityAt(uint32_t i) { return static_cast<double>(i) / (kNumSelectivities - 1); }
+
+GenericValue MakeValue(TypeId type, int64_t value) {
+  switch (type) {
+    case TypeId::Integer:
+      return GenericValue::CreateInteger(static_cast<int32_t>(value));
+    case TypeId::BigInt:
+      return GenericValue::CreateBigInt(value);
+    case TypeId::Double:
+      return GenericValue::CreateDouble(static_cast<double>(value));
+    default:
+      throw InvalidTypeException(type, "Type is not calibrated");
+  }
+}
+
+// Create a full vector of the given type with random values in [0, 100).
+std::unique_ptr<Vector> MakeRandomVector(TypeId type, std::mt19937 *gen) {
+  std::uniform_int_distribution<int64_t> dist(0, 99);
+  auto vec = std::make_unique<Vector>(type, true, true);
+  vec->Resize(kDefaultVectorSize);
+  for (uint32_t i = 0; i < kDefaultVectorSize; i++) {
+    vec->SetValue(i, MakeValue(type, dist(*gen)));
+  }
+  return vec;
+}
+
+// Populate the TID list with a random subset of its TIDs with the given selectivity.
+void MakeRandomTids(double selectivity, std::mt19937 *gen, TupleIdList *tids) {
+  std::vector<uint32_t> all(tids->GetCapacity());
+  std::iota(all.begin(), all.end(), 0u);
+  std::shuffle(all.begin(), all.end(), *gen);
+  tids->Clear();
+  const auto count = static_cast<uint32_t>(std::lround(selectivity * all.size()));
+  for (uint32_t i = 0; i < count; i++) {
+    tids->Add(all[i]);
+  }
+}
+
+// Find the lowest sampled selectivity from which the full-computation strategy of a kernel is never
+// slower than the selective strategy in a majority of sweeps. The strategy is chosen by forcing
+// the kernel's threshold setting to 'full_value' or 'selective_value'. The kernel 'run' is invoked
+// with the TIDs of the input at each selectivity.
+template <typename F>
+double FindCrossover(Settings::Name setting, double full_value, double selective_value, F &&run) {
+  auto settings = Settings::Instance();
+  const double original = settings->GetDouble(setting);
+  DEFER(settings->Set(setting, original));
+
+  const auto time_best = [&](TupleIdList *tids) {
+    double best = std::numeric_limits<double>::max();
+    for (uint32_t trial = 0; trial < kNumTrials; trial++) {
+      best = std::min(best, util::TimeNanos([&] {
+                        for (uint32_t i = 0; i < kRunsPerTrial; i++) run(tids);
+                      }));
+    }
+    return best;
+  };
+
+  // Each sweep measures every selectivity once, so a transient disturbance affects at most one
+  // sweep at any selectivity.
+  std::array<uint32_t, kNumSelectivities> full_win_count{};
+  for (uint32_t sweep = 0; sweep < kNumSweeps; sweep++) {
+    std::mt19937 gen(kSeed);
+    TupleIdList tids(kDefaultVectorSize);
+    for (uint32_t i = 0; i < kNumSelectivities; i++) {
+      MakeRandomTids(SelectivityAt(i), &gen, &tids);
+      settings->Set(setting, full_value);
+      const double full_ns = time_best(&tids);
+      settings->Set(setting, selective_value);
+      const double selective_ns = time_best(&tids);
+      full_win_count[i] += full_ns <= selective_ns;
+    }
+  }
+
+  uint32_t crossover = kNumSelectivities;
+  while (crossover > 0 && 2 * full_win_count[crossover - 1] > kNumSweeps) {
+    crossover--;
+  }
+  return crossover == kNumSelectivities ? 1.0 : SelectivityAt(crossover);
+}
+
+// Calibrate a typed full-compute threshold. 'make_kernel' is invoked once per calibrated type, and
+// returns the kernel to time for that type.
+template <typename F>
+double CalibrateFullComputeThreshold(Settings::Name setting, F &&make_kernel) {
+  std::vector<double> crossovers;
+  for (const auto type : kCalibrationTypes) {
+    auto kernel = make_kernel(type);
+    crossovers.push_back(FindCrossover(setting, 0.0, 2.0, kernel));
+    LOG_DEBUG("Calibrated {} for {}: {:.2f}", GetSettingName(setting), TypeIdToString(type),
+              crossovers.back());
+  }
+  std::sort(crossovers.begin(), crossovers.end());
+  return crossovers[crossovers.size() / 2];
+}
+
+double CalibrateSelect() {
+  return CalibrateFullComputeThreshold(Settings::Name::FullSelectOptThreshold, [](TypeId type) {
+    std::mt19937 gen(kSeed);
+    std::shared_ptr<Vector> left = MakeRandomVector(type, &gen);
+    std::shared_ptr<Vector> right = MakeRandomVector(type, &gen);
+    auto scratch = std::make_shared<TupleIdList>(kDefaultVectorSize);
+    return [=](TupleIdList *tids) {
+      scratch->AssignFrom(*tids);
+      VectorOps::SelectLessThan(*left, *right, scratch.get());
+    };
+  });
+}
+
+double CalibrateSelectBetween() {
+  return CalibrateFullComputeThreshold(
+      Settings::Name::FullSelectBetweenOptThreshold, [](TypeId type) {
+        std::mt19937 gen(kSeed);
+        std::shared_ptr<Vector> input = MakeRandomVector(type, &gen);
+        auto lower = std::make_shared<ConstantVector>(MakeValue(type, 25));
+        auto upper = std::make_shared<ConstantVector>(MakeValue(type, 75));
+        auto scratch = std::make_shared<TupleIdList>(kDefaultVectorSize);
+        return [=](TupleIdList *tids) {
+          scratch->AssignFrom(*tids);
+          VectorOps::SelectBetween(*input, *lower, *upper, true, false, scratch.get());
+        };
+      });
+}
+
+double CalibrateHash() {
+  return CalibrateFullComputeThreshold(Settings::Name::FullHashOptThreshold, [](TypeId type) {
+    std::mt19937 gen(kSeed);
+    std::shared_ptr<Vector> input = MakeRandomVector(type, &gen);
+    auto result = std::make_shared<Vector>(TypeId::Hash, true, false);
+    return [=](TupleIdList *tids) {
+      input->SetFilteredTupleIdList(tids, tids->GetTupleCount());
+      VectorOps::Hash(*input, result.get());
+    };
+  });
+}
+
+double CalibrateArithmetic() {
+  return CalibrateFullComputeThreshold(
+      Settings::Name::ArithmeticFullComputeOptThreshold, [](TypeId type) {
+        std::mt19937 gen(kSeed);
+        std::shared_ptr<Vector> left = MakeRandomVector(type, &gen);
+        std::shared_ptr<Vector> right = MakeRandomVector(type, &gen);
+        auto result = std::make_shared<Vector>(type, true, false);
+        return [=](TupleIdList *tids) {
+          const auto count = tids->GetTupleCount();
+          left->SetFilteredTupleIdList(tids, count);
+          right->SetFilteredTupleIdList(tids, count);
+          VectorOps::Add(*left, *right, result.get());
+        };
+      });
+}
+
+double CalibrateBitDensity() {
+  // Bit vectors below the threshold density are decoded with the sparse algorithm. Thus,
+  // "full" computation is the dense SIMD algorithm, forced with a negative threshold.
+  sel_t sel_vec[kDefaultVectorSize];
+  volatile uint32_t count = 0;
+  return FindCrossover(Settings::Name::BitDensityThresholdForAVXIndexDecode, -1.0, 2.0,
+                       [&](TupleIdList *tids) { count = tids->ToSelectionVector(sel_vec); });
+}
+
+}  // namespace
+
+VectorCalibration::Thresholds VectorCalibration::Calibrate() {
+  util::Timer<std::milli> timer;
+  timer.Start();
+
+  Thresholds thresholds;
+  thresholds[Settings::Name::FullSelectOptThreshold] = CalibrateSelect();
+  thresholds[Settings::Name::FullSelectBetweenOptThreshold] = CalibrateSelectBetween();
+  thresholds[Settings::Name::FullHashOptThreshold] = CalibrateHash();
+  thresholds[Settings::Name::ArithmeticFullComputeOptThreshold] = CalibrateArithmetic();
+  thresholds[Settings::Name::BitDensityThresholdForAVXIndexDecode] = CalibrateBitDensity();
+
+  timer.Stop();
+  LOG_INFO("Calibrated vector kernel thresholds in {:.2f} ms", timer.GetElapsed());
+
+  return thresholds;
+}
+
+void VectorCalibration::Apply(const Thresholds &thresholds) {
+  for (const auto &[name, value] : thresholds) {
+    Settings::Instance()->Set(name, value);
+  }
+}
+
+std::optional<VectorCalibration::Thresholds> VectorCalibration::Load(const std::string &path,
+                                                                     const std::string &cpu_model) {
+  std::ifstream file(path);
+  if (!file) {
+    return std::nullopt;
+  }
+
+  std::optional<Thresholds> result;
+  bool in_section = false;
+  for (std::string line; std::getline(file, line);) {
+    if (line.empty() || line[0] == '#') continue;
+    if (line.front() == '[' && line.back() == ']') {
+      in_section = line.substr(1, line.size() - 2) == cpu_model;
+      if (in_section) result.emplace();
+      continue;
+    }
+    if (!in_section) continue;
+
+    // Setting lines look like: NAME = VALUE
+    const auto eq = line.find('=');
+    if (eq == std::string::npos) continue;
+    std::string key = line.substr(0, eq);
+    key.erase(key.find_last_not_of(' ') + 1);
+    for (const auto &[name, str] : kSettingNames) {
+      if (key == str) {
+        (*result)[name] = std::strtod(line.c_str() + eq + 1, nullptr);
+      }
+    }
+  }
+  return result;
+}
+
+void VectorCalibration::Store(const std::string &path, const std::string &cpu_model,
+                              const Thresholds &thresholds) {
+  // Retain all lines of the existing file, except those in this model's section.
+  std::vector<std::string> lines;
+  if (std::ifstream file(path); file) {
+    bool in_section = false;
+    for (std::string line; std::getline(file, line);) {
+      if (!line.empty() && line.front() == '[' && line.back() == ']') {
+        in_section = line.substr(1, line.size() - 2) == cpu_model;
+      }
+      if (!in_section) lines.push_back(line);
+    }
+  }
+
+  if (const auto dir = std::filesystem::path(path).parent_path(); !dir.empty()) {
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+  }
+
+  std::ofstream file(path, std::ios::trunc);
+  if (!file) {
+    throw Exception(ExceptionType::File, "Unable to write calibration file '" + path + "'");
+  }
+  if (lines.empty()) {
+    file << "# Vector kernel thresholds, calibrated per CPU model. See sql/vector_calibration.h."
+         << std::endl;
+  }
+  for (const auto &line : lines) {
+    file << line << std::endl;
+  }
+  file << "[" << cpu_model << "]" << std::endl;
+  for (const auto &[name, str] : kSettingNames) {
+    if (auto iter = thresholds.find(name); iter != thresholds.end()) {
+      file << str << " = " << iter->second << std::endl;
+    }
+  }
+}
+
+std::string VectorCalibration::GetCachePath() {
+  if (const char *path = std::getenv("TPL_CALIBRATION_FILE")) {
+    return path;
+  }
+  const char *home = std::getenv("HOME");
+  return std::string(home != nullptr ? home : ".") + "/.tpl/vector_calibration.conf";
+}
+
+bool VectorCalibration::LoadCached() {
+  const auto path = GetCachePath();
+  const auto &cpu_model = CpuInfo::Instance()->GetModelName();
+  if (auto thresholds = Load(path, cpu_model)) {
+    Apply(*thresholds);
+    LOG_INFO("Loaded vector kernel thresholds for '{}' from '{}'", cpu_model, path);
+    return true;
+  }
+  return false;
+}
+
+VectorCalibration::Thresholds VectorCalibration::CalibrateAndStore() {
+  auto thresholds = Calibrate();
+  Apply(thresholds);
+  Store(GetCachePath(), CpuInfo::Instance()->GetModelName(), thresholds);
+  return thresholds;
+}
+
+}  // namespace tpl::sql
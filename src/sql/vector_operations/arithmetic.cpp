@@ -1,9 +1,15 @@
 #include "sql/vector_operations/vector_operations.h"
 
+#include <algorithm>
+
+#include "spdlog/fmt/fmt.h"
+
 #include "common/exception.h"
 #include "common/settings.h"
 #include "sql/operators/numeric_binary_operators.h"
+#include "sql/type.h"
 #include "sql/vector_operations/binary_operation_executor.h"
+#include "util/arithmetic_overflow.h"
 
 namespace tpl::sql {
 
@@ -58,7 +64,7 @@ void TemplatedDivModOperation_Constant_Vector(const Vector &left, const Vector &
   if (left.IsNull(0)) {
     VectorOps::FillNull(result);
   } else {
-    result->GetMutableNullMask()->Copy(right.GetNullMask());
+    result->SetNullMaskFrom({&right});
 
     VectorOps::Exec(right, [&](uint64_t i, uint64_t k) {
       if (right_data[i] == T(0)) {
@@ -83,7 +89,7 @@ void TemplatedDivModOperation_Vector_Constant(const Vector &left, const Vector &
   if (right.IsNull(0)) {
     VectorOps::FillNull(result);
   } else {
-    result->GetMutableNullMask()->Copy(left.GetNullMask());
+    result->SetNullMaskFrom({&left});
 
     VectorOps::Exec(left, [&](uint64_t i, uint64_t k) {
       if (left_data[i] == T(0)) {
@@ -103,7 +109,7 @@ void TemplatedDivModOperation_Vector_Vector(const Vector &left, const Vector &ri
   auto *result_data = reinterpret_cast<T *>(result->GetData());
 
   result->Resize(left.GetSize());
-  result->GetMutableNullMask()->Copy(left.GetNullMask()).Union(right.GetNullMask());
+  result->SetNullMaskFrom({&left, &right});
   result->SetFilteredTupleIdList(left.GetFilteredTupleIdList(), left.GetCount());
 
   VectorOps::Exec(left, [&](uint64_t i, uint64_t k) {
@@ -147,6 +153,9 @@ void DivModOperation(const Vector &left, const Vector &right, Vector *result) {
     case TypeId::BigInt:
       XTemplatedDivModOperation<int64_t, Op>(left, right, result);
       break;
+    case TypeId::HugeInt:
+      XTemplatedDivModOperation<int128_t, Op>(left, right, result);
+      break;
     case TypeId::Float:
       XTemplatedDivModOperation<float, Op>(left, right, result);
       break;
@@ -183,6 +192,9 @@ void BinaryArithmeticOperation(const Vector &left, const Vector &right, Vector *
     case TypeId::BigInt:
       TemplatedBinaryArithmeticOperation<int64_t, Op>(left, right, result);
       break;
+    case TypeId::HugeInt:
+      TemplatedBinaryArithmeticOperation<int128_t, Op>(left, right, result);
+      break;
     case TypeId::Float:
       TemplatedBinaryArithmeticOperation<float, Op>(left, right, result);
       break;
@@ -197,6 +209,181 @@ void BinaryArithmeticOperation(const Vector &left, const Vector &right, Vector *
   }
 }
 
+// ---------------------------------------------------------
+// Decimal arithmetic
+// ---------------------------------------------------------
+
+// Decimal operations widen both inputs to the result's storage type and scale them as needed.
+// Overflow is accumulated into a flag rather than branched on to keep the loops vectorizable; it
+// is reported once the whole vector has been processed. Every result is also checked against the
+// precision of the result type, i.e., its magnitude must stay below 'limit'.
+
+template <typename L, typename R, typename Res, bool Subtract>
+struct DecimalAddOp {
+  Res left_factor, right_factor, limit;
+  bool *overflow;
+
+  Res operator()(const L &a, const R &b) const {
+    Res x, y, r;
+    bool o = util::ArithmeticOverflow::Mul<Res>(static_cast<Res>(a), left_factor, &x);
+    o |= util::ArithmeticOverflow::Mul<Res>(static_cast<Res>(b), right_factor, &y);
+    if constexpr (Subtract) {
+      o |= util::ArithmeticOverflow::Sub<Res>(x, y, &r);
+    } else {
+      o |= util::ArithmeticOverflow::Add<Res>(x, y, &r);
+    }
+    *overflow |= o | (r >= limit) | (r <= -limit);
+    return r;
+  }
+};
+
+template <typename L, typename R, typename Res>
+struct DecimalMultiplyOp {
+  Res limit;
+  bool *overflow;
+
+  Res operator()(const L &a, const R &b) const {
+    Res r;
+    const bool o = util::ArithmeticOverflow::Mul<Res>(static_cast<Res>(a), static_cast<Res>(b), &r);
+    *overflow |= o | (r >= limit) | (r <= -limit);
+    return r;
+  }
+};
+
+template <typename L, typename R, typename Res>
+struct DecimalDivideOp {
+  Res numerator_factor, denominator_factor, limit;
+  bool *overflow;
+
+  Res operator()(const L &a, const R &b) const {
+    Res n, d;
+    bool o = util::ArithmeticOverflow::Mul<Res>(static_cast<Res>(a), numerator_factor, &n);
+    o |= util::ArithmeticOverflow::Mul<Res>(static_cast<Res>(b), denominator_factor, &d);
+    if (d == 0) {
+      // Division by zero results in NULL, set by the caller.
+      return 0;
+    }
+    // Round half away from zero.
+    Res q = n / d;
+    const Res abs_rem = n % d < 0 ? -(n % d) : n % d, abs_d = d < 0 ? -d : d;
+    if (abs_rem >= abs_d - abs_rem) {
+      q += (n < 0) != (d < 0) ? -1 : 1;
+    }
+    *overflow |= o | (q >= limit) | (q <= -limit);
+    return q;
+  }
+};
+
+// Invoke 'f' with a value of the native type used to store decimals with primitive type 'type_id'.
+template <typename F>
+void DispatchDecimalStorage(const TypeId type_id, F &&f) {
+  switch (type_id) {
+    case TypeId::BigInt:
+      f(int64_t{});
+      break;
+    case TypeId::HugeInt:
+      f(int128_t{});
+      break;
+    default:
+      throw InvalidTypeException(type_id, "Invalid storage type for decimal arithmetic");
+  }
+}
+
+template <typename L, typename R, typename Res>
+void TemplatedDecimalOperation(KnownOperator op, const Vector &left, const Type &left_type,
+                               const Vector &right, const Type &right_type, Vector *result,
+                               const Type &result_type) {
+  using Dec = Decimal<Res>;
+  const uint32_t s1 = left_type.GetScale(), s2 = right_type.GetScale();
+  const uint32_t scale = result_type.GetScale();
+  const Res limit = Dec::PowerOfTen(result_type.GetPrecision());
+  bool overflow = false;
+
+  switch (op) {
+    case KnownOperator::Add:
+      BinaryOperationExecutor::Execute<L, R, Res, DecimalAddOp<L, R, Res, false>, true>(
+          left, right, result,
+          DecimalAddOp<L, R, Res, false>{Dec::PowerOfTen(scale - s1), Dec::PowerOfTen(scale - s2),
+                                         limit, &overflow});
+      break;
+    case KnownOperator::Sub:
+      BinaryOperationExecutor::Execute<L, R, Res, DecimalAddOp<L, R, Res, true>, true>(
+          left, right, result,
+          DecimalAddOp<L, R, Res, true>{Dec::PowerOfTen(scale - s1), Dec::PowerOfTen(scale - s2),
+                                        limit, &overflow});
+      break;
+    case KnownOperator::Mul:
+      if (scale != s1 + s2) {
+        throw Exception(ExceptionType::Decimal,
+                        fmt::format("scale of product exceeds {} digits", Dec::kMaxPrecision));
+      }
+      BinaryOperationExecutor::Execute<L, R, Res, DecimalMultiplyOp<L, R, Res>, true>(
+          left, right, result, DecimalMultiplyOp<L, R, Res>{limit, &overflow});
+      break;
+    case KnownOperator::Div: {
+      // (a / 10^s1) / (b / 10^s2) * 10^scale = (a * 10^(scale + s2 - s1)) / b
+      const int32_t exp = static_cast<int32_t>(scale + s2) - static_cast<int32_t>(s1);
+      const Res numerator_factor = Dec::PowerOfTen(std::max(exp, 0));
+      const Res denominator_factor = Dec::PowerOfTen(std::max(-exp, 0));
+      BinaryOperationExecutor::Execute<L, R, Res, DecimalDivideOp<L, R, Res>, true>(
+          left, right, result,
+          DecimalDivideOp<L, R, Res>{numerator_factor, denominator_factor, limit, &overflow});
+      // Division by zero produces NULL.
+      const auto *right_data = reinterpret_cast<const R *>(right.GetData());
+      if (right.IsConstant()) {
+        if (!right.IsNull(0) && right_data[0] == 0) VectorOps::FillNull(result);
+      } else {
+        VectorOps::Exec(*result, [&](uint64_t i, uint64_t k) {
+          if (right_data[i] == 0) result->GetMutableNullMask()->Set(i);
+        });
+      }
+      break;
+    }
+    default:
+      UNREACHABLE("Not a decimal arithmetic operator.");
+  }
+
+  if (overflow) {
+    throw Exception(ExceptionType::Decimal,
+                    fmt::format("numeric field overflow: result of {} exceeds {}",
+                                KnownOperatorToString(op, false),
+                                result_type.ToStringWithoutNullability()));
+  }
+}
+
+void DecimalOperation(KnownOperator op, const Vector &left, const Type &left_type,
+                      const Vector &right, const Type &right_type, Vector *result) {
+  if (left_type.GetTypeId() != SqlTypeId::Decimal || right_type.GetTypeId() != SqlTypeId::Decimal) {
+    throw Exception(ExceptionType::Decimal, "inputs to decimal arithmetic must be decimals");
+  }
+  const Type result_type = Type::DecimalArithmeticResultType(op, left_type, right_type);
+  if (left.GetTypeId() != left_type.GetPrimitiveTypeId()) {
+    throw TypeMismatchException(left.GetTypeId(), left_type.GetPrimitiveTypeId(),
+                                "left input vector doesn't match its decimal type");
+  }
+  if (right.GetTypeId() != right_type.GetPrimitiveTypeId()) {
+    throw TypeMismatchException(right.GetTypeId(), right_type.GetPrimitiveTypeId(),
+                                "right input vector doesn't match its decimal type");
+  }
+  if (result->GetTypeId() != result_type.GetPrimitiveTypeId()) {
+    throw TypeMismatchException(result->GetTypeId(), result_type.GetPrimitiveTypeId(),
+                                "result vector doesn't match the decimal result type");
+  }
+  if (!left.IsConstant() && !right.IsConstant() && left.GetCount() != right.GetCount()) {
+    throw Exception(ExceptionType::Cardinality,
+                    "left and right input vectors to binary operation must have the same size");
+  }
+
+  DispatchDecimalStorage(left.GetTypeId(), [&](auto l) {
+    DispatchDecimalStorage(right.GetTypeId(), [&](auto r) {
+      DispatchDecimalStorage(result->GetTypeId(), [&](auto res) {
+        TemplatedDecimalOperation<decltype(l), decltype(r), decltype(res)>(
+            op, left, left_type, right, right_type, result, result_type);
+      });
+    });
+  });
+}
+
 }  // namespace
 
 void VectorOps::Add(const Vector &left, const Vector &right, Vector *result) {
@@ -219,4 +406,24 @@ void VectorOps::Modulo(const Vector &left, const Vector &right, Vector *result)
   DivModOperation<tpl::sql::Modulo>(left, right, result);
 }
 
+void VectorOps::DecimalAdd(const Vector &left, const Type &left_type, const Vector &right,
+                           const Type &right_type, Vector *result) {
+  DecimalOperation(KnownOperator::Add, left, left_type, right, right_type, result);
+}
+
+void VectorOps::DecimalSubtract(const Vector &left, const Type &left_type, const Vector &right,
+                                const Type &right_type, Vector *result) {
+  DecimalOperation(KnownOperator::Sub, left, left_type, right, right_type, result);
+}
+
+void VectorOps::DecimalMultiply(const Vector &left, const Type &left_type, const Vector &right,
+                                const Type &right_type, Vector *result) {
+  DecimalOperation(KnownOperator::Mul, left, left_type, right, right_type, result);
+}
+
+void VectorOps::DecimalDivide(const Vector &left, const Type &left_type, const Vector &right,
+                              const Type &right_type, Vector *result) {
+  DecimalOperation(KnownOperator::Div, left, left_type, right, right_type, result);
+}
+
 }  // namespace tpl::sql
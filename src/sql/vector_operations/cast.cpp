@@ -115,6 +115,9 @@ void CastStringOperation(const Vector &source, Vector *target, SqlTypeId target_
     case SqlTypeId::Double:
       StandardTemplatedCastOperation<VarlenEntry, double, true>(source, target);
       break;
+    case SqlTypeId::Date:
+      StandardTemplatedCastOperation<VarlenEntry, Date, true>(source, target);
+      break;
     default:
       throw NotImplementedException(fmt::format("unsupported cast: {} -> {}",
                                                 TypeIdToString(source.GetTypeId()),
@@ -37,7 +37,12 @@ void VectorOps::Copy(const Vector &source, Vector *target) {
   // Resize the target to the count of the source.
   target->Resize(source.GetCount());
   // Copy NULLs.
-  Exec(source, [&](uint64_t i, uint64_t k) { target->null_mask_[k] = source.null_mask_[i]; });
+  if (source.no_nulls_) {
+    target->null_mask_.Reset();
+  } else {
+    Exec(source, [&](uint64_t i, uint64_t k) { target->null_mask_[k] = source.null_mask_[i]; });
+  }
+  target->no_nulls_ = source.no_nulls_;
   // Copy data.
   switch (source.GetTypeId()) {
     case TypeId::Boolean:
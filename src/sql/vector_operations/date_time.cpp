@@ -0,0 +1,305 @@
+#include "sql/vector_operations/vector_operations.h"
+
+#include <algorithm>
+#include <array>
+
+#include "common/exception.h"
+#include "sql/runtime_types.h"
+#include "sql/vector_operations/binary_operation_executor.h"
+#include "sql/vector_operations/unary_operation_executor.h"
+
+namespace tpl::sql {
+
+namespace {
+
+/**
+ * Precomputed calendar tables to split Julian day numbers into their components, and to build them
+ * back, with a handful of table lookups instead of full calendar math. The tables cover the years
+ * [kMinYear, kMaxYear), which is a few KB and includes practically all business data. Days outside
+ * this range fall back to the general Date routines.
+ */
+class Calendar {
+ public:
+  static constexpr int32_t kMinYear = 1700;
+  static constexpr int32_t kMaxYear = 2300;
+  static constexpr int32_t kNumYears = kMaxYear - kMinYear;
+
+  static const Calendar &Get() {
+    static const Calendar kCalendar;
+    return kCalendar;
+  }
+
+  /**
+   * Split the Julian day @em jd into its year, month (1-12), day (1-31) and day of the year
+   * (1-366).
+   */
+  void Split(const int32_t jd, int32_t *year, int32_t *month, int32_t *day,
+             int32_t *day_of_year) const {
+    if (TPL_UNLIKELY(jd < year_start_[0] || jd >= year_start_[kNumYears])) {
+      const auto date = Date::FromNative(jd);
+      date.ExtractComponents(year, month, day);
+      *day_of_year = jd - Date::FromYMD(*year, 1, 1).ToNative() + 1;
+      return;
+    }
+
+    // Estimate the year using the average length of a year in the Gregorian cycle. The estimate
+    // is off by at most one in either direction.
+    const int32_t offset = jd - year_start_[0];
+    int32_t idx = static_cast<int32_t>(int64_t{offset} * 400 / 146097);
+    idx -= jd < year_start_[idx];
+    idx += jd >= year_start_[idx + 1];
+
+    const int32_t start = year_start_[idx];
+    const int32_t leap = year_start_[idx + 1] - start - 365;
+    const int32_t doy = jd - start;
+    const int32_t m = month_of_day_[leap][doy];
+    *year = kMinYear + idx;
+    *month = m;
+    *day = doy - month_start_[leap][m - 1] + 1;
+    *day_of_year = doy + 1;
+  }
+
+  /**
+   * @return The Julian day of the given valid date.
+   */
+  int32_t MakeJulianDay(const int32_t year, const int32_t month, const int32_t day) const {
+    if (TPL_UNLIKELY(year < kMinYear || year >= kMaxYear)) {
+      return Date::FromYMD(year, month, day).ToNative();
+    }
+    return year_start_[year - kMinYear] + month_start_[IsLeapYear(year)][month - 1] + day - 1;
+  }
+
+  /**
+   * @return The number of days in the given month of the given year.
+   */
+  int32_t DaysInMonth(const int32_t year, const int32_t month) const {
+    const auto &month_start = month_start_[IsLeapYear(year)];
+    return month_start[month] - month_start[month - 1];
+  }
+
+ private:
+  static constexpr bool IsLeapYear(const int32_t year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  }
+
+  Calendar() {
+    for (int32_t i = 0; i < kNumYears + 2; i++) {
+      year_start_[i] = Date::FromYMD(kMinYear + i, 1, 1).ToNative();
+    }
+    constexpr int32_t kDaysPerMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    for (int32_t leap = 0; leap < 2; leap++) {
+      month_start_[leap][0] = 0;
+      for (int32_t m = 1; m <= 12; m++) {
+        const int32_t days = kDaysPerMonth[m - 1] + (leap && m == 2);
+        month_start_[leap][m] = month_start_[leap][m - 1] + days;
+        for (int32_t d = month_start_[leap][m - 1]; d < month_start_[leap][m]; d++) {
+          month_of_day_[leap][d] = m;
+        }
+      }
+    }
+  }
+
+ private:
+  // The Julian day of January 1st of each year in the range, plus sentinels for the end of range.
+  std::array<int32_t, kNumYears + 2> year_start_;
+  // The (1-based) month of each (0-based) day of the year, for regular and leap years.
+  uint8_t month_of_day_[2][366];
+  // The (0-based) day of the year each month starts on, and the length of the year.
+  int32_t month_start_[2][13];
+};
+
+// The Julian day of a date or timestamp.
+int32_t JulianDay(const Date date) { return date.ToNative(); }
+int32_t JulianDay(const Timestamp ts) {
+  return static_cast<int32_t>(static_cast<int64_t>(ts.ToNative()) / kMicroSecondsPerDay);
+}
+
+// A date or timestamp at the start of the given Julian day.
+template <typename T>
+T FromJulianDay(const int32_t jd) {
+  if constexpr (std::is_same_v<T, Date>) {
+    return Date::FromNative(jd);
+  } else {
+    return Timestamp::FromNative(static_cast<uint64_t>(jd) * kMicroSecondsPerDay);
+  }
+}
+
+template <DatePart Part>
+int32_t Extract(const Calendar &calendar, const int32_t jd) {
+  if constexpr (Part == DatePart::DayOfWeek) {
+    // Julian day 0 was a Monday.
+    const int32_t dow = (jd + 1) % 7;
+    return dow < 0 ? dow + 7 : dow;
+  } else {
+    int32_t year, month, day, day_of_year;
+    calendar.Split(jd, &year, &month, &day, &day_of_year);
+    if constexpr (Part == DatePart::Year) {
+      return year;
+    } else if constexpr (Part == DatePart::Quarter) {
+      return (month - 1) / 3 + 1;
+    } else if constexpr (Part == DatePart::Month) {
+      return month;
+    } else if constexpr (Part == DatePart::Day) {
+      return day;
+    } else {
+      return day_of_year;
+    }
+  }
+}
+
+template <typename T, DatePart Part>
+void TemplatedExtractOperation(const Vector &input, Vector *result) {
+  const auto &calendar = Calendar::Get();
+  UnaryOperationExecutor::Execute<T, int32_t, true>(
+      input, result, [&](const T val) { return Extract<Part>(calendar, JulianDay(val)); });
+}
+
+template <typename T>
+void ExtractOperation(const Vector &input, const DatePart part, Vector *result) {
+  switch (part) {
+    case DatePart::Year:
+      TemplatedExtractOperation<T, DatePart::Year>(input, result);
+      break;
+    case DatePart::Quarter:
+      TemplatedExtractOperation<T, DatePart::Quarter>(input, result);
+      break;
+    case DatePart::Month:
+      TemplatedExtractOperation<T, DatePart::Month>(input, result);
+      break;
+    case DatePart::Day:
+      TemplatedExtractOperation<T, DatePart::Day>(input, result);
+      break;
+    case DatePart::DayOfWeek:
+      TemplatedExtractOperation<T, DatePart::DayOfWeek>(input, result);
+      break;
+    case DatePart::DayOfYear:
+      TemplatedExtractOperation<T, DatePart::DayOfYear>(input, result);
+      break;
+  }
+}
+
+template <typename T, DatePart Part>
+void TemplatedTruncOperation(const Vector &input, Vector *result) {
+  const auto &calendar = Calendar::Get();
+  UnaryOperationExecutor::Execute<T, T, true>(input, result, [&](const T val) {
+    const int32_t jd = JulianDay(val);
+    if constexpr (Part == DatePart::Day) {
+      return FromJulianDay<T>(jd);
+    } else {
+      int32_t year, month, day, day_of_year;
+      calendar.Split(jd, &year, &month, &day, &day_of_year);
+      if constexpr (Part == DatePart::Year) {
+        return FromJulianDay<T>(jd - day_of_year + 1);
+      } else if constexpr (Part == DatePart::Quarter) {
+        return FromJulianDay<T>(calendar.MakeJulianDay(year, (month - 1) / 3 * 3 + 1, 1));
+      } else {
+        return FromJulianDay<T>(jd - day + 1);
+      }
+    }
+  });
+}
+
+template <typename T>
+void TruncOperation(const Vector &input, const DatePart part, Vector *result) {
+  switch (part) {
+    case DatePart::Year:
+      TemplatedTruncOperation<T, DatePart::Year>(input, result);
+      break;
+    case DatePart::Quarter:
+      TemplatedTruncOperation<T, DatePart::Quarter>(input, result);
+      break;
+    case DatePart::Month:
+      TemplatedTruncOperation<T, DatePart::Month>(input, result);
+      break;
+    case DatePart::Day:
+      TemplatedTruncOperation<T, DatePart::Day>(input, result);
+      break;
+    default:
+      throw NotImplementedException("dates can only be truncated to a year, quarter, month or day");
+  }
+}
+
+void CheckDateTimeInput(const Vector &input) {
+  if (input.GetTypeId() != TypeId::Date && input.GetTypeId() != TypeId::Timestamp) {
+    throw InvalidTypeException(input.GetTypeId(), "input must be a date or timestamp");
+  }
+}
+
+// Check:
+// 1. The dates are dates, and the amounts integers.
+// 2. Input vectors have the same shape.
+// 3. The result is a date.
+void CheckDateAddOperation(const Vector &dates, const Vector &amounts, Vector *result) {
+  if (dates.GetTypeId() != TypeId::Date) {
+    throw TypeMismatchException(dates.GetTypeId(), TypeId::Date, "input must be a date");
+  }
+  if (amounts.GetTypeId() != TypeId::Integer) {
+    throw TypeMismatchException(amounts.GetTypeId(), TypeId::Integer,
+                                "amount to add to dates must be an integer");
+  }
+  if (result->GetTypeId() != TypeId::Date) {
+    throw TypeMismatchException(result->GetTypeId(), TypeId::Date, "result must be a date");
+  }
+  if (!dates.IsConstant() && !amounts.IsConstant() && dates.GetCount() != amounts.GetCount()) {
+    throw Exception(ExceptionType::Cardinality,
+                    "dates and amounts to add to them must have the same size");
+  }
+}
+
+}  // namespace
+
+void VectorOps::DateExtract(const Vector &input, const DatePart part, Vector *result) {
+  CheckDateTimeInput(input);
+  if (result->GetTypeId() != TypeId::Integer) {
+    throw TypeMismatchException(result->GetTypeId(), TypeId::Integer,
+                                "result of date extraction must be an integer");
+  }
+
+  if (input.GetTypeId() == TypeId::Date) {
+    ExtractOperation<Date>(input, part, result);
+  } else {
+    ExtractOperation<Timestamp>(input, part, result);
+  }
+}
+
+void VectorOps::DateTrunc(const Vector &input, const DatePart part, Vector *result) {
+  CheckDateTimeInput(input);
+  if (result->GetTypeId() != input.GetTypeId()) {
+    throw TypeMismatchException(input.GetTypeId(), result->GetTypeId(),
+                                "result of date truncation must have the same type as the input");
+  }
+
+  if (input.GetTypeId() == TypeId::Date) {
+    TruncOperation<Date>(input, part, result);
+  } else {
+    TruncOperation<Timestamp>(input, part, result);
+  }
+}
+
+void VectorOps::DateAddDays(const Vector &dates, const Vector &days, Vector *result) {
+  CheckDateAddOperation(dates, days, result);
+  const auto add_days = [](const Date date, const int32_t n) {
+    return Date::FromNative(date.ToNative() + n);
+  };
+  BinaryOperationExecutor::Execute<Date, int32_t, Date, decltype(add_days), true>(dates, days,
+                                                                                 result, add_days);
+}
+
+void VectorOps::DateAddMonths(const Vector &dates, const Vector &months, Vector *result) {
+  CheckDateAddOperation(dates, months, result);
+  const auto &calendar = Calendar::Get();
+  const auto add_months = [&](const Date date, const int32_t n) {
+    int32_t year, month, day, day_of_year;
+    calendar.Split(date.ToNative(), &year, &month, &day, &day_of_year);
+    // Count 0-based months from year zero, flooring negative results.
+    const int32_t total = year * 12 + (month - 1) + n;
+    const int32_t new_year = total >= 0 ? total / 12 : (total - 11) / 12;
+    const int32_t new_month = total - new_year * 12 + 1;
+    const int32_t new_day = std::min(day, calendar.DaysInMonth(new_year, new_month));
+    return Date::FromNative(calendar.MakeJulianDay(new_year, new_month, new_day));
+  };
+  BinaryOperationExecutor::Execute<Date, int32_t, Date, decltype(add_months), true>(
+      dates, months, result, add_months);
+}
+
+}  // namespace tpl::sql
@@ -72,6 +72,9 @@ void VectorOps::Fill(Vector *vector, const GenericValue &value) {
   }
 }
 
-void VectorOps::FillNull(Vector *vector) { vector->null_mask_.SetAll(); }
+void VectorOps::FillNull(Vector *vector) {
+  vector->null_mask_.SetAll();
+  vector->no_nulls_ = false;
+}
 
 }  // namespace tpl::sql
@@ -70,7 +70,7 @@ template <typename T, typename Op>
 void TemplatedGatherAndSelectOperation_Vector(const Vector &input, const Vector &pointers,
                                               const std::size_t offset, TupleIdList *tid_list) {
   // Strip out NULL inputs now to avoid checking in the loop.
-  tid_list->GetMutableBits()->Difference(input.GetNullMask());
+  if (!input.HasNoNulls()) tid_list->UnsetFrom(input.GetNullMask());
 
   // Check.
   const auto *RESTRICT raw_inputs = reinterpret_cast<T *>(input.GetData());
@@ -1,10 +1,14 @@
 #include "sql/vector_operations/vector_operations.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "spdlog/fmt/fmt.h"
 
 #include "common/exception.h"
 #include "common/settings.h"
 #include "sql/operators/hash_operators.h"
+#include "sql/tuple_id_list.h"
 #include "sql/vector_operations/traits.h"
 
 namespace tpl::sql {
@@ -103,6 +107,75 @@ void TemplatedHashCombineOperation(const Vector &input, Vector *result) {
   }
 }
 
+// Hash, or combine into the running hashes in @em hashes, the elements of the input at the TIDs in
+// the selection vector @em sel. A NULL selection vector means hash the first @em n elements.
+template <typename InputType, bool Combine>
+void TemplatedHashColumn(const Vector &input, const sel_t *sel, const uint32_t n,
+                         hash_t *RESTRICT hashes) {
+  auto *RESTRICT input_data = reinterpret_cast<const InputType *>(input.GetData());
+
+  const auto hash = [&](const uint64_t i, const bool null) {
+    if constexpr (Combine) {
+      hashes[i] = tpl::sql::HashCombine<InputType>{}(input_data[i], null, hashes[i]);
+    } else {
+      hashes[i] = tpl::sql::Hash<InputType>{}(input_data[i], null);
+    }
+  };
+
+  const auto for_each = [&](auto &&f) {
+    if (sel == nullptr) {
+      for (uint32_t i = 0; i < n; i++) f(i);
+    } else {
+      for (uint32_t k = 0; k < n; k++) f(sel[k]);
+    }
+  };
+
+  if (const auto &null_mask = input.GetNullMask(); null_mask.Any()) {
+    for_each([&](const uint64_t i) { hash(i, null_mask[i]); });
+  } else {
+    for_each([&](const uint64_t i) { hash(i, false); });
+  }
+}
+
+template <bool Combine>
+void HashColumn(const Vector &input, const sel_t *sel, const uint32_t n, hash_t *hashes) {
+  switch (input.GetTypeId()) {
+    case TypeId::Boolean:
+      TemplatedHashColumn<bool, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::TinyInt:
+      TemplatedHashColumn<int8_t, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::SmallInt:
+      TemplatedHashColumn<int16_t, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::Integer:
+      TemplatedHashColumn<int32_t, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::BigInt:
+      TemplatedHashColumn<int64_t, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::Float:
+      TemplatedHashColumn<float, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::Double:
+      TemplatedHashColumn<double, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::Date:
+      TemplatedHashColumn<Date, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::Timestamp:
+      TemplatedHashColumn<Timestamp, Combine>(input, sel, n, hashes);
+      break;
+    case TypeId::Varchar:
+      TemplatedHashColumn<VarlenEntry, Combine>(input, sel, n, hashes);
+      break;
+    default:
+      throw NotImplementedException(
+          fmt::format("hashing vector type '{}'", TypeIdToString(input.GetTypeId())));
+  }
+}
+
 }  // namespace
 
 void VectorOps::Hash(const Vector &input, Vector *result) {
@@ -189,4 +262,47 @@ void VectorOps::HashCombine(const Vector &input, Vector *result) {
   }
 }
 
+void VectorOps::Hash(const std::vector<const Vector *> &inputs, Vector *result) {
+  TPL_ASSERT(!inputs.empty(), "Must provide at least one vector to hash.");
+
+  // Sanity check
+  const Vector &first = *inputs[0];
+  CheckHashArguments(first, result);
+  for (const Vector *input : inputs) {
+    if (input->GetSize() != first.GetSize() ||
+        input->GetFilteredTupleIdList() != first.GetFilteredTupleIdList()) {
+      throw Exception(ExceptionType::Cardinality, "All vectors to hash must have the same shape");
+    }
+  }
+
+  result->Resize(first.GetSize());
+  result->GetMutableNullMask()->Reset();
+  result->SetFilteredTupleIdList(first.GetFilteredTupleIdList(), first.GetCount());
+
+  // Decode the active TIDs once for all inputs. As in Hash(), when enough TIDs are active and all
+  // inputs are cheap to hash, it's faster to hash all elements and skip the decoding.
+  sel_t sel[kDefaultVectorSize];
+  const sel_t *active = nullptr;
+  uint32_t n = first.GetSize();
+  if (const TupleIdList *tid_list = first.GetFilteredTupleIdList(); tid_list != nullptr) {
+    const bool all_numeric = std::none_of(inputs.begin(), inputs.end(), [](const Vector *input) {
+      return input->GetTypeId() == TypeId::Varchar;
+    });
+    const double full_compute_threshold =
+        Settings::Instance()->GetDouble(Settings::Name::FullHashOptThreshold);
+    if (!tid_list->IsFull() &&
+        !(all_numeric && full_compute_threshold <= tid_list->ComputeSelectivity())) {
+      n = tid_list->ToSelectionVector(sel);
+      active = sel;
+    }
+  }
+
+  // Lift-off
+  auto *hashes = reinterpret_cast<hash_t *>(result->GetData());
+  HashColumn<false>(first, active, n, hashes);
+  for (uint32_t i = 1; i < inputs.size(); i++) {
+    HashColumn<true>(*inputs[i], active, n, hashes);
+  }
+}
+
 }  // namespace tpl::sql
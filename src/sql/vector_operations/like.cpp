@@ -21,7 +21,7 @@ void TemplatedLikeOperation_Vector_Constant(const Vector &a, const Vector &b,
   const auto *RESTRICT b_data = reinterpret_cast<const VarlenEntry *>(b.GetData());
 
   // Remove NULL entries from the left input
-  tid_list->GetMutableBits()->Difference(a.GetNullMask());
+  if (!a.HasNoNulls()) tid_list->UnsetFrom(a.GetNullMask());
 
   // Lift-off
   tid_list->Filter([&](const uint64_t i) { return Op{}(a_data[i], b_data[0]); });
@@ -36,7 +36,8 @@ void TemplatedLikeOperation_Vector_Vector(const Vector &a, const Vector &b, Tupl
   const auto *RESTRICT b_data = reinterpret_cast<const VarlenEntry *>(b.GetData());
 
   // Remove NULL entries in both left and right inputs (cheap)
-  tid_list->GetMutableBits()->Difference(a.GetNullMask()).Difference(b.GetNullMask());
+  if (!a.HasNoNulls()) tid_list->UnsetFrom(a.GetNullMask());
+  if (!b.HasNoNulls()) tid_list->UnsetFrom(b.GetNullMask());
 
   // Lift-off
   tid_list->Filter([&](const uint64_t i) { return Op{}(a_data[i], b_data[i]); });
@@ -6,12 +6,16 @@ namespace tpl::sql {
 
 void VectorOps::IsNull(const Vector &input, TupleIdList *tid_list) {
   TPL_ASSERT(input.GetSize() == tid_list->GetCapacity(), "Input vector size != TID list size");
-  tid_list->GetMutableBits()->Intersect(input.GetNullMask());
+  if (input.HasNoNulls()) {
+    tid_list->Clear();
+  } else {
+    tid_list->IntersectWith(input.GetNullMask());
+  }
 }
 
 void VectorOps::IsNotNull(const Vector &input, TupleIdList *tid_list) {
   TPL_ASSERT(input.GetSize() == tid_list->GetCapacity(), "Input vector size != TID list size");
-  tid_list->GetMutableBits()->Difference(input.GetNullMask());
+  if (!input.HasNoNulls()) tid_list->UnsetFrom(input.GetNullMask());
 }
 
 }  // namespace tpl::sql
@@ -0,0 +1,252 @@
+#include "sql/vector_operations/vector_operations.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <string_view>
+
+#include "common/exception.h"
+
+namespace tpl::sql {
+
+namespace {
+
+/**
+ * Compute a string result for every active, non-NULL element in a vector. Results are produced in
+ * two passes over the active elements. The first pass computes the length of every result, through
+ * @em length_fn, to size a single buffer for all results that are too large to inline into their
+ * VarlenEntry. The second pass writes the contents of each result, through @em write_fn, either
+ * into a small stack buffer that is copied into the VarlenEntry, or into the batch buffer. Thus,
+ * there is at most one allocation per call.
+ *
+ * @pre The shape and NULL mask of the result vector must have been set up by the caller.
+ *
+ * @tparam LengthFn Functor invokable as: <code>uint32_t len = f(uint64_t i)</code>.
+ * @tparam WriteFn Functor invokable as: <code>f(uint64_t i, char *out)</code>.
+ * @param result The vector to write string results into.
+ * @param length_fn Functor computing the length of the result for the element at a given TID.
+ * @param write_fn Functor writing the contents of the result for the element at a given TID.
+ */
+template <typename LengthFn, typename WriteFn>
+void StringOperation(Vector *result, LengthFn &&length_fn, WriteFn &&write_fn) {
+  constexpr uint32_t kInlineThreshold = VarlenEntry::GetInlineThreshold();
+
+  auto *RESTRICT result_data = reinterpret_cast<VarlenEntry *>(result->GetData());
+  const auto &null_mask = result->GetNullMask();
+
+  // First pass: size the buffer for all results that don't fit inline.
+  std::size_t total_len = 0;
+  VectorOps::Exec(*result, [&](uint64_t i, uint64_t k) {
+    if (!null_mask[i]) {
+      const uint32_t len = length_fn(i);
+      total_len += len > kInlineThreshold ? len : 0;
+    }
+  });
+
+  char *buffer = total_len == 0 ? nullptr : result->GetMutableStringHeap()->PreAllocate(total_len);
+
+  // Second pass: write results.
+  char inline_buffer[kInlineThreshold];
+  VectorOps::Exec(*result, [&](uint64_t i, uint64_t k) {
+    if (null_mask[i]) {
+      return;
+    }
+    const uint32_t len = length_fn(i);
+    if (len <= kInlineThreshold) {
+      write_fn(i, inline_buffer);
+      result_data[i] = VarlenEntry::Create(reinterpret_cast<const byte *>(inline_buffer), len);
+    } else {
+      write_fn(i, buffer);
+      result_data[i] = VarlenEntry::Create(reinterpret_cast<const byte *>(buffer), len);
+      buffer += len;
+    }
+  });
+}
+
+// Like StringOperation(), but for operations whose results are a slice of their input. The slice
+// function is invokable as: <code>std::string_view slice = f(std::string_view input)</code>.
+template <typename SliceFn>
+void SliceOperation(const Vector &input, Vector *result, SliceFn &&slice_fn) {
+  const auto *RESTRICT input_data = reinterpret_cast<const VarlenEntry *>(input.GetData());
+  StringOperation(
+      result, [&](uint64_t i) { return slice_fn(input_data[i].GetStringView()).size(); },
+      [&](uint64_t i, char *out) {
+        const auto slice = slice_fn(input_data[i].GetStringView());
+        std::memcpy(out, slice.data(), slice.size());
+      });
+}
+
+// Convert ASCII letters in the input to the desired case. Other bytes, including all bytes of
+// multi-byte UTF-8 sequences, are copied unchanged, matching ::toupper() and ::tolower() in the
+// "C" locale. Sixteen bytes are converted at a time.
+template <bool ToUpper>
+void ConvertCase(const char *RESTRICT input, const uint32_t len, char *RESTRICT output) {
+  // The first letter of the case to convert from. Letters are converted by flipping their 0x20 bit.
+  constexpr char kFirst = ToUpper ? 'a' : 'A';
+
+  uint32_t i = 0;
+
+  // Main vector loop. Bytes are compared as signed, so non-ASCII bytes are never in range.
+  const auto lower_bound = _mm_set1_epi8(kFirst - 1);
+  const auto upper_bound = _mm_set1_epi8(kFirst + 26);
+  const auto flip = _mm_set1_epi8(0x20);
+  for (; i + 16 <= len; i += 16) {
+    const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+    const auto in_range =
+        _mm_and_si128(_mm_cmpgt_epi8(chars, lower_bound), _mm_cmplt_epi8(chars, upper_bound));
+    const auto converted = _mm_xor_si128(chars, _mm_and_si128(in_range, flip));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), converted);
+  }
+
+  // Tail
+  for (; i < len; i++) {
+    const auto c = static_cast<uint8_t>(input[i]);
+    output[i] = static_cast<char>(c ^ (static_cast<uint8_t>(c - kFirst) < 26 ? 0x20 : 0));
+  }
+}
+
+template <bool ToUpper>
+void CaseOperation(const Vector &input, Vector *result) {
+  const auto *RESTRICT input_data = reinterpret_cast<const VarlenEntry *>(input.GetData());
+  StringOperation(
+      result, [&](uint64_t i) { return input_data[i].GetSize(); },
+      [&](uint64_t i, char *out) {
+        const auto &str = input_data[i];
+        ConvertCase<ToUpper>(reinterpret_cast<const char *>(str.GetContent()), str.GetSize(), out);
+      });
+}
+
+template <bool TrimLeft, bool TrimRight>
+void TrimOperation(const Vector &input, const Vector &chars, Vector *result) {
+  if (!chars.IsConstant()) {
+    throw Exception(ExceptionType::Execution, "Characters to trim must be a constant");
+  }
+  if (chars.IsNull(0)) {
+    result->GetMutableNullMask()->SetAll();
+    return;
+  }
+
+  // Build the set of characters to trim once for the whole vector.
+  std::bitset<256> trim_set;
+  for (const auto c : reinterpret_cast<const VarlenEntry *>(chars.GetData())[0].GetStringView()) {
+    trim_set.set(static_cast<uint8_t>(c));
+  }
+
+  SliceOperation(input, result, [&](std::string_view str) {
+    std::size_t begin = 0, end = str.size();
+    if constexpr (TrimLeft) {
+      while (begin < end && trim_set.test(static_cast<uint8_t>(str[begin]))) begin++;
+    }
+    if constexpr (TrimRight) {
+      while (begin < end && trim_set.test(static_cast<uint8_t>(str[end - 1]))) end--;
+    }
+    return str.substr(begin, end - begin);
+  });
+}
+
+void CheckStringInput(const Vector &input) {
+  if (input.GetTypeId() != TypeId::Varchar) {
+    throw InvalidTypeException(input.GetTypeId(), "Input to string function must be VARCHAR");
+  }
+}
+
+// Check:
+// 1. The input and result vectors are strings.
+// Then, set up the result to have the same shape and NULLs as the input.
+void PrepareUnaryStringOperation(const Vector &input, Vector *result) {
+  CheckStringInput(input);
+  if (result->GetTypeId() != TypeId::Varchar) {
+    throw TypeMismatchException(result->GetTypeId(), TypeId::Varchar,
+                                "Result of string function must be VARCHAR");
+  }
+  result->Resize(input.GetSize());
+  result->SetNullMaskFrom({&input});
+  result->SetFilteredTupleIdList(input.GetFilteredTupleIdList(), input.GetCount());
+}
+
+}  // namespace
+
+void VectorOps::Upper(const Vector &input, Vector *result) {
+  PrepareUnaryStringOperation(input, result);
+  CaseOperation<true>(input, result);
+}
+
+void VectorOps::Lower(const Vector &input, Vector *result) {
+  PrepareUnaryStringOperation(input, result);
+  CaseOperation<false>(input, result);
+}
+
+void VectorOps::Substring(const Vector &input, const int64_t pos, const int64_t len,
+                          Vector *result) {
+  PrepareUnaryStringOperation(input, result);
+
+  // A negative length is an error, and produces NULL like StringFunctions::Substring().
+  if (len < 0) {
+    result->GetMutableNullMask()->SetAll();
+    return;
+  }
+
+  SliceOperation(input, result, [&](std::string_view str) {
+    // The result is the 1-based range [pos, pos + len), clamped to the bounds of the string.
+    const auto size = static_cast<int64_t>(str.size());
+    const auto begin = std::clamp<int64_t>(pos, 1, size + 1);
+    const auto end = std::clamp<int64_t>(pos + std::min(len, size + 1), begin, size + 1);
+    return str.substr(begin - 1, end - begin);
+  });
+}
+
+void VectorOps::Trim(const Vector &input, const Vector &chars, Vector *result) {
+  PrepareUnaryStringOperation(input, result);
+  TrimOperation<true, true>(input, chars, result);
+}
+
+void VectorOps::Ltrim(const Vector &input, const Vector &chars, Vector *result) {
+  PrepareUnaryStringOperation(input, result);
+  TrimOperation<true, false>(input, chars, result);
+}
+
+void VectorOps::Rtrim(const Vector &input, const Vector &chars, Vector *result) {
+  PrepareUnaryStringOperation(input, result);
+  TrimOperation<false, true>(input, chars, result);
+}
+
+void VectorOps::Concat(const Vector &left, const Vector &right, Vector *result) {
+  CheckStringInput(left);
+  CheckStringInput(right);
+  if (result->GetTypeId() != TypeId::Varchar) {
+    throw TypeMismatchException(result->GetTypeId(), TypeId::Varchar,
+                                "Result of string function must be VARCHAR");
+  }
+  if (!left.IsConstant() && !right.IsConstant() && left.GetCount() != right.GetCount()) {
+    throw Exception(ExceptionType::Cardinality, "Inputs to CONCAT() must have the same size");
+  }
+
+  // The result takes the shape of the non-constant input, if any. Like StringFunctions::Concat(),
+  // NULL inputs are treated as empty strings, so the result never contains NULLs.
+  const Vector &shape = left.IsConstant() ? right : left;
+  result->Resize(shape.GetSize());
+  result->GetMutableNullMask()->Reset();
+  result->SetFilteredTupleIdList(shape.GetFilteredTupleIdList(), shape.GetCount());
+
+  const auto *RESTRICT left_data = reinterpret_cast<const VarlenEntry *>(left.GetData());
+  const auto *RESTRICT right_data = reinterpret_cast<const VarlenEntry *>(right.GetData());
+  const auto get = [](const Vector &input, const VarlenEntry *data, uint64_t i) {
+    const uint64_t idx = input.IsConstant() ? 0 : i;
+    return input.GetNullMask()[idx] ? std::string_view("") : data[idx].GetStringView();
+  };
+
+  StringOperation(
+      result,
+      [&](uint64_t i) {
+        return get(left, left_data, i).size() + get(right, right_data, i).size();
+      },
+      [&](uint64_t i, char *out) {
+        const auto l = get(left, left_data, i), r = get(right, right_data, i);
+        std::memcpy(out, l.data(), l.size());
+        std::memcpy(out + l.size(), r.data(), r.size());
+      });
+}
+
+}  // namespace tpl::sql
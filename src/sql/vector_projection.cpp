@@ -1,5 +1,6 @@
 #include "sql/vector_projection.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <numeric>
@@ -10,6 +11,7 @@
 #include "sql/tuple_id_list.h"
 #include "sql/vector.h"
 #include "sql/vector_operations/vector_operations.h"
+#include "util/bit_util.h"
 
 namespace tpl::sql {
 
@@ -24,6 +26,7 @@ void VectorProjection::InitializeEmpty(const std::vector<TypeId> &col_types) {
   for (uint32_t i = 0; i < col_types.size(); i++) {
     columns_[i] = std::make_unique<Vector>(col_types[i]);
   }
+  deferred_columns_.assign(col_types.size(), nullptr);
 
   // Reset the cached TID list to NULL indicating all TIDs are active.
   filter_ = nullptr;
@@ -71,6 +74,47 @@ void VectorProjection::RefreshFilteredTupleIdList() {
   }
 }
 
+void VectorProjection::DeferColumn(const uint32_t col_idx, const ColumnVectorIterator *source) {
+  TPL_ASSERT(col_idx < GetColumnCount(), "Out-of-bounds column access");
+  TPL_ASSERT(owned_buffer_ == nullptr, "Only referencing projections can defer columns");
+  TPL_ASSERT(source->GetTupleCount() == GetTotalTupleCount(),
+             "Deferred column size doesn't match projection size");
+  deferred_columns_[col_idx] = source;
+}
+
+void VectorProjection::LoadDeferredColumn(const uint32_t col_idx) const {
+  const ColumnVectorIterator *source = deferred_columns_[col_idx];
+  deferred_columns_[col_idx] = nullptr;
+
+  // The column's count tracks the projection's selected count even while it's
+  // deferred. Grab it before referencing the column data resets it.
+  Vector *col = columns_[col_idx].get();
+  const uint32_t count = col->GetCount();
+  const uint32_t *null_bitmap = source->GetColumnNullBitmap();
+
+  if (filter_ == nullptr || null_bitmap == nullptr) {
+    col->Reference(source->GetColumnData(), null_bitmap, source->GetTupleCount());
+  } else {
+    // Only copy the NULL bits of the tuples that survived filtering.
+    col->Reference(source->GetColumnData(), nullptr, source->GetTupleCount());
+    filter_->ForEach([&](const uint64_t i) {
+      if (util::BitUtil::Test(null_bitmap, i)) {
+        col->SetNull(i, true);
+      }
+    });
+  }
+
+  col->SetFilteredTupleIdList(filter_, count);
+}
+
+void VectorProjection::LoadDeferredColumns() const {
+  for (uint32_t i = 0; i < deferred_columns_.size(); i++) {
+    if (deferred_columns_[i] != nullptr) {
+      LoadDeferredColumn(i);
+    }
+  }
+}
+
 void VectorProjection::SetFilteredSelections(const TupleIdList &tid_list) {
   TPL_ASSERT(tid_list.GetCapacity() == owned_tid_list_.GetCapacity(),
              "Input TID list capacity doesn't match projection capacity");
@@ -91,6 +135,9 @@ void VectorProjection::Reset(uint32_t num_tuples) {
   // Reset the cached TID list to NULL indicating all TIDs are active
   filter_ = nullptr;
 
+  // Drop columns deferred for the previous contents
+  std::fill(deferred_columns_.begin(), deferred_columns_.end(), nullptr);
+
   // Setup TID list to include all tuples
   owned_tid_list_.Resize(num_tuples);
   owned_tid_list_.AddAll();
@@ -118,6 +165,8 @@ void VectorProjection::Pack() {
     return;
   }
 
+  LoadDeferredColumns();
+
   filter_ = nullptr;
   owned_tid_list_.Resize(GetSelectedTupleCount());
   owned_tid_list_.AddAll();
@@ -131,7 +180,7 @@ void VectorProjection::ProjectColumns(const std::vector<uint32_t> &cols,
                                       VectorProjection *result) const {
   std::vector<TypeId> schema(cols.size());
   for (uint32_t i = 0; i < cols.size(); i++) {
-    schema[i] = GetColumn(cols[i])->GetTypeId();
+    schema[i] = GetColumnType(cols[i]);
   }
 
   // Create the resulting projection.
@@ -149,10 +198,10 @@ void VectorProjection::ProjectColumns(const std::vector<uint32_t> &cols,
 
 void VectorProjection::Hash(const std::vector<uint32_t> &cols, Vector *result) const {
   TPL_ASSERT(!cols.empty(), "Must provide at least one column to hash.");
-  VectorOps::Hash(*GetColumn(cols[0]), result);
-  for (uint32_t i = 1; i < cols.size(); i++) {
-    VectorOps::HashCombine(*GetColumn(cols[i]), result);
-  }
+  std::vector<const Vector *> inputs(cols.size());
+  std::transform(cols.begin(), cols.end(), inputs.begin(),
+                 [this](uint32_t col_idx) { return GetColumn(col_idx); });
+  VectorOps::Hash(inputs, result);
 }
 
 void VectorProjection::Hash(Vector *result) const {
@@ -162,6 +211,7 @@ void VectorProjection::Hash(Vector *result) const {
 }
 
 std::string VectorProjection::ToString() const {
+  LoadDeferredColumns();
   std::string result = "VectorProjection(#cols=" + std::to_string(columns_.size()) + "):\n";
   for (auto &col : columns_) {
     result += "- " + col->ToString() + "\n";
@@ -189,9 +239,11 @@ void VectorProjection::CheckIntegrity() const {
                "Vector size does not match rest of projection");
   }
 
-  // Let the vectors do an integrity check
-  for (const auto &col : columns_) {
-    col->CheckIntegrity();
+  // Let the loaded vectors do an integrity check
+  for (uint32_t i = 0; i < columns_.size(); i++) {
+    if (deferred_columns_[i] == nullptr) {
+      columns_[i]->CheckIntegrity();
+    }
   }
 #endif
 }
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <csignal>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -22,8 +23,10 @@
 #include "sql/catalog.h"
 #include "sql/execution_context.h"
 #include "sql/printing_consumer.h"
+#include "sql/vector_calibration.h"
 #include "tpl.h"  // NOLINT
 #include "util/timer.h"
+#include "util/trace_recorder.h"
 #include "vm/bytecode_generator.h"
 #include "vm/bytecode_module.h"
 #include "vm/llvm_engine.h"
@@ -40,6 +43,9 @@ llvm::cl::opt<bool> kPrintAst("print-ast", llvm::cl::desc("Print the programs AS
 llvm::cl::opt<bool> kPrintTbc("print-tbc", llvm::cl::desc("Print the generated TPL Bytecode"), llvm::cl::cat(kTplOptionsCategory));  // NOLINT
 llvm::cl::opt<bool> kPrettyPrint("pretty-print", llvm::cl::desc("Pretty-print the source from the parsed AST"), llvm::cl::cat(kTplOptionsCategory));  // NOLINT
 llvm::cl::opt<bool> kIsSQL("sql", llvm::cl::desc("Is the input a SQL query?"), llvm::cl::cat(kTplOptionsCategory));  // NOLINT
+llvm::cl::opt<bool> kCalibrate("calibrate", llvm::cl::desc("Calibrate vector kernel thresholds for this machine and cache the results"), llvm::cl::cat(kTplOptionsCategory));  // NOLINT
+llvm::cl::opt<bool> kAnalyze("analyze", llvm::cl::desc("Compute statistics over all tables before running, to size runtime structures"), llvm::cl::cat(kTplOptionsCategory));  // NOLINT
+llvm::cl::opt<std::string> kTraceFile("trace", llvm::cl::desc("Write a timeline of parallel tasks to the given file, viewable in chrome://tracing"), llvm::cl::init(""), llvm::cl::cat(kTplOptionsCategory));  // NOLINT
 llvm::cl::opt<std::string> kInputFile(llvm::cl::Positional, llvm::cl::desc("<input file>"), llvm::cl::init(""), llvm::cl::cat(kTplOptionsCategory));  // NOLINT
 // clang-format on
 
@@ -284,6 +290,9 @@ void InitTPL() {
   // Catalog init
   tpl::sql::Catalog::Instance();
 
+  // Machine-specific vector kernel thresholds, if calibrated
+  tpl::sql::VectorCalibration::LoadCached();
+
   LOG_INFO("TPL Bytecode Count: {}", tpl::vm::Bytecodes::NumBytecodes());
 
   LOG_INFO("TPL initialized ...");
@@ -333,6 +342,21 @@ int main(int argc, char **argv) {
 
   LOG_INFO("Welcome to TPL (ver. {}.{})", TPL_VERSION_MAJOR, TPL_VERSION_MINOR);
 
+  // Calibrate, if requested
+  if (kCalibrate) {
+    tpl::sql::VectorCalibration::CalibrateAndStore();
+  }
+
+  // Analyze all tables, if requested
+  if (kAnalyze) {
+    tpl::sql::Catalog::Instance()->AnalyzeAllTables();
+  }
+
+  // Record a timeline, if requested
+  if (!kTraceFile.empty()) {
+    tpl::util::TraceRecorder::Instance()->Enable();
+  }
+
   // Either execute a TPL program from a source file, or run REPL
   if (!kInputFile.empty()) {
     tpl::RunFile(kInputFile);
@@ -340,6 +364,15 @@ int main(int argc, char **argv) {
     tpl::RunRepl();
   }
 
+  // Dump the timeline
+  if (!kTraceFile.empty()) {
+    std::ofstream trace_file(kTraceFile);
+    tpl::util::TraceRecorder::Instance()->Disable();
+    tpl::util::TraceRecorder::Instance()->WriteJson(trace_file);
+    LOG_INFO("Wrote {} trace events to '{}'", tpl::util::TraceRecorder::Instance()->GetEventCount(),
+             kTraceFile.getValue());
+  }
+
   // Cleanup
   tpl::ShutdownTPL();
 
@@ -0,0 +1,122 @@
+#include "util/perf_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace tpl::util {
+
+#ifdef __linux__
+
+namespace {
+
+// The perf event type and configuration of each event.
+struct EventConfig {
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr std::array<EventConfig, PerfCounters::kNumEvents> kEventConfigs = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u)},
+}};
+
+int32_t OpenEvent(const EventConfig &event, int32_t group_fd) {
+  perf_event_attr attr{};
+  attr.size = sizeof(perf_event_attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // Only the leader starts disabled. Members are scheduled along with it.
+  attr.disabled = group_fd == -1 ? 1 : 0;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int32_t>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  fds_.fill(kInvalidDescriptor);
+  fds_[0] = OpenEvent(kEventConfigs[0], -1);
+  if (fds_[0] < 0) {
+    fds_[0] = kInvalidDescriptor;
+    return;
+  }
+  for (uint32_t i = 1; i < kNumEvents; i++) {
+    if (const auto fd = OpenEvent(kEventConfigs[i], fds_[0]); fd >= 0) {
+      fds_[i] = fd;
+    }
+  }
+}
+
+PerfCounters::~PerfCounters() {
+  // Close members before the leader.
+  for (auto iter = fds_.rbegin(); iter != fds_.rend(); ++iter) {
+    if (*iter != kInvalidDescriptor) close(*iter);
+  }
+}
+
+void PerfCounters::Start() {
+  if (!IsAvailable()) return;
+  ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void PerfCounters::Stop() {
+  if (!IsAvailable()) return;
+  ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounters::Sample PerfCounters::Read() const {
+  Sample sample;
+  for (uint32_t i = 0; i < kNumEvents; i++) {
+    if (fds_[i] == kInvalidDescriptor) continue;
+    // Layout given by the read format: value, time enabled, time running.
+    uint64_t values[3] = {0, 0, 0};
+    if (read(fds_[i], values, sizeof(values)) != sizeof(values) || values[2] == 0) continue;
+    const auto scale = static_cast<double>(values[1]) / values[2];
+    sample.Set(static_cast<Event>(i), static_cast<uint64_t>(values[0] * scale));
+  }
+  return sample;
+}
+
+#else
+
+PerfCounters::PerfCounters() { fds_.fill(kInvalidDescriptor); }
+
+PerfCounters::~PerfCounters() = default;
+
+void PerfCounters::Start() {}
+
+void PerfCounters::Stop() {}
+
+PerfCounters::Sample PerfCounters::Read() const { return Sample(); }
+
+#endif
+
+const char *PerfCounters::GetEventName(Event event) {
+  switch (event) {
+    case Event::Cycles:
+      return "cycles";
+    case Event::Instructions:
+      return "instructions";
+    case Event::LLCMisses:
+      return "llc_misses";
+    case Event::BranchMisses:
+      return "branch_misses";
+    case Event::DTLBMisses:
+      return "dtlb_misses";
+  }
+  UNREACHABLE("Impossible event");
+}
+
+}  // namespace tpl::util
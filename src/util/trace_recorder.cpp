@@ -0,0 +1,114 @@
+#include "util/trace_recorder.h"
+
+#include <algorithm>
+#include <ostream>
+
+#include "spdlog/fmt/fmt.h"
+
+namespace tpl::util {
+
+/**
+ * Owns the calling thread's trace buffer, returning it to the recorder on thread exit.
+ */
+class ThreadBufferHandle {
+ public:
+  ~ThreadBufferHandle() {
+    if (buffer != nullptr) TraceRecorder::Instance()->ReleaseBuffer(buffer);
+  }
+
+  TraceRecorder::ThreadBuffer *buffer{nullptr};
+};
+
+namespace {
+
+thread_local ThreadBufferHandle tl_buffer_handle;
+
+}  // namespace
+
+TraceRecorder::TraceRecorder() : epoch_(std::chrono::steady_clock::now()) {}
+
+TraceRecorder *TraceRecorder::Instance() {
+  // Never destroyed, since threads may release their buffers during static destruction.
+  static TraceRecorder *kInstance = new TraceRecorder();
+  return kInstance;
+}
+
+TraceRecorder::ThreadBuffer *TraceRecorder::GetThreadBuffer() {
+  if (tl_buffer_handle.buffer == nullptr) {
+    tl_buffer_handle.buffer = AcquireBuffer();
+  }
+  return tl_buffer_handle.buffer;
+}
+
+TraceRecorder::ThreadBuffer *TraceRecorder::AcquireBuffer() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &buffer : buffers_) {
+    // Buffers still holding an exited thread's events are kept for the trace. Their events would
+    // otherwise be dropped, or attributed to the new thread.
+    if (!buffer->in_use && buffer->num_written.load(std::memory_order_relaxed) == 0) {
+      buffer->in_use = true;
+      buffer->id = num_thread_ids_++;
+      return buffer.get();
+    }
+  }
+  buffers_.emplace_back(std::make_unique<ThreadBuffer>(num_thread_ids_++));
+  return buffers_.back().get();
+}
+
+void TraceRecorder::ReleaseBuffer(ThreadBuffer *buffer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  buffer->in_use = false;
+}
+
+void TraceRecorder::Record(const Event &event) {
+  ThreadBuffer *buffer = GetThreadBuffer();
+  const uint64_t pos = buffer->num_written.load(std::memory_order_relaxed);
+  buffer->events[pos % kBufferCapacity] = event;
+  buffer->num_written.store(pos + 1, std::memory_order_release);
+}
+
+uint64_t TraceRecorder::GetEventCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint64_t count = 0;
+  for (const auto &buffer : buffers_) {
+    count += std::min<uint64_t>(buffer->num_written.load(std::memory_order_acquire),
+                                kBufferCapacity);
+  }
+  return count;
+}
+
+void TraceRecorder::Clear() {
+  TPL_ASSERT(!IsEnabled(), "Events can only be cleared when recording is disabled");
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &buffer : buffers_) {
+    buffer->num_written.store(0, std::memory_order_relaxed);
+  }
+}
+
+void TraceRecorder::WriteJson(std::ostream &os) const {
+  TPL_ASSERT(!IsEnabled(), "Events can only be written when recording is disabled");
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool first = true;
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  for (const auto &buffer : buffers_) {
+    const uint64_t end = buffer->num_written.load(std::memory_order_acquire);
+    const uint64_t begin = end > kBufferCapacity ? end - kBufferCapacity : 0;
+    for (uint64_t i = begin; i < end; i++) {
+      const Event &event = buffer->events[i % kBufferCapacity];
+      // Timestamps and durations are in microseconds.
+      os << (first ? "\n" : ",\n")
+         << fmt::format(R"({{"name":"{}","cat":"{}","ph":"X","pid":0,"tid":{},"ts":{:.3f},)"
+                        R"("dur":{:.3f})",
+                        event.name, event.category, buffer->id, event.start_ns / 1000.0,
+                        (event.end_ns - event.start_ns) / 1000.0);
+      if (event.arg_name != nullptr) {
+        os << fmt::format(R"(,"args":{{"{}":{}}})", event.arg_name, event.arg);
+      }
+      os << "}";
+      first = false;
+    }
+  }
+  os << "\n]}" << std::endl;
+}
+
+}  // namespace tpl::util
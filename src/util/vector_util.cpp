@@ -2,6 +2,7 @@
 
 #include <immintrin.h>
 
+#include "common/settings.h"
 #include "util/bit_util.h"
 #include "util/math_util.h"
 #include "util/vector_lookup_tables.h"
@@ -264,7 +265,7 @@ uint32_t VectorUtil::BitVectorToSelectionVector_Dense_AVX512(const uint64_t *bit
     _mm512_mask_compressstoreu_epi16(sel_vector + k, mask, indexes);
 
     // Bump indexes
-    _mm512_add_epi16(indexes, _32);
+    indexes = _mm512_add_epi16(indexes, _32);
     k += BitUtil::CountPopulation(mask);
 
     // Second word
@@ -272,7 +273,7 @@ uint32_t VectorUtil::BitVectorToSelectionVector_Dense_AVX512(const uint64_t *bit
     _mm512_mask_compressstoreu_epi16(sel_vector + k, mask, indexes);
 
     // Bump indexes again
-    _mm512_add_epi16(indexes, _32);
+    indexes = _mm512_add_epi16(indexes, _32);
     k += BitUtil::CountPopulation(mask);
   }
 
@@ -309,11 +310,11 @@ uint32_t VectorUtil::BitVectorToSelectionVector(const uint64_t *bit_vector, cons
     count += util::BitUtil::CountPopulation(bit_vector[i]);
   }
 
-  // TODO(pmenon): Use settings
-  // Sparse is defined as < 15% ones
-  const float density = static_cast<float>(count) / static_cast<float>(num_bits);
-  return density <= 0.15 ? BitVectorToSelectionVector_Sparse(bit_vector, num_bits, sel_vector)
-                         : BitVectorToSelectionVector_Dense(bit_vector, num_bits, sel_vector);
+  const double density = static_cast<double>(count) / static_cast<double>(num_bits);
+  const double threshold =
+      Settings::Instance()->GetDouble(Settings::Name::BitDensityThresholdForAVXIndexDecode);
+  return density < threshold ? BitVectorToSelectionVector_Sparse(bit_vector, num_bits, sel_vector)
+                             : BitVectorToSelectionVector_Dense(bit_vector, num_bits, sel_vector);
 }
 
 }  // namespace tpl::util
@@ -278,6 +278,12 @@ void BytecodeEmitter::EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVa
   EmitAll(bytecode, sorter, region, cmp_fn, tuple_size);
 }
 
+void BytecodeEmitter::EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVar region,
+                                     FunctionId cmp_fn, LocalVar tuple_size,
+                                     LocalVar expected_tuple_count) {
+  EmitAll(bytecode, sorter, region, cmp_fn, tuple_size, expected_tuple_count);
+}
+
 void BytecodeEmitter::EmitCSVReaderInit(LocalVar reader, LocalVar file_name,
                                         uint32_t file_name_len) {
   EmitAll(Bytecode::CSVReaderInit, reader, file_name, file_name_len);
@@ -1,6 +1,8 @@
 #include "vm/bytecode_function_info.h"
 
 #include <algorithm>
+#include <iterator>
+#include <ranges>
 
 #include "ast/type.h"
 #include "util/math_util.h"
@@ -33,12 +35,24 @@ FunctionInfo::FunctionInfo(FunctionId id, std::string name, ast::FunctionType *f
 LocalVar FunctionInfo::NewLocal(ast::Type *type, const std::string &name, LocalInfo::Kind kind) {
   TPL_ASSERT(!name.empty(), "Local name cannot be empty");
 
+  // Reuse the slot of a released local of the same type, if there is one.
+  const auto free_iter = std::find_if(free_locals_.rbegin(), free_locals_.rend(),
+                                      [&](uint32_t idx) { return locals_[idx].GetType() == type; });
+  if (free_iter != free_locals_.rend()) {
+    const auto offset = locals_[*free_iter].GetOffset();
+    free_locals_.erase(std::next(free_iter).base());
+    visible_locals_.push_back(locals_.size());
+    locals_.emplace_back(name, type, offset, kind);
+    return LocalVar(offset, LocalVar::AddressMode::Address);
+  }
+
   // Bump size to account for the alignment of the new local
   if (!util::MathUtil::IsAligned(frame_size_, type->GetAlignment())) {
     frame_size_ = util::MathUtil::AlignTo(frame_size_, type->GetAlignment());
   }
 
   const auto offset = static_cast<uint32_t>(frame_size_);
+  visible_locals_.push_back(locals_.size());
   locals_.emplace_back(name, type, offset, kind);
 
   frame_size_ += type->GetSize();
@@ -56,12 +70,34 @@ LocalVar FunctionInfo::NewParameterLocal(ast::Type *type, const std::string &nam
 LocalVar FunctionInfo::NewLocal(ast::Type *type, const std::string &name) {
   if (name.empty()) {
     const auto tmp_name = "tmp" + std::to_string(++num_temps_);
-    return NewLocal(type, tmp_name, LocalInfo::Kind::Var);
+    return NewLocal(type, tmp_name, LocalInfo::Kind::Temporary);
   }
 
   return NewLocal(type, name, LocalInfo::Kind::Var);
 }
 
+void FunctionInfo::ExitScope() {
+  TPL_ASSERT(!scope_marks_.empty(), "Unbalanced scope exit");
+  const auto first = visible_locals_.begin() + scope_marks_.back();
+  free_locals_.insert(free_locals_.end(), first, visible_locals_.end());
+  visible_locals_.erase(first, visible_locals_.end());
+  scope_marks_.pop_back();
+}
+
+void FunctionInfo::ReleaseTemporaries(const std::size_t mark) {
+  TPL_ASSERT(mark <= visible_locals_.size(), "Invalid temporaries mark");
+  // Named locals stay visible until their scope exits.
+  auto keep = visible_locals_.begin() + mark;
+  for (auto iter = keep; iter != visible_locals_.end(); ++iter) {
+    if (locals_[*iter].IsTemporary()) {
+      free_locals_.push_back(*iter);
+    } else {
+      *keep++ = *iter;
+    }
+  }
+  visible_locals_.erase(keep, visible_locals_.end());
+}
+
 LocalVar FunctionInfo::GetReturnValueLocal() const {
   // This invocation only makes sense if the function actually returns a value.
   TPL_ASSERT(!func_type_->GetReturnType()->IsNilType(),
@@ -70,8 +106,11 @@ LocalVar FunctionInfo::GetReturnValueLocal() const {
 }
 
 const LocalInfo *FunctionInfo::LookupLocalInfoByName(std::string_view name) const {
-  auto iter = std::ranges::find_if(locals_, [&](auto &info) { return info.GetName() == name; });
-  return iter == locals_.end() ? nullptr : &*iter;
+  // Search innermost scope outwards so that locals shadow earlier declarations.
+  auto visible = visible_locals_ | std::views::reverse;
+  auto iter = std::ranges::find_if(
+      visible, [&](uint32_t idx) { return locals_[idx].GetName() == name; });
+  return iter == visible.end() ? nullptr : &locals_[*iter];
 }
 
 LocalVar FunctionInfo::LookupLocal(std::string_view name) const {
@@ -171,6 +171,9 @@ void BytecodeGenerator::VisitIterationStatement(ast::IterationStatement *iterati
 }
 
 void BytecodeGenerator::VisitForStatement(ast::ForStatement *node) {
+  // The loop's initializer is scoped to the loop.
+  GetCurrentFunction()->EnterScope();
+
   LoopBuilder loop_builder(this);
 
   if (node->GetInit() != nullptr) {
@@ -192,6 +195,8 @@ void BytecodeGenerator::VisitForStatement(ast::ForStatement *node) {
   }
 
   loop_builder.JumpToHeader();
+
+  GetCurrentFunction()->ExitScope();
 }
 
 void BytecodeGenerator::VisitForInStatement(UNUSED ast::ForInStatement *node) {
@@ -377,9 +382,15 @@ void BytecodeGenerator::VisitIndexExpression(ast::IndexExpression *node) {
 }
 
 void BytecodeGenerator::VisitBlockStatement(ast::BlockStatement *node) {
+  FunctionInfo *func = GetCurrentFunction();
+  func->EnterScope();
   for (auto *stmt : node->GetStatements()) {
+    // Temporaries don't outlive the statement they were created for.
+    const std::size_t temps_mark = func->GetTemporariesMark();
     Visit(stmt);
+    func->ReleaseTemporaries(temps_mark);
   }
+  func->ExitScope();
 }
 
 void BytecodeGenerator::VisitVariableDeclaration(ast::VariableDeclaration *node) {
@@ -915,6 +926,7 @@ void BytecodeGenerator::VisitBuiltinHashCall(ast::CallExpression *call) {
         break;
       case ast::BuiltinType::TimestampVal:
         GetEmitter()->Emit(Bytecode::HashTimestamp, hash_val, input, hash_val.ValueOf());
+        break;
       default:
         UNREACHABLE("Hashing this type isn't supported!");
     }
@@ -1013,7 +1025,13 @@ void BytecodeGenerator::VisitBuiltinAggHashTableCall(ast::CallExpression *call,
       LocalVar agg_ht = VisitExpressionForRValue(call->GetArguments()[0]);
       LocalVar memory = VisitExpressionForRValue(call->GetArguments()[1]);
       LocalVar entry_size = VisitExpressionForRValue(call->GetArguments()[2]);
-      GetEmitter()->Emit(Bytecode::AggregationHashTableInit, agg_ht, memory, entry_size);
+      if (call->NumArgs() == 3) {
+        GetEmitter()->Emit(Bytecode::AggregationHashTableInit, agg_ht, memory, entry_size);
+      } else {
+        LocalVar initial_size = VisitExpressionForRValue(call->GetArguments()[3]);
+        GetEmitter()->Emit(Bytecode::AggregationHashTableInitWithSize, agg_ht, memory, entry_size,
+                           initial_size);
+      }
       break;
     }
     case ast::Builtin::AggHashTableInsert: {
@@ -1482,8 +1500,15 @@ void BytecodeGenerator::VisitBuiltinSorterCall(ast::CallExpression *call, ast::B
       const std::string cmp_func_name =
           call->GetArguments()[2]->As<ast::IdentifierExpression>()->GetName().ToString();
       LocalVar entry_size = VisitExpressionForRValue(call->GetArguments()[3]);
-      GetEmitter()->EmitSorterInit(Bytecode::SorterInit, sorter, memory,
-                                   LookupFuncIdByName(cmp_func_name), entry_size);
+      if (call->NumArgs() == 4) {
+        GetEmitter()->EmitSorterInit(Bytecode::SorterInit, sorter, memory,
+                                     LookupFuncIdByName(cmp_func_name), entry_size);
+      } else {
+        LocalVar expected_tuple_count = VisitExpressionForRValue(call->GetArguments()[4]);
+        GetEmitter()->EmitSorterInit(Bytecode::SorterInitWithSize, sorter, memory,
+                                     LookupFuncIdByName(cmp_func_name), entry_size,
+                                     expected_tuple_count);
+      }
       break;
     }
     case ast::Builtin::SorterInsert: {
@@ -1638,22 +1663,37 @@ void BytecodeGenerator::VisitCSVReaderCall(ast::CallExpression *call, ast::Built
 }
 
 void BytecodeGenerator::VisitExecutionContextCall(ast::CallExpression *call, ast::Builtin builtin) {
-  LocalVar result = GetExecutionResult()->GetOrCreateDestination(call->GetType());
   LocalVar exec_ctx = VisitExpressionForRValue(call->GetArguments()[0]);
   switch (builtin) {
     case ast::Builtin::ExecutionContextGetMemoryPool: {
+      LocalVar result = GetExecutionResult()->GetOrCreateDestination(call->GetType());
       GetEmitter()->Emit(Bytecode::ExecutionContextGetMemoryPool, result, exec_ctx);
+      GetExecutionResult()->SetDestination(result.ValueOf());
       break;
     }
     case ast::Builtin::ExecutionContextGetTLS: {
+      LocalVar result = GetExecutionResult()->GetOrCreateDestination(call->GetType());
       GetEmitter()->Emit(Bytecode::ExecutionContextGetTLS, result, exec_ctx);
+      GetExecutionResult()->SetDestination(result.ValueOf());
+      break;
+    }
+    case ast::Builtin::ExecutionContextRecordTuples: {
+      LocalVar operator_id = VisitExpressionForRValue(call->GetArguments()[1]);
+      LocalVar num_tuples = VisitExpressionForRValue(call->GetArguments()[2]);
+      GetEmitter()->Emit(Bytecode::ExecutionContextRecordTuples, exec_ctx, operator_id, num_tuples);
+      break;
+    }
+    case ast::Builtin::ExecutionContextRecordMorsels: {
+      LocalVar pipeline_id = VisitExpressionForRValue(call->GetArguments()[1]);
+      LocalVar num_morsels = VisitExpressionForRValue(call->GetArguments()[2]);
+      GetEmitter()->Emit(Bytecode::ExecutionContextRecordMorsels, exec_ctx, pipeline_id,
+                         num_morsels);
       break;
     }
     default: {
       UNREACHABLE("Impossible execution context call");
     }
   }
-  GetExecutionResult()->SetDestination(result.ValueOf());
 }
 
 void BytecodeGenerator::VisitBuiltinThreadStateContainerCall(ast::CallExpression *call,
@@ -1887,7 +1927,9 @@ void BytecodeGenerator::VisitBuiltinCallExpression(ast::CallExpression *call) {
       break;
     }
     case ast::Builtin::ExecutionContextGetMemoryPool:
-    case ast::Builtin::ExecutionContextGetTLS: {
+    case ast::Builtin::ExecutionContextGetTLS:
+    case ast::Builtin::ExecutionContextRecordTuples:
+    case ast::Builtin::ExecutionContextRecordMorsels: {
       VisitExecutionContextCall(call, builtin);
       break;
     }
@@ -1,9 +1,30 @@
 #include "vm/bytecode_handlers.h"
 
+#include <algorithm>
+
 #include "sql/catalog.h"
+#include "sql/query_profile.h"
 
 extern "C" {
 
+// ---------------------------------------------------------
+// Execution Context
+// ---------------------------------------------------------
+
+void OpExecutionContextRecordTuples(tpl::sql::ExecutionContext *exec_ctx, uint32_t operator_id,
+                                    uint64_t num_tuples) {
+  if (auto profile = exec_ctx->GetQueryProfile(); profile != nullptr) {
+    profile->RecordTuples(operator_id, num_tuples);
+  }
+}
+
+void OpExecutionContextRecordMorsels(tpl::sql::ExecutionContext *exec_ctx, uint32_t pipeline_id,
+                                     uint64_t num_morsels) {
+  if (auto profile = exec_ctx->GetQueryProfile(); profile != nullptr) {
+    profile->RecordMorsels(pipeline_id, num_morsels);
+  }
+}
+
 // ---------------------------------------------------------
 // Table Vector Iterator
 // ---------------------------------------------------------
@@ -111,6 +132,15 @@ void OpAggregationHashTableInit(tpl::sql::AggregationHashTable *const agg_hash_t
   new (agg_hash_table) tpl::sql::AggregationHashTable(memory, payload_size);
 }
 
+void OpAggregationHashTableInitWithSize(tpl::sql::AggregationHashTable *const agg_hash_table,
+                                        tpl::sql::MemoryPool *const memory,
+                                        const uint32_t payload_size, const uint32_t initial_size) {
+  // The size comes from the query, and is only an estimate.
+  new (agg_hash_table) tpl::sql::AggregationHashTable(
+      memory, payload_size,
+      std::min(initial_size, tpl::sql::AggregationHashTable::kMaxInitialTableSize));
+}
+
 void OpAggregationHashTableFree(tpl::sql::AggregationHashTable *const agg_hash_table) {
   agg_hash_table->~AggregationHashTable();
 }
@@ -148,6 +178,12 @@ void OpSorterInit(tpl::sql::Sorter *const sorter, tpl::sql::MemoryPool *const me
   new (sorter) tpl::sql::Sorter(memory, cmp_fn, tuple_size);
 }
 
+void OpSorterInitWithSize(tpl::sql::Sorter *const sorter, tpl::sql::MemoryPool *const memory,
+                          const tpl::sql::Sorter::ComparisonFunction cmp_fn,
+                          const uint32_t tuple_size, const uint32_t expected_tuple_count) {
+  new (sorter) tpl::sql::Sorter(memory, cmp_fn, tuple_size, expected_tuple_count);
+}
+
 void OpSorterSort(tpl::sql::Sorter *sorter) { sorter->Sort(); }
 
 void OpSorterSortParallel(tpl::sql::Sorter *sorter,
@@ -0,0 +1,46 @@
+#include "vm/bytecode_profile.h"
+
+#include <algorithm>
+
+#include "vm/bytecode_module.h"
+
+namespace tpl::vm {
+
+BytecodeProfile::BytecodeProfile(const BytecodeModule &module)
+    : functions_(module.GetFunctionCount()) {
+  for (const auto &func : module.GetFunctionsInfo()) {
+    FunctionProfile &func_profile = functions_[func.GetId()];
+    for (auto iter = module.GetBytecodeForFunction(func); !iter.Done(); iter.Advance()) {
+      if (Bytecodes::IsConditionalJump(iter.CurrentBytecode())) {
+        func_profile.branch_positions.push_back(iter.GetPosition());
+      }
+    }
+    func_profile.branches =
+        std::make_unique<BranchCounters[]>(func_profile.branch_positions.size());
+  }
+}
+
+BytecodeProfile::BranchCounters *BytecodeProfile::GetBranchCounters(const FunctionId func_id,
+                                                                    const std::size_t position) {
+  FunctionProfile &func_profile = functions_[func_id];
+  const auto &positions = func_profile.branch_positions;
+  const auto iter = std::lower_bound(positions.begin(), positions.end(), position);
+  if (iter == positions.end() || *iter != position) {
+    return nullptr;
+  }
+  return &func_profile.branches[std::distance(positions.begin(), iter)];
+}
+
+uint64_t BytecodeProfile::GetTotalCount() const noexcept {
+  uint64_t total = 0;
+  for (const auto &func_profile : functions_) {
+    total += func_profile.invocations.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < func_profile.branch_positions.size(); i++) {
+      const BranchCounters &counters = func_profile.branches[i];
+      total += counters.GetTakenCount() + counters.GetNotTakenCount();
+    }
+  }
+  return total;
+}
+
+}  // namespace tpl::vm
@@ -1,9 +1,15 @@
 #include <memory>
+#include <vector>
 
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Bitcode/BitcodeReader.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/IR/Constants.h"
+#include "llvm/IR/InstIterator.h"
 #include "llvm/IR/LLVMContext.h"
+#include "llvm/Linker/Linker.h"
 #include "llvm/Support/MemoryBuffer.h"
 
 #include "common/common.h"
@@ -28,16 +34,35 @@
 // Hence, this executable is run on the generated unoptimized bitcode to clean
 // it up.
 //
+// Bytecode handlers also call into runtime code (hash tables, sorters, string
+// functions, vector kernels, etc.) which is compiled into TPL and is opaque to
+// the JIT. Runtime functions marked JIT_INLINABLE are cross-compiled as well,
+// and their definitions are linked into the handler module so that the JIT can
+// inline them. Every other runtime function is left as an external declaration
+// that resolves to TPL's own copy. Since the linked definitions are duplicates
+// of code already in TPL, they must not carry state of their own: mutable
+// globals are turned into declarations so that they too resolve to TPL's copy,
+// and functions touching state that cannot be shared that way (i.e., internal
+// or thread-local globals) remain opaque.
+//
 // This executable reads the unoptimized bitcode file and:
 // 1. Converts to an LLVM Module
-// 2. Removes the static global variable
-// 3. Modifies linkage types of all defined functions to LinkOnce
-// 4. Cleans up function arguments
-// 5. Writes out optimized module as bitcode file
+// 2. Links in JIT-inlinable runtime functions from the remaining bitcode files
+// 3. Removes the static global variable
+// 4. Modifies linkage types of all defined functions to LinkOnce
+// 5. Cleans up function arguments
+// 6. Writes out optimized module as bitcode file
 //
 
 static constexpr const char *kGlobalVarName = "kAllFuncs";
 static constexpr const char *kLLVMCompiledUsed = "llvm.compiler.used";
+static constexpr const char *kLLVMUsed = "llvm.used";
+static constexpr const char *kLLVMGlobalAnnotations = "llvm.global.annotations";
+static constexpr const char *kLLVMGlobalCtors = "llvm.global_ctors";
+static constexpr const char *kLLVMGlobalDtors = "llvm.global_dtors";
+
+// Must match the annotation used by the JIT_INLINABLE macro in common/macros.h.
+static constexpr const char *kJitInlinableAnnotation = "tpl.jit_inlinable";
 
 auto ReadIntoMemory(const char *filepath) {
   auto memory_buffer = llvm::MemoryBuffer::getFile(filepath);
@@ -60,6 +85,154 @@ auto ParseIntoLLVMModule(llvm::LLVMContext *ctx, llvm::MemoryBuffer *buffer) {
   return module;
 }
 
+void EraseGlobal(llvm::Module *module, const char *name) {
+  if (auto var = module->getGlobalVariable(name, true); var != nullptr) {
+    var->eraseFromParent();
+  }
+}
+
+llvm::StringSet<> CollectJitInlinableFunctions(llvm::Module *module) {
+  // Clang records every annotated definition in a global array of structs
+  // whose first two fields are the annotated value and the annotation string.
+  llvm::StringSet<> result;
+  auto annotations = module->getGlobalVariable(kLLVMGlobalAnnotations, true);
+  if (annotations == nullptr || !annotations->hasInitializer()) {
+    return result;
+  }
+  auto array = llvm::dyn_cast<llvm::ConstantArray>(annotations->getInitializer());
+  for (uint32_t i = 0; array != nullptr && i < array->getNumOperands(); i++) {
+    auto entry = llvm::cast<llvm::ConstantStruct>(array->getOperand(i));
+    auto func = llvm::dyn_cast<llvm::Function>(entry->getOperand(0)->stripPointerCasts());
+    auto str = llvm::dyn_cast<llvm::GlobalVariable>(entry->getOperand(1)->stripPointerCasts());
+    if (func == nullptr || str == nullptr || !str->hasInitializer()) {
+      continue;
+    }
+    auto data = llvm::dyn_cast<llvm::ConstantDataSequential>(str->getInitializer());
+    if (data != nullptr && data->isCString() && data->getAsCString() == kJitInlinableAnnotation) {
+      result.insert(func->getName());
+    }
+  }
+  return result;
+}
+
+void PrepareRuntimeModule(llvm::Module *module, llvm::StringSet<> *inlinable) {
+  for (const auto &entry : CollectJitInlinableFunctions(module)) {
+    inlinable->insert(entry.getKey());
+  }
+
+  // Drop the annotations, static initializers, and force-used items. These
+  // are appended into the destination module during linking otherwise.
+  for (auto name : {kLLVMGlobalAnnotations, kLLVMGlobalCtors, kLLVMGlobalDtors, kLLVMUsed,
+                    kLLVMCompiledUsed}) {
+    EraseGlobal(module, name);
+  }
+
+  // Aliases (e.g., complete-object constructors) are always available in TPL.
+  for (auto iter = module->alias_begin(); iter != module->alias_end();) {
+    llvm::GlobalAlias &alias = *iter++;
+    if (alias.hasLocalLinkage() || !llvm::isa<llvm::Function>(alias.getAliasee())) {
+      continue;
+    }
+    auto func_type = llvm::cast<llvm::Function>(alias.getAliasee())->getFunctionType();
+    auto decl = llvm::Function::Create(func_type, llvm::GlobalValue::ExternalLinkage,
+                                       alias.getAddressSpace(), "", module);
+    decl->takeName(&alias);
+    alias.replaceAllUsesWith(decl);
+    alias.eraseFromParent();
+  }
+
+  // Functions TPL is guaranteed to export are reduced to declarations unless
+  // they're JIT-inlinable. Discardable functions (e.g., inline functions and
+  // template instantiations) keep their definitions since TPL may not have
+  // a copy of its own.
+  for (auto &func : *module) {
+    if (!func.isDeclaration() && !func.isDiscardableIfUnused() &&
+        inlinable->count(func.getName()) == 0) {
+      func.deleteBody();
+      func.setComdat(nullptr);
+    }
+  }
+
+  // Mutable state is shared with TPL.
+  for (auto &var : module->globals()) {
+    if (!var.isDeclaration() && !var.isConstant() && !var.hasLocalLinkage() &&
+        !var.isThreadLocal()) {
+      var.setInitializer(nullptr);
+      var.setLinkage(llvm::GlobalValue::ExternalLinkage);
+      var.setComdat(nullptr);
+      var.setDSOLocal(false);
+    }
+  }
+}
+
+// Does the function, or any function defined in the module it may call,
+// reference state that cannot be shared with TPL?
+bool ReferencesPrivateState(const llvm::Function &func,
+                            llvm::SmallPtrSetImpl<const llvm::Value *> *visited) {
+  llvm::SmallVector<const llvm::Value *, 16> work_list = {&func};
+  visited->insert(&func);
+  while (!work_list.empty()) {
+    const llvm::Value *val = work_list.pop_back_val();
+    const auto push = [&](const llvm::Value *operand) {
+      if (llvm::isa<llvm::GlobalValue>(operand) || llvm::isa<llvm::ConstantExpr>(operand) ||
+          llvm::isa<llvm::ConstantAggregate>(operand)) {
+        if (visited->insert(operand).second) work_list.push_back(operand);
+      }
+    };
+    if (auto var = llvm::dyn_cast<llvm::GlobalVariable>(val)) {
+      if (var->isThreadLocal() || (var->hasLocalLinkage() && !var->isConstant())) {
+        return true;
+      }
+      if (var->hasInitializer()) push(var->getInitializer());
+    } else if (auto callee = llvm::dyn_cast<llvm::Function>(val)) {
+      for (const auto &inst : llvm::instructions(*callee)) {
+        for (const auto &operand : inst.operands()) push(operand);
+      }
+    } else if (auto constant = llvm::dyn_cast<llvm::Constant>(val)) {
+      for (const auto &operand : constant->operands()) push(operand);
+    }
+  }
+  return false;
+}
+
+void LinkRuntimeModules(llvm::Module *module,
+                        std::vector<std::unique_ptr<llvm::Module>> runtime_modules) {
+  if (runtime_modules.empty()) {
+    return;
+  }
+
+  // Combine all runtime modules so that inlinable functions may call each
+  // other across source files.
+  llvm::StringSet<> inlinable;
+  std::unique_ptr<llvm::Module> runtime = std::move(runtime_modules[0]);
+  PrepareRuntimeModule(runtime.get(), &inlinable);
+  for (std::size_t i = 1; i < runtime_modules.size(); i++) {
+    PrepareRuntimeModule(runtime_modules[i].get(), &inlinable);
+    if (llvm::Linker::linkModules(*runtime, std::move(runtime_modules[i]))) {
+      fprintf(stderr, "Error linking runtime bitcode\n");
+      exit(1);
+    }
+  }
+
+  // Inlinable functions touching private state stay opaque.
+  for (auto &func : *runtime) {
+    llvm::SmallPtrSet<const llvm::Value *, 32> visited;
+    if (!func.isDeclaration() && inlinable.count(func.getName()) != 0 &&
+        ReferencesPrivateState(func, &visited)) {
+      fprintf(stdout, "Not inlining '%s': it references private state\n",
+              func.getName().str().c_str());
+      func.deleteBody();
+      func.setComdat(nullptr);
+    }
+  }
+
+  // Pull in only what the bytecode handlers need.
+  if (llvm::Linker::linkModules(*module, std::move(runtime), llvm::Linker::LinkOnlyNeeded)) {
+    fprintf(stderr, "Error linking runtime bitcode into bytecode handlers\n");
+    exit(1);
+  }
+}
+
 void RemoveGlobalUses(llvm::Module *module) {
   // When we created the original bitcode file, we forced all functions to be
   // generated by storing their address in a global variable. We delete this
@@ -76,6 +249,9 @@ void RemoveGlobalUses(llvm::Module *module) {
   if (used != nullptr) {
     used->eraseFromParent();
   }
+
+  // Annotations only serve to find JIT-inlinable functions.
+  EraseGlobal(module, kLLVMGlobalAnnotations);
 }
 
 void CleanFunctions(llvm::Module *module) {
@@ -112,7 +288,7 @@ void WriteCleanedModule(llvm::Module *module, const char *out_filepath) {
 
 int main(int argc, char *argv[]) {
   if (argc < 2) {
-    fprintf(stderr, "usage: gen_bc <input_bc>\n");
+    fprintf(stderr, "usage: gen_bc <input_bc> [<output_bc> [<runtime_bc> ...]]\n");
     exit(1);
   }
 
@@ -128,6 +304,18 @@ int main(int argc, char *argv[]) {
   auto context = std::make_unique<llvm::LLVMContext>();
   auto module = ParseIntoLLVMModule(context.get(), memory_buffer->get());
 
+  std::vector<std::unique_ptr<llvm::Module>> runtime_modules;
+  for (int i = 3; i < argc; i++) {
+    fprintf(stdout, "Reading runtime input '%s' ...\n", argv[i]);
+    auto runtime_buffer = ReadIntoMemory(argv[i]);
+    auto runtime_module = ParseIntoLLVMModule(context.get(), runtime_buffer->get());
+    runtime_modules.push_back(std::move(runtime_module.get()));
+  }
+
+  fprintf(stdout, "Linking JIT-inlinable runtime functions ...\n");
+
+  LinkRuntimeModules(module->get(), std::move(runtime_modules));
+
   fprintf(stdout, "Cleaning up LLVM Module ...\n");
 
   CleanModule(module->get());
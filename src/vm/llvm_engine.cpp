@@ -1,5 +1,6 @@
 #include "vm/llvm_engine.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -16,6 +17,7 @@
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/IR/MDBuilder.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/MC/MCContext.h"
 #include "llvm/Support/DynamicLibrary.h"
@@ -39,6 +41,7 @@
 #include "logging/logger.h"
 #include "util/timer.h"
 #include "vm/bytecode_module.h"
+#include "vm/bytecode_profile.h"
 #include "vm/bytecode_traits.h"
 
 namespace tpl::vm {
@@ -286,7 +289,10 @@ llvm::FunctionType *LLVMEngine::TypeMap::GetLLVMFunctionType(const ast::Function
 
   llvm::Type *return_type = nullptr;
   if (FunctionHasIndirectReturn(func_type)) {
-    llvm::Type *rv_param = GetLLVMType(func_type->GetReturnType()->PointerTo());
+    // Build the pointer type in LLVM rather than through the AST context. This
+    // keeps compilation from mutating the context, which modules compiled in
+    // parallel may share.
+    llvm::Type *rv_param = GetLLVMType(func_type->GetReturnType())->getPointerTo();
     param_types.push_back(rv_param);
     return_type = VoidType();
   } else {
@@ -346,9 +352,14 @@ LLVMEngine::FunctionLocalsMap::FunctionLocalsMap(const FunctionInfo &func_info,
     params_[param.GetOffset()] = &*arg_iter;
   }
 
-  // Allocate all local variables up front.
+  // Allocate all local variables up front. Locals whose lifetimes don't
+  // overlap may share a slot, but only if they have the same type. Allocate
+  // each slot once.
   for (; local_idx < func_info.GetLocals().size(); local_idx++) {
     const LocalInfo &local_info = func_locals[local_idx];
+    if (locals_.count(local_info.GetOffset()) != 0) {
+      continue;
+    }
     llvm::Type *llvm_type = type_map->GetLLVMType(local_info.GetType());
     llvm::Value *val = ir_builder_->CreateAlloca(llvm_type);
     locals_[local_info.GetOffset()] = val;
@@ -417,6 +428,9 @@ class LLVMEngine::CompiledModuleBuilder {
   // Print the contents of the module's assembly to a string and return it
   std::string DumpModuleAsm();
 
+  // Return the number of conditional branches weighted with profiled outcomes
+  std::size_t GetNumWeightedBranches() const { return num_weighted_branches_; }
+
  private:
   // Given a TPL function, build a simple CFG using 'blocks' as an output param
   void BuildSimpleCFG(const FunctionInfo &func_info,
@@ -443,6 +457,7 @@ class LLVMEngine::CompiledModuleBuilder {
   std::unique_ptr<llvm::Module> llvm_module_;
   std::unique_ptr<TypeMap> type_map_;
   llvm::DenseMap<std::size_t, llvm::Constant *> static_locals_;
+  std::size_t num_weighted_branches_{0};
 };
 
 // ---------------------------------------------------------
@@ -657,6 +672,14 @@ void LLVMEngine::CompiledModuleBuilder::DefineFunction(const FunctionInfo &func_
   llvm::BasicBlock *first_bb = llvm::BasicBlock::Create(ctx, "BB0", func);
   llvm::BasicBlock *entry_bb = llvm::BasicBlock::Create(ctx, "EntryBB", func, first_bb);
 
+  // Let the profile, if any, tell LLVM how often the function was called.
+  const BytecodeProfile *profile = options_.GetProfile();
+  if (profile != nullptr) {
+    if (const uint64_t count = profile->GetInvocationCount(func_info.GetId()); count > 0) {
+      func->setEntryCount(llvm::Function::ProfileCount(count, llvm::Function::PCT_Real));
+    }
+  }
+
   // First, construct a simple CFG for the function. The CFG contains entries for the start of every
   // basic block in the function, and the bytecode position of the first instruction in the block.
   // The CFG is ordered by bytecode position in ascending order.
@@ -866,10 +889,32 @@ void LLVMEngine::CompiledModuleBuilder::DefineFunction(const FunctionInfo &func_
         auto *check = llvm::ConstantInt::get(type_map_->Int8Type(), 1, false);
         llvm::Value *cond = ir_builder->CreateICmpEQ(args[0], check);
 
+        // Weigh the branch with the jump's profiled outcomes, if any. Weights
+        // are smoothed by one so that an outcome that wasn't observed isn't
+        // treated as impossible, and scaled down to fit in 32 bits.
+        const BytecodeProfile::BranchCounters *counters =
+            profile == nullptr ? nullptr
+                               : profile->GetBranchCounters(func_info.GetId(), iter.GetPosition());
+        llvm::MDNode *weights = nullptr;
+        if (counters != nullptr && counters->GetTakenCount() + counters->GetNotTakenCount() > 0) {
+          uint64_t taken = counters->GetTakenCount() + 1;
+          uint64_t not_taken = counters->GetNotTakenCount() + 1;
+          const uint64_t scale = (std::max(taken, not_taken) >> 32u) + 1;
+          taken /= scale;
+          not_taken /= scale;
+          const bool taken_if_true = bytecode == Bytecode::JumpIfTrue;
+          weights = llvm::MDBuilder(ctx).createBranchWeights(
+              static_cast<uint32_t>(taken_if_true ? taken : not_taken),
+              static_cast<uint32_t>(taken_if_true ? not_taken : taken));
+          num_weighted_branches_++;
+        }
+
         if (bytecode == Bytecode::JumpIfTrue) {
-          ir_builder->CreateCondBr(cond, blocks[branch_target_bb_pos], blocks[fallthrough_bb_pos]);
+          ir_builder->CreateCondBr(cond, blocks[branch_target_bb_pos], blocks[fallthrough_bb_pos],
+                                   weights);
         } else {
-          ir_builder->CreateCondBr(cond, blocks[fallthrough_bb_pos], blocks[branch_target_bb_pos]);
+          ir_builder->CreateCondBr(cond, blocks[fallthrough_bb_pos], blocks[branch_target_bb_pos],
+                                   weights);
         }
         break;
       }
@@ -1196,7 +1241,8 @@ void LLVMEngine::Initialize() {
 void LLVMEngine::Shutdown() { llvm::llvm_shutdown(); }
 
 std::unique_ptr<LLVMEngine::CompiledModule> LLVMEngine::Compile(const BytecodeModule &module,
-                                                                const CompilerOptions &options) {
+                                                                const CompilerOptions &options,
+                                                                CompileStats *stats) {
   util::Timer<std::milli> timer;
 
   // -------------------------------------------------------
@@ -1273,6 +1319,16 @@ std::unique_ptr<LLVMEngine::CompiledModule> LLVMEngine::Compile(const BytecodeMo
   LOG_DEBUG("  Finalize         : {:.2f}", finalize_ms);
   LOG_DEBUG("  Load/Link Module : {:.2f}", load_ms);
 
+  if (stats != nullptr) {
+    stats->ir_gen_ms = init_module_ms + decl_statics_ms + decl_funcs_ms + def_funcs_ms;
+    stats->verify_ms = simplify_ms + verify_ms;
+    stats->optimize_ms = optimize_ms;
+    stats->codegen_ms = finalize_ms;
+    stats->load_ms = load_ms;
+    stats->object_code_bytes = compiled_module->GetModuleObjectCodeSizeInBytes();
+    stats->weighted_branches = builder.GetNumWeightedBranches();
+  }
+
   return compiled_module;
 }
 
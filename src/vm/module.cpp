@@ -9,7 +9,9 @@
 #define XBYAK_NO_OP_NAMES
 #include "xbyak/xbyak.h"
 
+#include "common/settings.h"
 #include "logging/logger.h"
+#include "util/trace_recorder.h"
 
 namespace tpl::vm {
 
@@ -27,6 +29,12 @@ Module::Module(std::unique_ptr<BytecodeModule> bytecode_module,
     CreateFunctionTrampoline(func.GetId());
   }
 
+  // Prepare the bytecode for direct-threaded interpretation. The code doesn't
+  // profile; profiling only starts if the module is run adaptively.
+  if (Settings::Instance()->GetBool(Settings::Name::ThreadedInterpretation)) {
+    threaded_code_ = std::make_unique<VM::ThreadedCode>(*bytecode_module_, nullptr);
+  }
+
   // If a compiled module wasn't provided, all internal function stubs point to
   // the bytecode implementations.
   if (jit_module_ == nullptr) {
@@ -43,6 +51,8 @@ Module::Module(std::unique_ptr<BytecodeModule> bytecode_module,
   }
 }
 
+Module::~Module() { WaitForCompilation(); }
+
 namespace {
 
 // TODO(pmenon): Implement generator for non x86_64 machines
@@ -249,8 +259,18 @@ void Module::CompileToMachineCode() {
     }
 
     // JIT the module.
+    util::TraceScope trace("compile", "JITCompile", "functions",
+                           bytecode_module_->GetFunctionCount());
     LLVMEngine::CompilerOptions options;
-    jit_module_ = LLVMEngine::Compile(*bytecode_module_, options);
+    options.SetProfile(GetProfile());
+    try {
+      jit_module_ = LLVMEngine::Compile(*bytecode_module_, options, &compile_stats_);
+    } catch (...) {
+      // Leaving by exception would let the next caller compile again. Keep the
+      // error for all callers instead, and keep the bytecode implementations.
+      compile_error_ = std::current_exception();
+      return;
+    }
 
     // JIT completed successfully. For each function in the module, pull out its
     // compiled implementation into the function cache, atomically replacing any
@@ -261,10 +281,59 @@ void Module::CompileToMachineCode() {
       functions_[func_info.GetId()].store(jit_function, std::memory_order_relaxed);
     }
   });
+
+  if (compile_error_ != nullptr) {
+    std::rethrow_exception(compile_error_);
+  }
 }
 
 void Module::CompileToMachineCodeAsync() {
-  std::thread([this]() { CompileToMachineCode(); }).detach();
+  if (compile_requested_.exchange(true)) {
+    return;
+  }
+  // The thread is joined before the module is destroyed.
+  std::lock_guard<std::mutex> lock(compile_thread_mutex_);
+  compile_thread_ = std::thread([this]() {
+    // Execution continues in the interpreter if compilation fails.
+    try {
+      CompileToMachineCode();
+    } catch (const std::exception &ex) {
+      LOG_ERROR("Failed to compile module '{}': {}", bytecode_module_->GetName(), ex.what());
+    }
+  });
+}
+
+void Module::WaitForCompilation() {
+  std::lock_guard<std::mutex> lock(compile_thread_mutex_);
+  if (compile_thread_.joinable()) {
+    compile_thread_.join();
+  }
+}
+
+bool Module::StartProfiling() {
+  // Branches are only profiled in direct-threaded code.
+  if (threaded_code_ == nullptr ||
+      !Settings::Instance()->GetBool(Settings::Name::ProfileGuidedCompilation)) {
+    return false;
+  }
+  std::call_once(profiling_flag_, [this]() {
+    profiling_storage_ = std::make_unique<Profiling>(*bytecode_module_);
+    profiling_.store(profiling_storage_.get(), std::memory_order_release);
+  });
+  return true;
+}
+
+void Module::CompileIfProfileIsWarm() const {
+  const BytecodeProfile *profile = GetProfile();
+  if (profile == nullptr || compile_requested_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  const auto threshold = Settings::Instance()->GetInt(Settings::Name::AdaptiveCompilationThreshold);
+  if (profile->GetTotalCount() >= static_cast<uint64_t>(threshold)) {
+    // Compiling doesn't change the behavior of the module's functions, only
+    // their implementation.
+    const_cast<Module *>(this)->CompileToMachineCodeAsync();
+  }
 }
 
 }  // namespace tpl::vm
@@ -1,5 +1,8 @@
 #include "vm/vm.h"
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>  // NOLINT
 #include <numeric>
 #include <string>
 
@@ -9,6 +12,8 @@
 #include "sql/value.h"
 #include "vm/bytecode_function_info.h"
 #include "vm/bytecode_handlers.h"
+#include "vm/bytecode_iterator.h"
+#include "vm/bytecode_profile.h"
 #include "vm/bytecodes.h"
 #include "vm/module.h"
 
@@ -105,7 +110,12 @@ void VM::InvokeFunction(const Module *module, const FunctionId func_id, const ui
   // Let's go!
   VM vm(module);
   Frame frame(raw_frame, frame_size);
-  vm.Interpret(module->GetBytecodeModule()->AccessBytecodeForFunctionRaw(*func_info), &frame);
+  vm.Execute(*func_info, &frame);
+
+  // Check if the module is ready to be compiled after each call from native
+  // code. Each call adds to the profile, so there are only a bounded number of
+  // checks before compilation is requested, and none after.
+  module->CompileIfProfileIsWarm();
 
   // Done. Now, let's cleanup.
   if (used_heap) {
@@ -133,8 +143,26 @@ inline ALWAYS_INLINE T Peek(const uint8_t **ip) {
   return *reinterpret_cast<const T *>(*ip);
 }
 
+// The dispatch table of the direct-threaded interpreter, i.e., the addresses
+// of the handlers in VM::Interpret<true>(). Handler addresses are only known
+// inside the interpreter function, so it publishes them here when called with
+// a NULL instruction pointer.
+void *const *threaded_dispatch_table = nullptr;
+
 }  // namespace
 
+void VM::Execute(const FunctionInfo &func, Frame *frame) {
+  if (Module::Profiling *profiling = module_->profiling_.load(std::memory_order_acquire)) {
+    profiling->profile.RecordInvocation(func.GetId());
+    Interpret<true>(profiling->code.GetCodeForFunction(func.GetId()), frame);
+  } else if (const ThreadedCode *threaded_code = module_->threaded_code_.get()) {
+    Interpret<true>(threaded_code->GetCodeForFunction(func.GetId()), frame);
+  } else {
+    Interpret<false>(module_->GetBytecodeModule()->AccessBytecodeForFunctionRaw(func), frame);
+  }
+}
+
+template <bool Threaded>
 void VM::Interpret(const uint8_t *ip, Frame *frame) {
   static void *kDispatchTable[] = {
 #define ENTRY(name, ...) &&op_##name,
@@ -142,6 +170,13 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
 #undef ENTRY
   };
 
+  if constexpr (Threaded) {
+    if (TPL_UNLIKELY(ip == nullptr)) {
+      threaded_dispatch_table = kDispatchTable;
+      return;
+    }
+  }
+
 #ifdef TPL_DEBUG_TRACE_INSTRUCTIONS
 #define DEBUG_TRACE_INSTRUCTIONS(op)                                        \
   do {                                                                      \
@@ -172,12 +207,39 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
 #define READ_OP() Read<std::underlying_type_t<Bytecode>>(&ip)
 #define READ_FUNC_ID() READ_UIMM2()
 
+#define READ_HANDLER() reinterpret_cast<void *>(Read<uintptr_t>(&ip))
+
+  // In direct-threaded code, conditional jumps are followed by a pointer to
+  // their profile counters. It's read from behind the jump offset before the
+  // jump is taken, and skipped otherwise.
+#define PROFILE_BRANCH(taken)                                              \
+  do {                                                                     \
+    if constexpr (Threaded) {                                              \
+      const uint8_t *counters_ip = ip + sizeof(int32_t);                   \
+      auto counters = reinterpret_cast<BytecodeProfile::BranchCounters *>( \
+          Peek<uintptr_t>(&counters_ip));                                  \
+      if (counters != nullptr) {                                           \
+        counters->Record(taken);                                           \
+      }                                                                    \
+    }                                                                      \
+  } while (false)
+#define SKIP_BRANCH_PROFILE()  \
+  do {                         \
+    if constexpr (Threaded) {  \
+      ip += sizeof(uintptr_t); \
+    }                          \
+  } while (false)
+
 #define OP(name) op_##name
-#define DISPATCH_NEXT()           \
-  do {                            \
-    auto op = READ_OP();          \
-    DEBUG_TRACE_INSTRUCTIONS(op); \
-    goto *kDispatchTable[op];     \
+#define DISPATCH_NEXT()             \
+  do {                              \
+    if constexpr (Threaded) {       \
+      goto *READ_HANDLER();         \
+    } else {                        \
+      auto op = READ_OP();          \
+      DEBUG_TRACE_INSTRUCTIONS(op); \
+      goto *kDispatchTable[op];     \
+    }                               \
   } while (false)
 
   /*****************************************************************************
@@ -185,7 +247,9 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
    * Below this comment begins the primary section of TPL's register-based
    * virtual machine (VM) dispatch area. The VM uses indirect threaded
    * interpretation; each bytecode handler's label is statically generated and
-   * stored in @ref kDispatchTable at server compile time. Bytecode handler
+   * stored in @ref kDispatchTable at server compile time. When interpreting
+   * direct-threaded code (see VM::ThreadedCode), the handler's address is read
+   * from the instruction stream instead. Bytecode handler
    * logic is written as a case using the CASE_OP macro. Handlers can read from
    * and write to registers using the local execution frame's register file
    * (i.e., through @ref Frame::LocalAt()).
@@ -363,9 +427,12 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     auto cond = frame->LocalAt<bool>(READ_LOCAL_ID());
     auto skip = PEEK_JMP_OFFSET();
     if (OpJumpIfTrue(cond)) {
+      PROFILE_BRANCH(true);
       ip += skip;
     } else {
+      PROFILE_BRANCH(false);
       READ_JMP_OFFSET();
+      SKIP_BRANCH_PROFILE();
     }
     DISPATCH_NEXT();
   }
@@ -374,9 +441,12 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     auto cond = frame->LocalAt<bool>(READ_LOCAL_ID());
     auto skip = PEEK_JMP_OFFSET();
     if (OpJumpIfFalse(cond)) {
+      PROFILE_BRANCH(true);
       ip += skip;
     } else {
+      PROFILE_BRANCH(false);
       READ_JMP_OFFSET();
+      SKIP_BRANCH_PROFILE();
     }
     DISPATCH_NEXT();
   }
@@ -504,6 +574,22 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(ExecutionContextRecordTuples) : {
+    auto *exec_ctx = frame->LocalAt<sql::ExecutionContext *>(READ_LOCAL_ID());
+    auto operator_id = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    auto num_tuples = frame->LocalAt<uint64_t>(READ_LOCAL_ID());
+    OpExecutionContextRecordTuples(exec_ctx, operator_id, num_tuples);
+    DISPATCH_NEXT();
+  }
+
+  OP(ExecutionContextRecordMorsels) : {
+    auto *exec_ctx = frame->LocalAt<sql::ExecutionContext *>(READ_LOCAL_ID());
+    auto pipeline_id = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    auto num_morsels = frame->LocalAt<uint64_t>(READ_LOCAL_ID());
+    OpExecutionContextRecordMorsels(exec_ctx, pipeline_id, num_morsels);
+    DISPATCH_NEXT();
+  }
+
   OP(ThreadStateContainerAccessCurrentThreadState) : {
     auto *state = frame->LocalAt<byte **>(READ_LOCAL_ID());
     auto *thread_state_container = frame->LocalAt<sql::ThreadStateContainer *>(READ_LOCAL_ID());
@@ -1067,6 +1153,15 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(AggregationHashTableInitWithSize) : {
+    auto *agg_hash_table = frame->LocalAt<sql::AggregationHashTable *>(READ_LOCAL_ID());
+    auto *memory = frame->LocalAt<tpl::sql::MemoryPool *>(READ_LOCAL_ID());
+    auto payload_size = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    auto initial_size = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    OpAggregationHashTableInitWithSize(agg_hash_table, memory, payload_size, initial_size);
+    DISPATCH_NEXT();
+  }
+
   OP(AggregationHashTableAllocTuple) : {
     auto *result = frame->LocalAt<byte **>(READ_LOCAL_ID());
     auto *agg_hash_table = frame->LocalAt<sql::AggregationHashTable *>(READ_LOCAL_ID());
@@ -1502,6 +1597,19 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(SorterInitWithSize) : {
+    auto *sorter = frame->LocalAt<sql::Sorter *>(READ_LOCAL_ID());
+    auto *memory = frame->LocalAt<tpl::sql::MemoryPool *>(READ_LOCAL_ID());
+    auto cmp_func_id = READ_FUNC_ID();
+    auto tuple_size = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    auto expected_tuple_count = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+
+    auto cmp_fn =
+        reinterpret_cast<sql::Sorter::ComparisonFunction>(module_->GetRawFunctionImpl(cmp_func_id));
+    OpSorterInitWithSize(sorter, memory, cmp_fn, tuple_size, expected_tuple_count);
+    DISPATCH_NEXT();
+  }
+
   OP(SorterAllocTuple) : {
     auto *result = frame->LocalAt<byte **>(READ_LOCAL_ID());
     auto *sorter = frame->LocalAt<sql::Sorter *>(READ_LOCAL_ID());
@@ -1925,7 +2033,7 @@ const uint8_t *VM::ExecuteCall(const uint8_t *ip, VM::Frame *caller) {
 
   // Let's go
   Frame callee(raw_frame, func_info->GetFrameSize());
-  Interpret(module_->GetBytecodeModule()->AccessBytecodeForFunctionRaw(*func_info), &callee);
+  Execute(*func_info, &callee);
 
   // Done. Now, let's cleanup.
   if (used_heap) {
@@ -1935,4 +2043,85 @@ const uint8_t *VM::ExecuteCall(const uint8_t *ip, VM::Frame *caller) {
   return ip;
 }
 
+// ---------------------------------------------------------
+// Direct-threaded code
+// ---------------------------------------------------------
+
+VM::ThreadedCode::ThreadedCode(const BytecodeModule &module, BytecodeProfile *profile)
+    : func_offsets_(module.GetFunctionCount()) {
+  // Have the direct-threaded interpreter publish its handler addresses.
+  static std::once_flag published_flag;
+  std::call_once(published_flag, [] {
+    VM vm(nullptr);
+    vm.Interpret<true>(nullptr, nullptr);
+  });
+
+  // Instructions grow by the difference between a handler address and an
+  // opcode. Conditional jumps also grow by their profile counters' address.
+  constexpr uint32_t kOpcodeSize = sizeof(std::underlying_type_t<Bytecode>);
+  constexpr uint32_t kHandlerSize = sizeof(uintptr_t);
+  constexpr uint32_t kGrowth = kHandlerSize - kOpcodeSize;
+  constexpr uint32_t kProfileSize = sizeof(uintptr_t);
+
+  std::vector<std::size_t> positions, threaded_positions;
+  for (const auto &func : module.GetFunctionsInfo()) {
+    const uint8_t *bytecode = module.AccessBytecodeForFunctionRaw(func);
+
+    // First, find where each instruction of the function lands in the
+    // threaded code, so that jumps can be redirected.
+    positions.clear();
+    threaded_positions.clear();
+    std::size_t threaded_pos = code_.size();
+    for (auto iter = module.GetBytecodeForFunction(func); !iter.Done(); iter.Advance()) {
+      positions.push_back(iter.GetPosition());
+      threaded_positions.push_back(threaded_pos);
+      threaded_pos += iter.CurrentBytecodeSize() + kGrowth;
+      if (Bytecodes::IsConditionalJump(iter.CurrentBytecode())) {
+        threaded_pos += kProfileSize;
+      }
+    }
+    func_offsets_[func.GetId()] = code_.size();
+    code_.resize(threaded_pos);
+
+    // Now, emit each instruction.
+    auto iter = module.GetBytecodeForFunction(func);
+    for (std::size_t i = 0; i < positions.size(); i++) {
+      iter.SetPosition(positions[i]);
+      const Bytecode op = iter.CurrentBytecode();
+      uint8_t *out = &code_[threaded_positions[i]];
+
+      const auto handler =
+          reinterpret_cast<uintptr_t>(threaded_dispatch_table[Bytecodes::ToByte(op)]);
+      std::memcpy(out, &handler, kHandlerSize);
+      std::memcpy(out + kHandlerSize, bytecode + positions[i] + kOpcodeSize,
+                  iter.CurrentBytecodeSize() - kOpcodeSize);
+
+      if (Bytecodes::IsConditionalJump(op)) {
+        const auto counters = reinterpret_cast<uintptr_t>(
+            profile == nullptr ? nullptr : profile->GetBranchCounters(func.GetId(), positions[i]));
+        std::memcpy(out + iter.CurrentBytecodeSize() + kGrowth, &counters, kProfileSize);
+      }
+
+      // Jump offsets are relative to the position of the offset operand.
+      for (uint32_t op_idx = 0; op_idx < Bytecodes::NumOperands(op); op_idx++) {
+        if (Bytecodes::GetNthOperandType(op, op_idx) != OperandType::JumpOffset) {
+          continue;
+        }
+        const uint32_t operand_offset = Bytecodes::GetNthOperandOffset(op, op_idx);
+        const std::size_t target =
+            positions[i] + operand_offset + iter.GetJumpOffsetOperand(op_idx);
+        const auto target_iter = std::lower_bound(positions.begin(), positions.end(), target);
+        TPL_ASSERT(target_iter != positions.end() && *target_iter == target,
+                   "Jump target isn't the start of an instruction");
+        const std::size_t threaded_target =
+            threaded_positions[std::distance(positions.begin(), target_iter)];
+        const auto offset = static_cast<int32_t>(
+            static_cast<int64_t>(threaded_target) -
+            static_cast<int64_t>(threaded_positions[i] + operand_offset + kGrowth));
+        std::memcpy(out + operand_offset + kGrowth, &offset, sizeof(offset));
+      }
+    }
+  }
+}
+
 }  // namespace tpl::vm
@@ -54,6 +54,7 @@ MAKE_VEC_TYPE(BigInt, int64_t)
 MAKE_VEC_TYPE(Float, float)
 MAKE_VEC_TYPE(Double, double)
 MAKE_VEC_TYPE(Date, sql::Date)
+MAKE_VEC_TYPE(Timestamp, sql::Timestamp)
 MAKE_VEC_TYPE(Varchar, std::string_view)
 MAKE_VEC_TYPE(Pointer, uintptr_t);
 
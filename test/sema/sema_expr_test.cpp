@@ -244,4 +244,15 @@ TEST_F(SemaExprTest, ArrayIndexTest) {
   }
 }
 
+TEST_F(SemaExprTest, FloatLiteralTypeTest) {
+  // Zero, negative, and positive floats that fit in 32-bits are all 32-bit floats.
+  for (const float val : {0.0f, -1.5f, 1.5f, -3.0e38f}) {
+    auto lit = FloatLit(val);
+    Sema sema(ctx());
+    EXPECT_FALSE(sema.Run(lit));
+    EXPECT_EQ(ast::BuiltinType::Get(ctx(), ast::BuiltinType::Float32), lit->GetType()) << val;
+    ResetErrorReporter();
+  }
+}
+
 }  // namespace tpl::sema
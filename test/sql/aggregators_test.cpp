@@ -1,3 +1,6 @@
+#include <limits>
+
+#include "common/exception.h"
 #include "sql/aggregators.h"
 #include "sql/value.h"
 #include "util/test_harness.h"
@@ -478,4 +481,57 @@ TEST_F(AggregatorsTest, Avg) {
   EXPECT_DOUBLE_EQ(0.0, avg1.GetResultAvg().val);
 }
 
+TEST_F(AggregatorsTest, DecimalSumAndAvg) {
+  // NULL checks.
+  {
+    DecimalSumAggregate sum;
+    DecimalAvgAggregate avg;
+    EXPECT_TRUE(sum.GetResultSum().is_null);
+    EXPECT_TRUE(avg.GetResultAvg().is_null);
+    sum.Advance(DecimalVal::Null());
+    avg.Advance(DecimalVal::Null());
+    EXPECT_TRUE(sum.GetResultSum().is_null);
+    EXPECT_TRUE(avg.GetResultAvg().is_null);
+  }
+
+  // 1.25 + 2.50 + NULL - 0.01 = 3.74, and 3.74 / 3 = 1.2466... = 1.25.
+  DecimalSumAggregate sum1, sum2;
+  DecimalAvgAggregate avg1, avg2;
+  for (const auto &val :
+       {DecimalVal(125), DecimalVal(250), DecimalVal::Null(), DecimalVal(-1)}) {
+    sum1.Advance(val);
+    avg1.Advance(val);
+  }
+  EXPECT_FALSE(sum1.GetResultSum().is_null);
+  EXPECT_EQ(374, sum1.GetResultSum().val);
+  EXPECT_EQ(125, avg1.GetResultAvg().val);
+
+  // Merge in -1.00: (3.74 - 1.00) / 4 = 0.685 = 0.69.
+  sum2.Advance(DecimalVal(-100));
+  avg2.Advance(DecimalVal(-100));
+  sum1.Merge(sum2);
+  avg1.Merge(avg2);
+  EXPECT_EQ(274, sum1.GetResultSum().val);
+  EXPECT_EQ(69, avg1.GetResultAvg().val);
+  // Negative averages also round away from zero: (-3.74 - 1.00 + 0 + 0) / 4 = -1.185 = -1.19.
+  {
+    DecimalAvgAggregate avg;
+    for (const auto val : {-374, -100, 0, 0}) avg.Advance(DecimalVal(val));
+    EXPECT_EQ(-119, avg.GetResultAvg().val);
+  }
+
+  // Sums are exact in 128 bits, but must fit into 64 bits when produced.
+  {
+    DecimalSumAggregate sum;
+    DecimalAvgAggregate avg;
+    for (uint32_t i = 0; i < 4; i++) {
+      sum.Advance(DecimalVal(std::numeric_limits<int64_t>::max()));
+      avg.Advance(DecimalVal(std::numeric_limits<int64_t>::max()));
+    }
+    EXPECT_TRUE(sum.GetSum128() == int128_t{std::numeric_limits<int64_t>::max()} * 4);
+    EXPECT_THROW(sum.GetResultSum(), Exception);
+    EXPECT_EQ(std::numeric_limits<int64_t>::max(), avg.GetResultAvg().val);
+  }
+}
+
 }  // namespace tpl::sql
@@ -18,7 +18,15 @@ namespace tpl::sql::codegen {
 
 using namespace std::chrono_literals;
 
-class HashAggregationTranslatorTest : public CodegenBasedTest {};
+class HashAggregationTranslatorTest : public CodegenBasedTest {
+ protected:
+  // Statistics change the plans of later tests in this binary, so drop them.
+  void TearDown() override {
+    auto catalog = sql::Catalog::Instance();
+    catalog->ClearTableStatistics(catalog->LookupTableByName("test_1")->GetId());
+    CodegenBasedTest::TearDown();
+  }
+};
 
 TEST_F(HashAggregationTranslatorTest, SimpleAggregateTest) {
   // SELECT col2, SUM(col1) FROM test_1 WHERE col1 < 1000 GROUP BY col2;
@@ -83,4 +91,56 @@ TEST_F(HashAggregationTranslatorTest, SimpleAggregateTest) {
   });
 }
 
+TEST_F(HashAggregationTranslatorTest, PresizedAggregateTest) {
+  // SELECT col1, COUNT(*) FROM test_1 WHERE col1 < 1000 GROUP BY col1;
+  // With statistics, the hash table is presized to the expected number of groups.
+  auto accessor = sql::Catalog::Instance();
+  planner::ExpressionMaker expr_maker;
+  sql::Table *table = accessor->LookupTableByName("test_1");
+  const auto &table_schema = table->GetSchema();
+  accessor->AnalyzeTable(table->GetId());
+
+  // Scan.
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  planner::OutputSchemaHelper seq_scan_out{&expr_maker, 0};
+  {
+    auto col1 = expr_maker.CVE(table_schema.GetColumnInfo("colA"));
+    seq_scan_out.AddOutput("col1", col1);
+    auto schema = seq_scan_out.MakeSchema();
+    auto predicate = expr_maker.CompareLt(col1, expr_maker.Constant(1000));
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetScanPredicate(predicate)
+                   .SetTableOid(table->GetId())
+                   .Build();
+  }
+
+  // Aggregation.
+  std::unique_ptr<planner::AbstractPlanNode> agg;
+  planner::OutputSchemaHelper agg_out{&expr_maker, 0};
+  {
+    agg_out.AddGroupByTerm("col1", seq_scan_out.GetOutput("col1"));
+    agg_out.AddAggTerm("count", expr_maker.AggCountStar());
+    agg_out.AddOutput("col1", agg_out.GetGroupByTermForOutput("col1"));
+    agg_out.AddOutput("count", agg_out.GetAggTermForOutput("count"));
+    auto schema = agg_out.MakeSchema();
+    planner::AggregatePlanNode::Builder builder;
+    agg = builder.SetOutputSchema(std::move(schema))
+              .AddGroupByTerm(agg_out.GetGroupByTerm("col1"))
+              .AddAggregateTerm(agg_out.GetAggTerm("count"))
+              .AddChild(std::move(seq_scan))
+              .SetAggregateStrategyType(planner::AggregateStrategyType::HASH)
+              .SetHavingClausePredicate(nullptr)
+              .Build();
+  }
+
+  // Run and check.
+  ExecuteAndCheckInAllModes(*agg, []() {
+    std::vector<std::unique_ptr<OutputChecker>> checks;
+    checks.emplace_back(std::make_unique<TupleCounterChecker>(1000));
+    checks.emplace_back(std::make_unique<SingleIntSumChecker>(0, (1000 * 999) / 2));
+    return std::make_unique<MultiChecker>(std::move(checks));
+  });
+}
+
 }  // namespace tpl::sql::codegen
@@ -123,4 +123,95 @@ TEST_F(HashJoinTranslatorTest, SimpleHashJoinTest) {
   });
 }
 
+TEST_F(HashJoinTranslatorTest, RightOuterHashJoinTest) {
+  // SELECT t1.col2, t2.col2
+  //   FROM (SELECT * FROM small_1 WHERE col2 < 80) AS t1
+  //        RIGHT OUTER JOIN small_1 AS t2 ON t1.col2 = t2.col2;
+
+  // Get accessor
+  auto accessor = sql::Catalog::Instance();
+  planner::ExpressionMaker expr_maker;
+
+  // Scan small_1 with predicate: col2 < 80.
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan1;
+  planner::OutputSchemaHelper seq_scan_out1(&expr_maker, 0);
+  {
+    auto table1 = accessor->LookupTableByName("small_1");
+    auto &table_schema1 = table1->GetSchema();
+    auto col2 = expr_maker.CVE(table_schema1.GetColumnInfo("col2"));
+    seq_scan_out1.AddOutput("col2", col2);
+    auto schema = seq_scan_out1.MakeSchema();
+    // Make predicate: col2 < 80.
+    auto predicate = expr_maker.CompareLt(col2, expr_maker.Constant(80));
+    // Build.
+    seq_scan1 = planner::SeqScanPlanNode::Builder()
+                    .SetOutputSchema(std::move(schema))
+                    .SetScanPredicate(predicate)
+                    .SetTableOid(table1->GetId())
+                    .Build();
+  }
+
+  // Scan small_1.
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan2;
+  planner::OutputSchemaHelper seq_scan_out2(&expr_maker, 1);
+  {
+    auto table2 = accessor->LookupTableByName("small_1");
+    auto &table_schema2 = table2->GetSchema();
+    auto col2 = expr_maker.CVE(table_schema2.GetColumnInfo("col2"));
+    seq_scan_out2.AddOutput("col2", col2);
+    auto schema = seq_scan_out2.MakeSchema();
+    // Build.
+    seq_scan2 = planner::SeqScanPlanNode::Builder()
+                    .SetOutputSchema(std::move(schema))
+                    .SetTableOid(table2->GetId())
+                    .Build();
+  }
+
+  // Hash join plan.
+  std::unique_ptr<planner::AbstractPlanNode> hash_join_plan;
+  planner::OutputSchemaHelper hash_join_out(&expr_maker, 0);
+  {
+    auto t1_col2 = seq_scan_out1.GetOutput("col2");
+    auto t2_col2 = seq_scan_out2.GetOutput("col2");
+    // Output Schema.
+    hash_join_out.AddOutput("t1.col2", t1_col2);
+    hash_join_out.AddOutput("t2.col2", t2_col2);
+    auto schema = hash_join_out.MakeSchema();
+    // Predicate.
+    auto predicate = expr_maker.CompareEq(t1_col2, t2_col2);
+    // Build.
+    hash_join_plan = planner::HashJoinPlanNode::Builder()
+                         .AddChild(std::move(seq_scan1))
+                         .AddChild(std::move(seq_scan2))
+                         .SetOutputSchema(std::move(schema))
+                         .SetJoinType(planner::LogicalJoinType::RIGHT)
+                         .AddLeftHashKey(t1_col2)
+                         .AddRightHashKey(t2_col2)
+                         .SetJoinPredicate(predicate)
+                         .Build();
+  }
+
+  // Run and check.
+  ExecuteAndCheckInAllModes(*hash_join_plan, [&]() {
+    // Checkers:
+    // 1. Every row in small_1 is produced exactly once.
+    // 2. Rows with a partner are joined, the rest are NULL-padded.
+    std::vector<std::unique_ptr<OutputChecker>> checks;
+    checks.emplace_back(std::make_unique<TupleCounterChecker>(200));
+    checks.emplace_back(std::make_unique<GenericChecker>(
+        [](const std::vector<const sql::Val *> &vals) {
+          auto t1_col2 = static_cast<const sql::Integer *>(vals[0]);
+          auto t2_col2 = static_cast<const sql::Integer *>(vals[1]);
+          if (t2_col2->val < 80) {
+            ASSERT_FALSE(t1_col2->is_null);
+            ASSERT_EQ(t1_col2->val, t2_col2->val);
+          } else {
+            ASSERT_TRUE(t1_col2->is_null);
+          }
+        },
+        nullptr));
+    return std::make_unique<MultiChecker>(std::move(checks));
+  });
+}
+
 }  // namespace tpl::sql::codegen
@@ -0,0 +1,134 @@
+#include <filesystem>
+#include <limits>
+#include <memory>
+
+#include "common/settings.h"
+#include "sql/catalog.h"
+#include "sql/planner/plannodes/hash_join_plan_node.h"
+#include "sql/planner/plannodes/seq_scan_plan_node.h"
+#include "sql/table.h"
+#include "vm/bytecode_profile.h"
+#include "vm/llvm_engine.h"
+#include "vm/module.h"
+
+// Tests
+#include "sql/codegen/output_checker.h"
+#include "sql/planner/expression_maker.h"
+#include "sql/planner/output_schema_util.h"
+#include "util/codegen_test_harness.h"
+
+namespace tpl::sql::codegen {
+
+class PerPipelineCompilationTest : public CodegenBasedTest {
+ protected:
+  void TearDown() override {
+    Settings::Instance()->Set(Settings::Name::PerPipelineCompilation, true);
+    Settings::Instance()->Set(Settings::Name::AdaptiveCompilationThreshold, int64_t{10000});
+    CodegenBasedTest::TearDown();
+  }
+
+  // SELECT t1.col2, t2.col2 FROM small_1 AS t1 INNER JOIN small_1 AS t2 ON t1.col2 = t2.col2
+  //  WHERE t2.col2 < 80;
+  std::unique_ptr<planner::AbstractPlanNode> MakeSelfJoin() {
+    auto accessor = sql::Catalog::Instance();
+    auto table = accessor->LookupTableByName("small_1");
+
+    // Scan small_1.
+    planner::OutputSchemaHelper seq_scan_out1(&expr_maker_, 0);
+    seq_scan_out1.AddOutput("col2", expr_maker_.CVE(table->GetSchema().GetColumnInfo("col2")));
+    auto seq_scan1 = planner::SeqScanPlanNode::Builder()
+                         .SetOutputSchema(seq_scan_out1.MakeSchema())
+                         .SetTableOid(table->GetId())
+                         .Build();
+
+    // Scan small_1 with predicate: col2 < 80.
+    planner::OutputSchemaHelper seq_scan_out2(&expr_maker_, 1);
+    auto col2 = expr_maker_.CVE(table->GetSchema().GetColumnInfo("col2"));
+    seq_scan_out2.AddOutput("col2", col2);
+    auto seq_scan2 = planner::SeqScanPlanNode::Builder()
+                         .SetOutputSchema(seq_scan_out2.MakeSchema())
+                         .SetScanPredicate(expr_maker_.CompareLt(col2, expr_maker_.Constant(80)))
+                         .SetTableOid(table->GetId())
+                         .Build();
+
+    // Hash join plan.
+    planner::OutputSchemaHelper hash_join_out(&expr_maker_, 0);
+    auto t1_col2 = seq_scan_out1.GetOutput("col2");
+    auto t2_col2 = seq_scan_out2.GetOutput("col2");
+    hash_join_out.AddOutput("t1.col2", t1_col2);
+    hash_join_out.AddOutput("t2.col2", t2_col2);
+    return planner::HashJoinPlanNode::Builder()
+        .AddChild(std::move(seq_scan1))
+        .AddChild(std::move(seq_scan2))
+        .SetOutputSchema(hash_join_out.MakeSchema())
+        .SetJoinType(planner::LogicalJoinType::INNER)
+        .AddLeftHashKey(t1_col2)
+        .AddRightHashKey(t2_col2)
+        .SetJoinPredicate(expr_maker_.CompareEq(t1_col2, t2_col2))
+        .Build();
+  }
+
+  // Run the query in the given mode, and check it produces the join's 80 rows.
+  static void RunAndCheck(ExecutableQuery *query, const planner::AbstractPlanNode &plan,
+                          vm::ExecutionMode mode) {
+    TupleCounterChecker checker(80);
+    OutputCollectorAndChecker store(&checker, plan.GetOutputSchema());
+    sql::MemoryPool memory(nullptr);
+    sql::ExecutionContext exec_ctx(&memory, plan.GetOutputSchema(), &store);
+    query->Run(&exec_ctx, mode);
+    checker.CheckCorrectness();
+  }
+
+ private:
+  planner::ExpressionMaker expr_maker_;
+};
+
+TEST_F(PerPipelineCompilationTest, ModulePerPipelineTest) {
+  auto hash_join_plan = MakeSelfJoin();
+  for (const auto per_pipeline : {false, true}) {
+    Settings::Instance()->Set(Settings::Name::PerPipelineCompilation, per_pipeline);
+    auto query = CompilationContext::Compile(*hash_join_plan);
+
+    // When compiled separately, the build and probe pipelines each get a module of their own, next
+    // to the module holding query-level logic.
+    EXPECT_EQ(per_pipeline ? 3u : 1u, query->GetModules().size());
+    RunAndCheck(query.get(), *hash_join_plan, vm::ExecutionMode::Interpret);
+  }
+}
+
+TEST_F(PerPipelineCompilationTest, AdaptiveRunProfilesEachModuleTest) {
+  // Profile without compiling.
+  Settings::Instance()->Set(Settings::Name::AdaptiveCompilationThreshold,
+                            std::numeric_limits<int64_t>::max());
+
+  auto hash_join_plan = MakeSelfJoin();
+  auto query = CompilationContext::Compile(*hash_join_plan);
+  ASSERT_EQ(3u, query->GetModules().size());
+  RunAndCheck(query.get(), *hash_join_plan, vm::ExecutionMode::Adaptive);
+
+  // An adaptive run doesn't compile modules up front. Each module is profiled,
+  // and would be compiled once its profile is warm.
+  for (const auto &module : query->GetModules()) {
+    ASSERT_NE(nullptr, module->GetProfile());
+    EXPECT_LT(0u, module->GetProfile()->GetTotalCount());
+  }
+}
+
+TEST_F(PerPipelineCompilationTest, DestroyAdaptiveQueryWhileCompilingTest) {
+  // The JIT needs the bytecode handlers' bitcode, built alongside the tests.
+  if (!std::filesystem::exists(vm::LLVMEngine::CompilerOptions().GetBytecodeHandlersBcPath())) {
+    GTEST_SKIP() << "Bytecode handlers bitcode isn't available";
+  }
+
+  // Compile each module as soon as it has run.
+  Settings::Instance()->Set(Settings::Name::AdaptiveCompilationThreshold, int64_t{1});
+
+  auto hash_join_plan = MakeSelfJoin();
+  auto query = CompilationContext::Compile(*hash_join_plan);
+  RunAndCheck(query.get(), *hash_join_plan, vm::ExecutionMode::Adaptive);
+
+  // Compilations are likely still pending. Destroying the query waits for them.
+  query.reset();
+}
+
+}  // namespace tpl::sql::codegen
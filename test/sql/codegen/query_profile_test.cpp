@@ -0,0 +1,152 @@
+#include <memory>
+#include <numeric>
+#include <sstream>
+
+#include "sql/catalog.h"
+#include "sql/planner/plannodes/hash_join_plan_node.h"
+#include "sql/planner/plannodes/seq_scan_plan_node.h"
+#include "sql/query_profile.h"
+#include "sql/table.h"
+
+// Tests
+#include "sql/planner/expression_maker.h"
+#include "sql/planner/output_schema_util.h"
+#include "util/codegen_test_harness.h"
+
+namespace tpl::sql::codegen {
+
+class QueryProfileTest : public CodegenBasedTest {
+ protected:
+  void TearDown() override {
+    Settings::Instance()->Set(Settings::Name::ProfileQueries, false);
+    CodegenBasedTest::TearDown();
+  }
+};
+
+TEST_F(QueryProfileTest, UnprofiledQueryTest) {
+  // SELECT colA FROM test_1;
+  auto accessor = sql::Catalog::Instance();
+  planner::ExpressionMaker expr_maker;
+  sql::Table *table = accessor->LookupTableByName("test_1");
+
+  planner::OutputSchemaHelper seq_scan_out(&expr_maker, 0);
+  seq_scan_out.AddOutput("colA", expr_maker.CVE(table->GetSchema().GetColumnInfo("colA")));
+  auto seq_scan = planner::SeqScanPlanNode::Builder{}
+                      .SetOutputSchema(seq_scan_out.MakeSchema())
+                      .SetTableOid(table->GetId())
+                      .Build();
+
+  Settings::Instance()->Set(Settings::Name::ProfileQueries, false);
+  auto query = CompilationContext::Compile(*seq_scan);
+  NoOpResultConsumer consumer;
+  sql::MemoryPool memory(nullptr);
+  sql::ExecutionContext exec_ctx(&memory, seq_scan->GetOutputSchema(), &consumer);
+  query->Run(&exec_ctx);
+
+  EXPECT_FALSE(query->IsProfiled());
+  EXPECT_EQ(nullptr, query->GetProfile());
+  EXPECT_EQ(nullptr, exec_ctx.GetQueryProfile());
+}
+
+TEST_F(QueryProfileTest, ProfileHashJoinTest) {
+  // SELECT t1.colA, t2.col1 FROM test_1 AS t1 INNER JOIN test_2 AS t2 ON t1.colA = t2.col2
+  //  WHERE t1.colA < 100 AND t2.col2 < 500;
+  auto accessor = sql::Catalog::Instance();
+  planner::ExpressionMaker expr_maker;
+
+  // Build side: 100 rows.
+  sql::Table *t1 = accessor->LookupTableByName("test_1");
+  planner::OutputSchemaHelper seq_scan_out1(&expr_maker, 0);
+  auto t1_col_a = expr_maker.CVE(t1->GetSchema().GetColumnInfo("colA"));
+  seq_scan_out1.AddOutput("colA", t1_col_a);
+  auto seq_scan1 = planner::SeqScanPlanNode::Builder{}
+                       .SetOutputSchema(seq_scan_out1.MakeSchema())
+                       .SetScanPredicate(expr_maker.CompareLt(t1_col_a, expr_maker.Constant(100)))
+                       .SetTableOid(t1->GetId())
+                       .Build();
+  const auto seq_scan1_plan = seq_scan1.get();
+
+  // Probe side: 500 rows.
+  sql::Table *t2 = accessor->LookupTableByName("test_2");
+  planner::OutputSchemaHelper seq_scan_out2(&expr_maker, 1);
+  auto t2_col1 = expr_maker.CVE(t2->GetSchema().GetColumnInfo("col1"));
+  auto t2_col2 = expr_maker.CVE(t2->GetSchema().GetColumnInfo("col2"));
+  seq_scan_out2.AddOutput("col1", t2_col1);
+  seq_scan_out2.AddOutput("col2", t2_col2);
+  auto seq_scan2 = planner::SeqScanPlanNode::Builder{}
+                       .SetOutputSchema(seq_scan_out2.MakeSchema())
+                       .SetScanPredicate(expr_maker.CompareLt(t2_col2, expr_maker.Constant(500)))
+                       .SetTableOid(t2->GetId())
+                       .Build();
+  const auto seq_scan2_plan = seq_scan2.get();
+
+  // Join: 100 rows.
+  planner::OutputSchemaHelper hash_join_out(&expr_maker, 0);
+  auto col_a = seq_scan_out1.GetOutput("colA");
+  auto col1 = seq_scan_out2.GetOutput("col1");
+  auto col2 = seq_scan_out2.GetOutput("col2");
+  hash_join_out.AddOutput("colA", col_a);
+  hash_join_out.AddOutput("col1", col1);
+  auto hash_join = planner::HashJoinPlanNode::Builder{}
+                       .AddChild(std::move(seq_scan1))
+                       .AddChild(std::move(seq_scan2))
+                       .SetOutputSchema(hash_join_out.MakeSchema())
+                       .SetJoinType(planner::LogicalJoinType::INNER)
+                       .AddLeftHashKey(col_a)
+                       .AddRightHashKey(col2)
+                       .SetJoinPredicate(expr_maker.CompareEq(col_a, col2))
+                       .Build();
+
+  Settings::Instance()->Set(Settings::Name::ProfileQueries, true);
+  for (const auto parallel : {false, true}) {
+    Settings::Instance()->Set(Settings::Name::ParallelQueryExecution, parallel);
+    auto query = CompilationContext::Compile(*hash_join);
+    ASSERT_TRUE(query->IsProfiled());
+
+    // Run twice. Statistics should reflect only the most recent run.
+    for (uint32_t run = 0; run < 2; run++) {
+      NoOpResultConsumer consumer;
+      sql::MemoryPool memory(nullptr);
+      sql::ExecutionContext exec_ctx(&memory, hash_join->GetOutputSchema(), &consumer);
+      query->Run(&exec_ctx);
+      EXPECT_EQ(nullptr, exec_ctx.GetQueryProfile());
+    }
+
+    const QueryProfile *profile = query->GetProfile();
+    ASSERT_NE(nullptr, profile);
+    EXPECT_EQ(100u, profile->GetNumTuples(query->GetOperatorId(*seq_scan1_plan)));
+    EXPECT_EQ(500u, profile->GetNumTuples(query->GetOperatorId(*seq_scan2_plan)));
+    EXPECT_EQ(100u, profile->GetNumTuples(query->GetOperatorId(*hash_join)));
+
+    // The join ends the build pipeline, but its output is counted in the probe pipeline.
+    EXPECT_TRUE(query->IsOperatorCounted(*seq_scan1_plan));
+    EXPECT_TRUE(query->IsOperatorCounted(*seq_scan2_plan));
+    EXPECT_TRUE(query->IsOperatorCounted(*hash_join));
+
+    // Every pipeline processed at least one morsel in at least one thread.
+    for (uint32_t pipeline_id = 0; pipeline_id < 2; pipeline_id++) {
+      const auto morsels = profile->GetMorselsPerThread(pipeline_id);
+      EXPECT_FALSE(morsels.empty());
+      EXPECT_LT(0u, std::accumulate(morsels.begin(), morsels.end(), uint64_t{0}));
+      if (!parallel) {
+        EXPECT_EQ(1u, morsels.size());
+      }
+      EXPECT_LE(0.0, profile->GetPipelineTime(pipeline_id));
+    }
+
+    std::stringstream ss;
+    query->PrintProfile(ss);
+    const auto explain = ss.str();
+    EXPECT_NE(std::string::npos,
+              explain.find("HashJoin (rows_in=600, rows_out=100, hash_table_entries=100)"))
+        << explain;
+    EXPECT_NE(std::string::npos, explain.find("SequentialScan (rows_out=500)")) << explain;
+
+    // Counters only cover the coordinating thread, so they aren't shown for parallel pipelines.
+    if (parallel) {
+      EXPECT_EQ(std::string::npos, explain.find("ipc=")) << explain;
+    }
+  }
+}
+
+}  // namespace tpl::sql::codegen
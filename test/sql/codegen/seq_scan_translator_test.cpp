@@ -67,6 +67,45 @@ TEST_F(SeqScanTranslatorTest, ScanTest) {
   });
 }
 
+TEST_F(SeqScanTranslatorTest, ScanWithBetweenFilterTest) {
+  // SELECT col1 FROM test_1 WHERE col1 BETWEEN 100 AND 499;
+  auto accessor = sql::Catalog::Instance();
+  planner::ExpressionMaker expr_maker;
+  sql::Table *table = accessor->LookupTableByName("test_1");
+  const auto &table_schema = table->GetSchema();
+
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  planner::OutputSchemaHelper seq_scan_out{&expr_maker, 0};
+  {
+    // Get Table columns
+    auto col1 = expr_maker.CVE(table_schema.GetColumnInfo("colA"));
+    seq_scan_out.AddOutput("col1", col1);
+    // Make predicate
+    auto predicate =
+        expr_maker.CompareBetween(col1, expr_maker.Constant(100), expr_maker.Constant(499));
+    // Build
+    seq_scan = planner::SeqScanPlanNode::Builder{}
+                   .SetOutputSchema(seq_scan_out.MakeSchema())
+                   .SetScanPredicate(predicate)
+                   .SetTableOid(table->GetId())
+                   .Build();
+  }
+
+  // Run and check.
+  ExecuteAndCheckInAllModes(*seq_scan, [&]() {
+    // Checkers:
+    // 1. 'cola' is serial, so exactly 400 rows fall within the (inclusive) range.
+    // 2. Every selected value is within the range.
+    // clang-format off
+    std::vector<std::unique_ptr<OutputChecker>> checks;
+    checks.emplace_back(std::make_unique<TupleCounterChecker>(400));
+    checks.emplace_back(std::make_unique<SingleColumnValueChecker<Integer>>(std::greater_equal<>(), 0, 100));
+    checks.emplace_back(std::make_unique<SingleColumnValueChecker<Integer>>(std::less_equal<>(), 0, 499));
+    return std::make_unique<MultiChecker>(std::move(checks));
+    // clang-format on
+  });
+}
+
 TEST_F(SeqScanTranslatorTest, ScanWithNullCheckTest) {
   // SELECT colb FROM test_1 WHERE cola IS NULL;
   auto accessor = sql::Catalog::Instance();
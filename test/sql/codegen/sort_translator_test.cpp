@@ -19,6 +19,13 @@ using namespace std::chrono_literals;
 
 class SortTranslatorTest : public CodegenBasedTest {
  protected:
+  // Statistics change the plans of later tests in this binary, so drop them.
+  void TearDown() override {
+    auto catalog = sql::Catalog::Instance();
+    catalog->ClearTableStatistics(catalog->LookupTableByName("small_1")->GetId());
+    CodegenBasedTest::TearDown();
+  }
+
   void TestSortWithLimitAndOrOffset(uint64_t off, uint64_t lim) {
     // SELECT col1, col2 FROM test_1 ORDER BY col2 ASC OFFSET off LIMIT lim;
 
@@ -240,4 +247,14 @@ TEST_F(SortTranslatorTest, SortWithLimitAndOffsetTest) {
   TestSortWithLimitAndOrOffset(50000000, 50000000);
 }
 
+TEST_F(SortTranslatorTest, PresizedSortWithLimitAndOffsetTest) {
+  // With statistics, the sorter reserves room for the expected number of rows.
+  const auto table = sql::Catalog::Instance()->LookupTableByName("small_1");
+  sql::Catalog::Instance()->AnalyzeTable(table->GetId());
+  TestSortWithLimitAndOrOffset(0, 0);
+  TestSortWithLimitAndOrOffset(0, 10);
+  TestSortWithLimitAndOrOffset(100, 0);
+  TestSortWithLimitAndOrOffset(50000000, 50000000);
+}
+
 }  // namespace tpl::sql::codegen
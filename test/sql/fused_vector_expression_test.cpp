@@ -0,0 +1,380 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "common/exception.h"
+#include "sql/fused_vector_expression.h"
+#include "sql/tuple_id_list.h"
+#include "sql/vector.h"
+#include "sql/vector_projection.h"
+
+// Tests
+#include "sql/planner/expression_maker.h"
+#include "util/test_harness.h"
+
+namespace tpl::sql {
+
+class FusedVectorExpressionTest : public TplTest {
+ protected:
+  // Fill a projection with 'num_tuples' tuples: [a:integer, b:double, c:double]. a[i] = i - 10,
+  // b[i] = (i % 10) / 100.0, and c[i] = (i % 5) / 100.0.
+  static void FillProjection(VectorProjection *vp, const uint32_t num_tuples) {
+    vp->Initialize({TypeId::Integer, TypeId::Double, TypeId::Double});
+    vp->Reset(num_tuples);
+    auto a = reinterpret_cast<int32_t *>(vp->GetColumn(0)->GetData());
+    auto b = reinterpret_cast<double *>(vp->GetColumn(1)->GetData());
+    auto c = reinterpret_cast<double *>(vp->GetColumn(2)->GetData());
+    for (uint32_t i = 0; i < num_tuples; i++) {
+      a[i] = static_cast<int32_t>(i) - 10;
+      b[i] = (i % 10) / 100.0;
+      c[i] = (i % 5) / 100.0;
+    }
+  }
+
+  static const std::vector<TypeId> &Schema() {
+    static const std::vector<TypeId> schema = {TypeId::Integer, TypeId::Double, TypeId::Double};
+    return schema;
+  }
+
+  planner::ExpressionMaker expr_maker_;
+};
+
+TEST_F(FusedVectorExpressionTest, Unsupported) {
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto b = expr_maker_.CVE(1, Type::DoubleType(false));
+
+  // OR isn't supported.
+  auto or_expr = expr_maker_.ConjunctionOr(expr_maker_.CompareLt(a, expr_maker_.Constant(1)),
+                                           expr_maker_.CompareLt(b, expr_maker_.Constant(1.0f)));
+  EXPECT_THROW(FusedVectorExpression::Compile(*or_expr, Schema()), NotImplementedException);
+
+  // Neither are string constants, unknown columns, or CASE inside arithmetic.
+  EXPECT_THROW(
+      FusedVectorExpression::Compile(*expr_maker_.OpSum(a, expr_maker_.Constant("s")), Schema()),
+      NotImplementedException);
+  EXPECT_THROW(
+      FusedVectorExpression::Compile(*expr_maker_.CVE(5, Type::IntegerType(false)), Schema()),
+      Exception);
+  auto case_expr = expr_maker_.Case({{expr_maker_.CompareLt(a, expr_maker_.Constant(1)), a}});
+  EXPECT_THROW(FusedVectorExpression::Compile(*expr_maker_.OpSum(case_expr, a), Schema()),
+               NotImplementedException);
+  EXPECT_THROW(FusedVectorExpression::Compile(*expr_maker_.Case({{a, a}}), Schema()),
+               NotImplementedException);
+}
+
+TEST_F(FusedVectorExpressionTest, DivisionByConstantZero) {
+  VectorProjection vp;
+  FillProjection(&vp, 100);
+
+  // Division by a literal zero is NULL in every row, whether the dividend is a column or constant.
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  for (const auto &expr : {expr_maker_.OpDiv(a, expr_maker_.Constant(0)),
+                           expr_maker_.OpDiv(expr_maker_.Constant(4), expr_maker_.Constant(0)),
+                           expr_maker_.OpSum(expr_maker_.OpDiv(a, expr_maker_.Constant(0.0f)),
+                                             expr_maker_.Constant(1))}) {
+    auto fused = FusedVectorExpression::Compile(*expr, Schema());
+    Vector result(fused->GetResultType(), true, false);
+    fused->Evaluate(vp, &result);
+    EXPECT_EQ(100u, result.GetSize());
+    for (uint32_t i = 0; i < 100; i++) {
+      EXPECT_TRUE(result.IsNull(i));
+    }
+  }
+}
+
+TEST_F(FusedVectorExpressionTest, IntegerArithmetic) {
+  VectorProjection vp;
+  FillProjection(&vp, 1000);
+
+  // (a * 3 - (2 + 4)) / a
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto expr = expr_maker_.OpDiv(
+      expr_maker_.OpMin(expr_maker_.OpMul(a, expr_maker_.Constant(3)),
+                        expr_maker_.OpSum(expr_maker_.Constant(2), expr_maker_.Constant(4))),
+      a);
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  EXPECT_FALSE(fused->IsPredicate());
+  EXPECT_EQ(TypeId::BigInt, fused->GetResultType());
+
+  Vector result(TypeId::BigInt, true, false);
+  fused->Evaluate(vp, &result);
+  EXPECT_EQ(1000u, result.GetSize());
+  EXPECT_EQ(nullptr, result.GetFilteredTupleIdList());
+
+  // Division by zero, when a = 0, produces NULL.
+  const auto data = reinterpret_cast<const int64_t *>(result.GetData());
+  for (uint32_t i = 0; i < 1000; i++) {
+    const int64_t a_val = static_cast<int64_t>(i) - 10;
+    if (a_val == 0) {
+      EXPECT_TRUE(result.IsNull(i));
+    } else {
+      EXPECT_FALSE(result.IsNull(i));
+      EXPECT_EQ((a_val * 3 - 6) / a_val, data[i]);
+    }
+  }
+
+  // The wrong result type is rejected.
+  Vector bad_result(TypeId::Double, true, false);
+  EXPECT_THROW(fused->Evaluate(vp, &bad_result), TypeMismatchException);
+}
+
+TEST_F(FusedVectorExpressionTest, FilteredFloatingPointArithmetic) {
+  VectorProjection vp;
+  FillProjection(&vp, 2000);
+
+  // Keep every third tuple, and make a few NULL.
+  TupleIdList tids(vp.GetTotalTupleCount());
+  for (uint32_t i = 0; i < vp.GetTotalTupleCount(); i += 3) tids.Add(i);
+  vp.SetFilteredSelections(tids);
+  vp.GetColumn(2)->GetMutableNullMask()->Set(4);
+  vp.GetColumn(2)->GetMutableNullMask()->Set(30);
+
+  // The TPC-H Q1 charge: a * (1 - b) * (1 + c)
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto b = expr_maker_.CVE(1, Type::DoubleType(false));
+  auto c = expr_maker_.CVE(2, Type::DoubleType(true));
+  auto one = expr_maker_.Constant(1.0f);
+  auto expr = expr_maker_.OpMul(expr_maker_.OpMul(a, expr_maker_.OpMin(one, b)),
+                                expr_maker_.OpSum(one, c));
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  EXPECT_EQ(TypeId::Double, fused->GetResultType());
+
+  Vector result(TypeId::Double, true, false);
+  fused->Evaluate(vp, &result);
+  EXPECT_EQ(vp.GetSelectedTupleCount(), result.GetCount());
+  ASSERT_NE(nullptr, result.GetFilteredTupleIdList());
+
+  const auto data = reinterpret_cast<const double *>(result.GetData());
+  for (uint32_t i = 0; i < vp.GetTotalTupleCount(); i += 3) {
+    if (i == 30) {
+      EXPECT_TRUE(result.GetNullMask()[i]);
+      continue;
+    }
+    EXPECT_FALSE(result.GetNullMask()[i]);
+    const double expected = (static_cast<double>(i) - 10) * (1 - (i % 10) / 100.0) *
+                            (1 + (i % 5) / 100.0);
+    EXPECT_DOUBLE_EQ(expected, data[i]);
+  }
+}
+
+TEST_F(FusedVectorExpressionTest, MixedIntegerDivision) {
+  VectorProjection vp;
+  FillProjection(&vp, 1000);
+
+  // (a / 4) * (b + 1): the division truncates even though the product is floating-point.
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto b = expr_maker_.CVE(1, Type::DoubleType(false));
+  auto expr = expr_maker_.OpMul(expr_maker_.OpDiv(a, expr_maker_.Constant(4)),
+                                expr_maker_.OpSum(b, expr_maker_.Constant(1.0f)));
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  EXPECT_EQ(TypeId::Double, fused->GetResultType());
+
+  Vector result(TypeId::Double, true, false);
+  fused->Evaluate(vp, &result);
+  const auto data = reinterpret_cast<const double *>(result.GetData());
+  for (uint32_t i = 0; i < 1000; i++) {
+    const int64_t a_val = static_cast<int64_t>(i) - 10;
+    const double expected = static_cast<double>(a_val / 4) * ((i % 10) / 100.0 + 1.0);
+    EXPECT_FALSE(result.IsNull(i));
+    EXPECT_DOUBLE_EQ(expected, data[i]) << "tid " << i;
+  }
+
+  // a / 3 * 3 < b + a: exact for multiples of three only, where it holds for all b > 0.
+  auto pred = expr_maker_.CompareLt(
+      expr_maker_.OpMul(expr_maker_.OpDiv(a, expr_maker_.Constant(3)), expr_maker_.Constant(3)),
+      expr_maker_.OpSum(b, a));
+  auto fused_pred = FusedVectorExpression::Compile(*pred, Schema());
+  EXPECT_TRUE(fused_pred->IsPredicate());
+
+  TupleIdList tids(vp.GetTotalTupleCount());
+  tids.AddAll();
+  fused_pred->Select(vp, &tids);
+  for (uint32_t i = 0; i < 1000; i++) {
+    const int64_t a_val = static_cast<int64_t>(i) - 10;
+    const bool expected =
+        static_cast<double>(a_val / 3 * 3) < (i % 10) / 100.0 + static_cast<double>(a_val);
+    EXPECT_EQ(expected, tids.Contains(i)) << "tid " << i;
+  }
+}
+
+TEST_F(FusedVectorExpressionTest, OverflowingDivision) {
+  constexpr int64_t kMin = std::numeric_limits<int64_t>::min();
+
+  // [x:bigint, y:bigint] with x = INT64_MIN, and y cycling through -1, 0, and 2.
+  VectorProjection vp;
+  vp.Initialize({TypeId::BigInt, TypeId::BigInt});
+  vp.Reset(30);
+  auto x = reinterpret_cast<int64_t *>(vp.GetColumn(0)->GetData());
+  auto y = reinterpret_cast<int64_t *>(vp.GetColumn(1)->GetData());
+  for (uint32_t i = 0; i < 30; i++) {
+    x[i] = kMin;
+    y[i] = static_cast<int64_t>(i % 3) * 3 / 2 - 1;
+  }
+  const std::vector<TypeId> schema = {TypeId::BigInt, TypeId::BigInt};
+
+  // Dividing the smallest value by -1 wraps around, both by a column and by a constant.
+  auto x_col = expr_maker_.CVE(0, Type::BigIntType(false));
+  auto y_col = expr_maker_.CVE(1, Type::BigIntType(false));
+  for (auto divisor : {y_col, expr_maker_.Constant(-1)}) {
+    auto fused = FusedVectorExpression::Compile(*expr_maker_.OpDiv(x_col, divisor), schema);
+    Vector result(TypeId::BigInt, true, false);
+    fused->Evaluate(vp, &result);
+    const auto data = reinterpret_cast<const int64_t *>(result.GetData());
+    for (uint32_t i = 0; i < 30; i++) {
+      const int64_t y_val = divisor == y_col ? y[i] : -1;
+      EXPECT_EQ(y_val == 0, result.IsNull(i)) << "tid " << i;
+      if (y_val == -1) {
+        EXPECT_EQ(kMin, data[i]) << "tid " << i;
+      } else if (y_val == 2) {
+        EXPECT_EQ(kMin / 2, data[i]) << "tid " << i;
+      }
+    }
+  }
+}
+
+TEST_F(FusedVectorExpressionTest, Select) {
+  VectorProjection vp;
+  FillProjection(&vp, 2048);
+  vp.GetColumn(1)->GetMutableNullMask()->Set(20);
+
+  // a * 2 >= 10 AND b < 0.05
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto b = expr_maker_.CVE(1, Type::DoubleType(true));
+  auto expr = expr_maker_.ConjunctionAnd(
+      expr_maker_.CompareGe(expr_maker_.OpMul(a, expr_maker_.Constant(2)),
+                            expr_maker_.Constant(10)),
+      expr_maker_.CompareLt(b, expr_maker_.Constant(0.05f)));
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  EXPECT_TRUE(fused->IsPredicate());
+
+  // Start with only the even TIDs.
+  TupleIdList tids(vp.GetTotalTupleCount());
+  for (uint32_t i = 0; i < vp.GetTotalTupleCount(); i += 2) tids.Add(i);
+  fused->Select(vp, &tids);
+
+  uint32_t expected_count = 0;
+  for (uint32_t i = 0; i < vp.GetTotalTupleCount(); i++) {
+    const bool expected = i % 2 == 0 && i != 20 && (static_cast<int64_t>(i) - 10) * 2 >= 10 &&
+                          (i % 10) / 100.0 < static_cast<double>(0.05f);
+    EXPECT_EQ(expected, tids.Contains(i)) << "tid " << i;
+    expected_count += expected;
+  }
+  EXPECT_EQ(expected_count, tids.GetTupleCount());
+}
+
+TEST_F(FusedVectorExpressionTest, Constant) {
+  VectorProjection vp;
+  FillProjection(&vp, 100);
+
+  // 2 + 4
+  auto expr = expr_maker_.OpSum(expr_maker_.Constant(2), expr_maker_.Constant(4));
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  Vector result(TypeId::BigInt, true, false);
+  fused->Evaluate(vp, &result);
+  EXPECT_EQ(100u, result.GetCount());
+  EXPECT_FALSE(result.GetNullMask().Any());
+  for (uint32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(6, reinterpret_cast<const int64_t *>(result.GetData())[i]);
+  }
+}
+
+TEST_F(FusedVectorExpressionTest, Case) {
+  VectorProjection vp;
+  FillProjection(&vp, 2048);
+
+  // Keep every other tuple, with a NULL in 'c'.
+  TupleIdList tids(vp.GetTotalTupleCount());
+  for (uint32_t i = 0; i < vp.GetTotalTupleCount(); i += 2) tids.Add(i);
+  vp.SetFilteredSelections(tids);
+  vp.GetColumn(2)->GetMutableNullMask()->Set(100);
+
+  // The TPC-H Q14 pattern: CASE WHEN a < 500 THEN a * (1 - c) ELSE 0 END. The integer ELSE is
+  // converted to floating point, like the THEN.
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto c = expr_maker_.CVE(2, Type::DoubleType(true));
+  auto expr = expr_maker_.Case(
+      {{expr_maker_.CompareLt(a, expr_maker_.Constant(500)),
+        expr_maker_.OpMul(a, expr_maker_.OpMin(expr_maker_.Constant(1.0f), c))}},
+      expr_maker_.Constant(0));
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  EXPECT_FALSE(fused->IsPredicate());
+  EXPECT_EQ(TypeId::Double, fused->GetResultType());
+
+  Vector result(TypeId::Double, true, false);
+  fused->Evaluate(vp, &result);
+  EXPECT_EQ(vp.GetSelectedTupleCount(), result.GetCount());
+
+  const auto data = reinterpret_cast<const double *>(result.GetData());
+  for (uint32_t i = 0; i < vp.GetTotalTupleCount(); i += 2) {
+    const double a_val = static_cast<double>(i) - 10;
+    EXPECT_EQ(i == 100, result.GetNullMask()[i]) << "tid " << i;
+    if (i == 100) continue;
+    EXPECT_DOUBLE_EQ(a_val < 500 ? a_val * (1 - (i % 5) / 100.0) : 0.0, data[i]) << "tid " << i;
+  }
+}
+
+TEST_F(FusedVectorExpressionTest, NestedCaseWithoutElse) {
+  VectorProjection vp;
+  FillProjection(&vp, 1000);
+
+  // CASE WHEN a < 0 THEN -1
+  //      WHEN a < 100 THEN CASE WHEN a >= 50 THEN a / 10 ELSE a END
+  //      WHEN a < 200 THEN 100
+  // END
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto nested = expr_maker_.Case(
+      {{expr_maker_.CompareGe(a, expr_maker_.Constant(50)),
+        expr_maker_.OpDiv(a, expr_maker_.Constant(10))}},
+      a);
+  auto expr = expr_maker_.Case({
+      {expr_maker_.CompareLt(a, expr_maker_.Constant(0)), expr_maker_.Constant(-1)},
+      {expr_maker_.CompareLt(a, expr_maker_.Constant(100)), nested},
+      {expr_maker_.CompareLt(a, expr_maker_.Constant(200)), expr_maker_.Constant(100)},
+  });
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  EXPECT_EQ(TypeId::BigInt, fused->GetResultType());
+
+  Vector result(TypeId::BigInt, true, false);
+  fused->Evaluate(vp, &result);
+
+  const auto data = reinterpret_cast<const int64_t *>(result.GetData());
+  for (uint32_t i = 0; i < 1000; i++) {
+    const int64_t a_val = static_cast<int64_t>(i) - 10;
+    if (a_val >= 200) {
+      EXPECT_TRUE(result.IsNull(i));
+      continue;
+    }
+    EXPECT_FALSE(result.IsNull(i));
+    const int64_t expected =
+        a_val < 0 ? -1 : a_val < 100 ? (a_val >= 50 ? a_val / 10 : a_val) : 100;
+    EXPECT_EQ(expected, data[i]);
+  }
+}
+
+TEST_F(FusedVectorExpressionTest, CaseWithIntegerDivision) {
+  VectorProjection vp;
+  FillProjection(&vp, 1000);
+
+  // CASE WHEN a < 100 THEN a / 3 ELSE b END: the THEN truncates before it's converted to the
+  // floating-point result of the CASE.
+  auto a = expr_maker_.CVE(0, Type::IntegerType(false));
+  auto b = expr_maker_.CVE(1, Type::DoubleType(false));
+  auto expr = expr_maker_.Case(
+      {{expr_maker_.CompareLt(a, expr_maker_.Constant(100)),
+        expr_maker_.OpDiv(a, expr_maker_.Constant(3))}},
+      b);
+  auto fused = FusedVectorExpression::Compile(*expr, Schema());
+  EXPECT_EQ(TypeId::Double, fused->GetResultType());
+
+  Vector result(TypeId::Double, true, false);
+  fused->Evaluate(vp, &result);
+  const auto data = reinterpret_cast<const double *>(result.GetData());
+  for (uint32_t i = 0; i < 1000; i++) {
+    const int64_t a_val = static_cast<int64_t>(i) - 10;
+    const double expected = a_val < 100 ? static_cast<double>(a_val / 3) : (i % 10) / 100.0;
+    EXPECT_FALSE(result.IsNull(i));
+    EXPECT_DOUBLE_EQ(expected, data[i]) << "tid " << i;
+  }
+}
+
+}  // namespace tpl::sql
@@ -0,0 +1,113 @@
+#include <memory>
+
+#include "sql/catalog.h"
+#include "sql/planner/cardinality_estimator.h"
+#include "sql/planner/plannodes/aggregate_plan_node.h"
+#include "sql/planner/plannodes/order_by_plan_node.h"
+#include "sql/planner/plannodes/seq_scan_plan_node.h"
+#include "sql/table.h"
+
+// Tests
+#include "sql/planner/expression_maker.h"
+#include "sql/planner/output_schema_util.h"
+#include "util/test_harness.h"
+
+namespace tpl::sql::planner {
+
+class CardinalityEstimatorTest : public TplTest {
+ protected:
+  // Statistics change the plans of later tests in this binary, so drop them.
+  void TearDown() override {
+    auto catalog = Catalog::Instance();
+    catalog->ClearTableStatistics(catalog->LookupTableByName("test_1")->GetId());
+    TplTest::TearDown();
+  }
+};
+
+TEST_F(CardinalityEstimatorTest, ScanAggregateSortTest) {
+  // SELECT colB, colC, COUNT(*) FROM test_1 WHERE colA < 1000 GROUP BY colB, colC ORDER BY colB;
+  auto catalog = Catalog::Instance();
+  ExpressionMaker expr_maker;
+  const Table *table = catalog->LookupTableByName("test_1");
+  const auto &table_schema = table->GetSchema();
+
+  // Scan.
+  std::unique_ptr<AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{&expr_maker, 0};
+  {
+    auto col_a = expr_maker.CVE(table_schema.GetColumnInfo("colA"));
+    seq_scan_out.AddOutput("colB", expr_maker.CVE(table_schema.GetColumnInfo("colB")));
+    seq_scan_out.AddOutput("colC", expr_maker.CVE(table_schema.GetColumnInfo("colC")));
+    SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(seq_scan_out.MakeSchema())
+                   .SetScanPredicate(expr_maker.CompareLt(col_a, expr_maker.Constant(1000)))
+                   .SetTableOid(table->GetId())
+                   .Build();
+  }
+  const auto scan = seq_scan.get();
+
+  // Aggregation.
+  std::unique_ptr<AbstractPlanNode> agg;
+  OutputSchemaHelper agg_out{&expr_maker, 0};
+  {
+    agg_out.AddGroupByTerm("colB", seq_scan_out.GetOutput("colB"));
+    agg_out.AddGroupByTerm("colC", seq_scan_out.GetOutput("colC"));
+    agg_out.AddAggTerm("count", expr_maker.AggCountStar());
+    agg_out.AddOutput("colB", agg_out.GetGroupByTermForOutput("colB"));
+    agg_out.AddOutput("count", agg_out.GetAggTermForOutput("count"));
+    AggregatePlanNode::Builder builder;
+    agg = builder.SetOutputSchema(agg_out.MakeSchema())
+              .AddGroupByTerm(agg_out.GetGroupByTerm("colB"))
+              .AddGroupByTerm(agg_out.GetGroupByTerm("colC"))
+              .AddAggregateTerm(agg_out.GetAggTerm("count"))
+              .AddChild(std::move(seq_scan))
+              .SetAggregateStrategyType(AggregateStrategyType::HASH)
+              .SetHavingClausePredicate(nullptr)
+              .Build();
+  }
+  const auto agg_plan = agg.get();
+
+  // Order by.
+  std::unique_ptr<AbstractPlanNode> order_by;
+  OutputSchemaHelper order_by_out{&expr_maker, 0};
+  {
+    auto col_b = agg_out.GetOutput("colB");
+    order_by_out.AddOutput("colB", col_b);
+    OrderByPlanNode::Builder builder;
+    order_by = builder.SetOutputSchema(order_by_out.MakeSchema())
+                   .AddChild(std::move(agg))
+                   .AddSortKey(col_b, OrderByOrderingType::ASC)
+                   .Build();
+  }
+
+  // Without statistics, there are no estimates.
+  EXPECT_FALSE(CardinalityEstimator::EstimateOutputRows(*scan).has_value());
+  EXPECT_FALSE(CardinalityEstimator::EstimateGroupCount(*agg_plan).has_value());
+  EXPECT_FALSE(CardinalityEstimator::EstimateOutputRows(*order_by).has_value());
+
+  catalog->AnalyzeTable(table->GetId());
+
+  // colA is serial, so the filter keeps 5% of rows, i.e., 1000.
+  const auto scan_rows = CardinalityEstimator::EstimateOutputRows(*scan);
+  ASSERT_TRUE(scan_rows.has_value());
+  EXPECT_NEAR(1000.0, *scan_rows, 100.0);
+
+  // colB has ten distinct values, traced through the scan's output.
+  const auto col_b_distinct =
+      CardinalityEstimator::EstimateDistinctValues(*agg_plan, *agg_out.GetGroupByTerm("colB"));
+  ASSERT_TRUE(col_b_distinct.has_value());
+  EXPECT_EQ(10u, *col_b_distinct);
+
+  // colC has 10000 distinct values. Combined with colB, there are more possible groups than rows
+  // surviving the filter, so the group count is bound by the input.
+  const auto num_groups = CardinalityEstimator::EstimateGroupCount(*agg_plan);
+  ASSERT_TRUE(num_groups.has_value());
+  EXPECT_EQ(*scan_rows, *num_groups);
+
+  // Sorting doesn't change cardinality. Grouping keys are traced through the aggregation.
+  EXPECT_EQ(num_groups, CardinalityEstimator::EstimateOutputRows(*order_by));
+  EXPECT_EQ(col_b_distinct,
+            CardinalityEstimator::EstimateDistinctValues(*order_by, *agg_out.GetOutput("colB")));
+}
+
+}  // namespace tpl::sql::planner
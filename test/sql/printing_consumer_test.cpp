@@ -0,0 +1,58 @@
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "common/exception.h"
+#include "sql/memory_pool.h"
+#include "sql/planner/plannodes/output_schema.h"
+#include "sql/printing_consumer.h"
+#include "sql/result_buffer.h"
+#include "sql/value.h"
+
+// Tests
+#include "sql/planner/expression_maker.h"
+#include "util/test_harness.h"
+
+namespace tpl::sql {
+
+class PrintingConsumerTest : public TplTest {
+ protected:
+  planner::ExpressionMaker expr_maker_;
+};
+
+TEST_F(PrintingConsumerTest, DecimalTest) {
+  // [integer, decimal(10,2), decimal(18,4)]
+  const planner::OutputSchema schema({
+      planner::OutputSchema::Column(expr_maker_.CVE(0, Type::IntegerType(false))),
+      planner::OutputSchema::Column(expr_maker_.CVE(1, Type::DecimalType(true, 10, 2))),
+      planner::OutputSchema::Column(expr_maker_.CVE(2, Type::DecimalType(false, 18, 4))),
+  });
+  const auto &offsets = schema.GetColumnOffsets();
+
+  std::stringstream ss;
+  PrintingConsumer consumer(ss, &schema);
+  MemoryPool memory(nullptr);
+  ResultBuffer buffer(&memory, schema, &consumer);
+  const auto write = [&](int64_t a, DecimalVal b, DecimalVal c) {
+    byte *tuple = buffer.AllocOutputSlot();
+    *reinterpret_cast<Integer *>(tuple + offsets[0]) = Integer(a);
+    *reinterpret_cast<DecimalVal *>(tuple + offsets[1]) = b;
+    *reinterpret_cast<DecimalVal *>(tuple + offsets[2]) = c;
+  };
+  write(1, DecimalVal(int64_t{1234}), DecimalVal(int64_t{-5}));
+  write(2, DecimalVal::Null(), DecimalVal(int64_t{123456789}));
+  buffer.Finalize();
+
+  // Decimals are printed with the scale of their column.
+  EXPECT_EQ("1,12.34,-0.0005\n2,NULL,12345.6789\n", ss.str());
+}
+
+TEST_F(PrintingConsumerTest, WideDecimalTest) {
+  // Decimals wider than 64 bits can't be output.
+  std::vector<planner::OutputSchema::Column> columns = {
+      planner::OutputSchema::Column(expr_maker_.CVE(0, Type::DecimalType(false, 38, 2))),
+  };
+  EXPECT_THROW(planner::OutputSchema schema(columns), NotImplementedException);
+}
+
+}  // namespace tpl::sql
@@ -1,3 +1,6 @@
+#include <limits>
+#include <string>
+
 #include "sql/runtime_types.h"
 #include "common/exception.h"
 #include "util/test_harness.h"
@@ -57,6 +60,12 @@ TEST_F(RuntimeTypesTest, DateFromString) {
   EXPECT_THROW({ d = Date::FromString("50000000-1289217-12"); }, ConversionException);
   EXPECT_THROW({ d = Date::FromString("da fuk?"); }, ConversionException);
   EXPECT_THROW({ d = Date::FromString("-1-1-23"); }, ConversionException);
+
+  // Invalid, in the fixed YYYY-MM-DD format.
+  EXPECT_THROW({ d = Date::FromString("1999-02-29"); }, ConversionException);
+  EXPECT_THROW({ d = Date::FromString("1999-13-01"); }, ConversionException);
+  EXPECT_THROW({ d = Date::FromString("1999-1a-01"); }, ConversionException);
+  EXPECT_THROW({ d = Date::FromString("0000-01-01"); }, ConversionException);
 }
 
 TEST_F(RuntimeTypesTest, DateComparisons) {
@@ -196,4 +205,70 @@ TEST_F(RuntimeTypesTest, VarlenComparisons) {
   }
 }
 
+TEST_F(RuntimeTypesTest, DecimalFromString) {
+  // Simple values.
+  EXPECT_EQ(1234, Decimal64::FromString("12.34", 10, 2));
+  EXPECT_EQ(-1234, Decimal64::FromString("-12.34", 10, 2));
+  EXPECT_EQ(1200, Decimal64::FromString("12", 10, 2));
+  EXPECT_EQ(1230, Decimal64::FromString(" +12.3 ", 10, 2));
+  EXPECT_EQ(50, Decimal64::FromString(".5", 10, 2));
+  EXPECT_EQ(0, Decimal64::FromString("-0.00", 10, 2));
+  EXPECT_EQ(12, Decimal32::FromString("12", 9, 0));
+
+  // Extra fractional digits are rounded half away from zero.
+  EXPECT_EQ(1235, Decimal64::FromString("12.345", 10, 2));
+  EXPECT_EQ(1234, Decimal64::FromString("12.3449", 10, 2));
+  EXPECT_EQ(-1235, Decimal64::FromString("-12.345", 10, 2));
+
+  // 128-bit decimals.
+  EXPECT_EQ(Decimal128::PowerOfTen(37) * 9 + 1,
+            Decimal128::FromString("9" + std::string(36, '0') + ".1", 38, 1));
+
+  // Overflow.
+  EXPECT_EQ(999999, Decimal64::FromString("9999.99", 6, 2));
+  EXPECT_THROW(Decimal64::FromString("99999.99", 6, 2), Exception);
+  EXPECT_THROW(Decimal64::FromString("9999.999", 6, 2), Exception);
+  EXPECT_THROW(Decimal64::FromString("1", 2, 2), Exception);
+
+  // Invalid input.
+  EXPECT_THROW(Decimal64::FromString("", 10, 2), ConversionException);
+  EXPECT_THROW(Decimal64::FromString("-", 10, 2), ConversionException);
+  EXPECT_THROW(Decimal64::FromString("1.2.3", 10, 2), ConversionException);
+  // Bytes outside ASCII are never whitespace or digits.
+  EXPECT_THROW(Decimal64::FromString("\xA0" "12.34", 10, 2), ConversionException);
+  EXPECT_THROW(Decimal64::FromString("12a", 10, 2), ConversionException);
+}
+
+TEST_F(RuntimeTypesTest, DecimalToString) {
+  EXPECT_EQ("12.34", Decimal64(1234).ToString(2));
+  EXPECT_EQ("-12.34", Decimal64(-1234).ToString(2));
+  EXPECT_EQ("0.05", Decimal64(5).ToString(2));
+  EXPECT_EQ("-0.005", Decimal64(-5).ToString(3));
+  EXPECT_EQ("0", Decimal64(0).ToString(0));
+  EXPECT_EQ("1234", Decimal32(1234).ToString(0));
+  EXPECT_EQ("-9223372036854775808", Decimal64(std::numeric_limits<int64_t>::min()).ToString(0));
+  EXPECT_EQ("1" + std::string(30, '0') + ".00000001",
+            Decimal128(Decimal128::PowerOfTen(38) + 1).ToString(8));
+
+  // Round trip.
+  for (const auto str : {"0.001", "-123456.789", "999999999999.999"}) {
+    EXPECT_EQ(str, Decimal64::FromString(str, 15, 3).ToString(3));
+  }
+}
+
+TEST_F(RuntimeTypesTest, DecimalRescale) {
+  // Up.
+  EXPECT_EQ(123400, Decimal64(1234).Rescale(2, 4));
+  EXPECT_EQ(-1234, Decimal64(-1234).Rescale(2, 2));
+  EXPECT_THROW(Decimal64(1).Rescale(0, 19), Exception);
+  EXPECT_THROW(Decimal32(1000).Rescale(0, 7), Exception);
+
+  // Down, rounding half away from zero.
+  EXPECT_EQ(123, Decimal64(1234).Rescale(2, 1));
+  EXPECT_EQ(124, Decimal64(1235).Rescale(2, 1));
+  EXPECT_EQ(-124, Decimal64(-1235).Rescale(2, 1));
+  EXPECT_EQ(0, Decimal64(4999).Rescale(4, 0));
+  EXPECT_EQ(1, Decimal64(5000).Rescale(4, 0));
+}
+
 }  // namespace tpl::sql
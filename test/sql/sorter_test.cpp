@@ -153,6 +153,28 @@ TEST_F(SorterTest, SortTest) {
   TestAllIntegral(TestSortRandomTupleSize, num_iters, max_elems, &generator_);
 }
 
+TEST_F(SorterTest, OverestimatedSizeTest) {
+  // A wildly overestimated input size only reserves a bounded amount of space
+  // up front; the sorter grows as tuples arrive.
+  const auto cmp_fn = [](const void *a, const void *b) -> bool {
+    return *reinterpret_cast<const uint32_t *>(a) < *reinterpret_cast<const uint32_t *>(b);
+  };
+  MemoryPool memory(nullptr);
+  Sorter sorter(&memory, cmp_fn, sizeof(uint32_t), std::numeric_limits<uint32_t>::max());
+
+  const uint32_t num_elems = Sorter::kMaxPresizedTupleCount + 10;
+  for (uint32_t i = 0; i < num_elems; i++) {
+    *reinterpret_cast<uint32_t *>(sorter.AllocInputTuple()) = num_elems - i;
+  }
+  sorter.Sort();
+
+  EXPECT_EQ(num_elems, sorter.GetTupleCount());
+  uint32_t expected = 1;
+  for (SorterIterator iter(sorter); iter.HasNext(); ++iter) {
+    EXPECT_EQ(expected++, *reinterpret_cast<const uint32_t *>(*iter));
+  }
+}
+
 TEST_F(SorterTest, TopKTest) {
   const uint32_t num_iters = 5;
   const uint32_t max_elems = 10000;
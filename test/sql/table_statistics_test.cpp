@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "sql/catalog.h"
+#include "sql/table.h"
+#include "sql/table_statistics.h"
+#include "util/bit_util.h"
+#include "util/test_harness.h"
+
+namespace tpl::sql {
+
+class TableStatisticsTest : public TplTest {
+ protected:
+  // Statistics change the plans of later tests in this binary, so drop them.
+  void TearDown() override {
+    auto catalog = Catalog::Instance();
+    catalog->ClearTableStatistics(catalog->LookupTableByName("test_1")->GetId());
+    TplTest::TearDown();
+  }
+};
+
+TEST_F(TableStatisticsTest, SkewedNullableColumnTest) {
+  // A nullable integer column over two blocks. Every tenth row is NULL, a quarter of all rows are
+  // the value 7, and the rest are spread evenly over [0, 1000).
+  constexpr uint32_t kNumBlocks = 2, kBlockSize = 10000;
+  std::vector<Schema::ColumnInfo> cols = {{"a", Type::IntegerType(true)}};
+  Table table(Catalog::Instance()->AllocateTableId(), "skewed",
+              std::make_unique<Schema>(std::move(cols)));
+  for (uint32_t b = 0; b < kNumBlocks; b++) {
+    auto data = static_cast<int32_t *>(std::malloc(kBlockSize * sizeof(int32_t)));
+    auto nulls = static_cast<uint32_t *>(
+        std::calloc(util::BitUtil::Num32BitWordsFor(kBlockSize), sizeof(uint32_t)));
+    for (uint32_t i = 0; i < kBlockSize; i++) {
+      data[i] = i % 4 == 0 ? 7 : i % 1000;
+      if (i % 10 == 9) util::BitUtil::Set(nulls, i);
+    }
+    std::vector<ColumnSegment> segments;
+    segments.emplace_back(Type::IntegerType(true), reinterpret_cast<byte *>(data), nulls,
+                          kBlockSize);
+    table.Insert(Table::Block(std::move(segments), kBlockSize));
+  }
+
+  const auto stats = TableStatistics::Compute(table);
+  EXPECT_EQ(kNumBlocks * kBlockSize, stats->GetRowCount());
+  ASSERT_EQ(1u, stats->GetColumnCount());
+
+  const auto &col_stats = stats->GetColumnStatistics(0);
+  EXPECT_EQ(kNumBlocks * kBlockSize, col_stats.GetRowCount());
+  EXPECT_EQ(kNumBlocks * kBlockSize / 10, col_stats.GetNullCount());
+  EXPECT_DOUBLE_EQ(0.1, col_stats.GetNullFraction());
+  EXPECT_EQ(GenericValue::CreateInteger(1), col_stats.GetMin());
+  EXPECT_EQ(GenericValue::CreateInteger(998), col_stats.GetMax());
+
+  // Values that are multiples of four or end in nine never appear, leaving 650 distinct values.
+  // The estimate is approximate.
+  EXPECT_NEAR(650.0, col_stats.GetDistinctCount(), 650.0 * 0.05);
+
+  // The histogram spans the value range, in order.
+  const auto &bounds = col_stats.GetHistogramBounds();
+  ASSERT_EQ(ColumnStatistics::kMaxHistogramBuckets + 1, bounds.size());
+  EXPECT_EQ(col_stats.GetMin(), bounds.front());
+  EXPECT_EQ(col_stats.GetMax(), bounds.back());
+  EXPECT_TRUE(std::is_sorted(bounds.begin(), bounds.end()));
+
+  // The skewed value is the most common.
+  const auto &mcvs = col_stats.GetMostCommonValues();
+  ASSERT_FALSE(mcvs.empty());
+  EXPECT_EQ(GenericValue::CreateInteger(7), mcvs[0].first);
+  EXPECT_NEAR(0.25, mcvs[0].second, 0.02);
+
+  // Selectivity estimates.
+  EXPECT_NEAR(0.25, col_stats.EstimateEqualSelectivity(GenericValue::CreateInteger(7)), 0.02);
+  EXPECT_NEAR(0.65 / 650, col_stats.EstimateEqualSelectivity(GenericValue::CreateInteger(501)),
+              0.0002);
+  EXPECT_EQ(0.0, col_stats.EstimateEqualSelectivity(GenericValue::CreateInteger(5000)));
+  EXPECT_EQ(0.0, col_stats.EstimateLessThanSelectivity(GenericValue::CreateInteger(1)));
+  EXPECT_DOUBLE_EQ(0.9, col_stats.EstimateLessThanSelectivity(GenericValue::CreateInteger(1000)));
+  // Roughly 0.25 from the value 7, plus half of the remaining 0.65.
+  EXPECT_NEAR(0.25 + 0.65 / 2,
+              col_stats.EstimateLessThanSelectivity(GenericValue::CreateInteger(500)), 0.05);
+}
+
+TEST_F(TableStatisticsTest, AnalyzeCatalogTableTest) {
+  auto catalog = Catalog::Instance();
+  const auto table = catalog->LookupTableByName("test_1");
+
+  // Unknown tables cannot be analyzed.
+  EXPECT_EQ(nullptr, catalog->AnalyzeTable(std::numeric_limits<uint16_t>::max()));
+  const auto stats = catalog->AnalyzeTable(table->GetId());
+  ASSERT_NE(nullptr, stats);
+  EXPECT_EQ(stats, catalog->LookupTableStatisticsById(table->GetId()));
+  EXPECT_EQ(table->GetTupleCount(), stats->GetRowCount());
+  EXPECT_EQ(table->GetSchema().GetColumnCount(), stats->GetColumnCount());
+
+  // colA is a serial column: every value is distinct and there are no common values.
+  const auto &col_a = stats->GetColumnStatistics(0);
+  EXPECT_EQ(0u, col_a.GetNullCount());
+  EXPECT_EQ(GenericValue::CreateInteger(0), col_a.GetMin());
+  EXPECT_EQ(GenericValue::CreateInteger(table->GetTupleCount() - 1), col_a.GetMax());
+  EXPECT_NEAR(table->GetTupleCount(), col_a.GetDistinctCount(), table->GetTupleCount() * 0.05);
+  EXPECT_TRUE(col_a.GetMostCommonValues().empty());
+
+  // colB is uniform over [0, 9].
+  const auto &col_b = stats->GetColumnStatistics(1);
+  EXPECT_EQ(10u, col_b.GetDistinctCount());
+  EXPECT_EQ(GenericValue::CreateInteger(0), col_b.GetMin());
+  EXPECT_EQ(GenericValue::CreateInteger(9), col_b.GetMax());
+
+  // Cleared statistics are gone.
+  catalog->ClearTableStatistics(table->GetId());
+  EXPECT_EQ(nullptr, catalog->LookupTableStatisticsById(table->GetId()));
+}
+
+}  // namespace tpl::sql
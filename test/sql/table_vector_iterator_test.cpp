@@ -69,6 +69,59 @@ TEST_F(TableVectorIteratorTest, SimpleIteratorTest) {
   EXPECT_EQ(iter.GetTable()->GetTupleCount(), num_tuples);
 }
 
+TEST_F(TableVectorIteratorTest, ColumnSubsetIteratorTest) {
+  //
+  // Scan (colD, colA) of test_1 and check columns are only loaded when first
+  // accessed, after any filters have been applied.
+  //
+
+  TableVectorIterator iter(TableIdToNum(TableId::Test1), {3, 0});
+
+  EXPECT_TRUE(iter.Init());
+
+  uint64_t num_tuples = 0, num_selected = 0, col_a_sum = 0;
+  TupleIdList tids(kDefaultVectorSize);
+  while (iter.Advance()) {
+    VectorProjection *vp = iter.GetVectorProjection();
+    ASSERT_EQ(2u, vp->GetColumnCount());
+    EXPECT_TRUE(vp->IsColumnDeferred(0));
+    EXPECT_TRUE(vp->IsColumnDeferred(1));
+
+    // Select the tuples with an even colA.
+    const Vector *col_a = vp->GetColumn(1);
+    EXPECT_FALSE(vp->IsColumnDeferred(1));
+    auto col_a_data = reinterpret_cast<const int32_t *>(col_a->GetData());
+    tids.Resize(vp->GetTotalTupleCount());
+    tids.Clear();
+    for (uint32_t i = 0; i < vp->GetTotalTupleCount(); i++) {
+      col_a_sum += col_a_data[i];
+      if (col_a_data[i] % 2 == 0) tids.Add(i);
+    }
+    num_tuples += vp->GetTotalTupleCount();
+    vp->SetFilteredSelections(tids);
+
+    // colD is still deferred. Loading it should pick up the filter.
+    EXPECT_TRUE(vp->IsColumnDeferred(0));
+    const Vector *col_d = vp->GetColumn(0);
+    EXPECT_FALSE(vp->IsColumnDeferred(0));
+    EXPECT_EQ(TypeId::Integer, col_d->GetTypeId());
+    EXPECT_EQ(tids.GetTupleCount(), col_d->GetCount());
+    EXPECT_EQ(vp->GetFilteredTupleIdList(), col_d->GetFilteredTupleIdList());
+    auto col_d_data = reinterpret_cast<const int32_t *>(col_d->GetData());
+    tids.ForEach([&](uint64_t i) {
+      EXPECT_GE(col_d_data[i], 0);
+      EXPECT_LE(col_d_data[i], 99999);
+    });
+    num_selected += col_d->GetCount();
+  }
+
+  // colA is a serial column.
+  const uint64_t table_size = iter.GetTable()->GetTupleCount();
+  EXPECT_EQ(table_size, num_tuples);
+  EXPECT_EQ(table_size / 2, num_selected);
+  EXPECT_EQ(table_size * (table_size - 1) / 2, col_a_sum);
+}
+
 TEST_F(TableVectorIteratorTest, ParallelScanTest) {
   //
   // Simple test to ensure we iterate over the whole table in parallel
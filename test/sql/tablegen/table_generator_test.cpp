@@ -0,0 +1,85 @@
+#include <string_view>
+#include <unordered_set>
+
+#include "sql/catalog.h"
+#include "sql/table.h"
+#include "sql/tablegen/table_generator.h"
+#include "util/sql_test_harness.h"
+
+namespace tpl::sql::tablegen {
+
+class TableGeneratorTest : public SqlBasedTest {
+ protected:
+  // Invoke the callback for every row in the given column of the table.
+  template <typename T, typename F>
+  static void ForEach(const Table *table, const std::string &col_name, F &&f) {
+    const auto col_idx = table->GetSchema().GetColumnInfo(col_name).oid;
+    for (const auto &block : *table) {
+      const ColumnSegment *col = block.GetColumnData(col_idx);
+      for (uint32_t i = 0; i < block.num_tuples(); i++) {
+        f(col->TypedAccessAt<T>(i));
+      }
+    }
+  }
+};
+
+TEST_F(TableGeneratorTest, GenerateTPCH) {
+  auto catalog = Catalog::Instance();
+  TableGenerator::GenerateTPCHTables(catalog, 0.01);
+
+  // Fixed cardinalities.
+  EXPECT_EQ(2000u, catalog->LookupTableByName("tpch.part")->GetTupleCount());
+  EXPECT_EQ(100u, catalog->LookupTableByName("tpch.supplier")->GetTupleCount());
+  EXPECT_EQ(8000u, catalog->LookupTableByName("tpch.partsupp")->GetTupleCount());
+  EXPECT_EQ(1500u, catalog->LookupTableByName("tpch.customer")->GetTupleCount());
+  EXPECT_EQ(15000u, catalog->LookupTableByName("tpch.orders")->GetTupleCount());
+  EXPECT_EQ(25u, catalog->LookupTableByName("tpch.nation")->GetTupleCount());
+  EXPECT_EQ(5u, catalog->LookupTableByName("tpch.region")->GetTupleCount());
+
+  // Orders have between one and seven line items.
+  const auto lineitem = catalog->LookupTableByName("tpch.lineitem");
+  EXPECT_GE(lineitem->GetTupleCount(), 15000u);
+  EXPECT_LE(lineitem->GetTupleCount(), 7 * 15000u);
+
+  // Every line item belongs to a valid order and part.
+  std::unordered_set<int32_t> order_keys;
+  ForEach<int32_t>(catalog->LookupTableByName("tpch.orders"), "o_orderkey",
+                   [&](auto key) { EXPECT_TRUE(order_keys.insert(key).second); });
+  ForEach<int32_t>(lineitem, "l_orderkey",
+                   [&](auto key) { EXPECT_EQ(1u, order_keys.count(key)); });
+  ForEach<int32_t>(lineitem, "l_partkey", [&](auto key) {
+    EXPECT_GE(key, 1);
+    EXPECT_LE(key, 2000);
+  });
+
+  // Ship dates fall after order dates, within the TPC-H date range.
+  const auto min_date = Date::FromYMD(1992, 1, 1), max_date = Date::FromYMD(1998, 12, 31);
+  ForEach<Date>(lineitem, "l_shipdate", [&](auto date) {
+    EXPECT_LE(min_date, date);
+    EXPECT_GE(max_date, date);
+  });
+
+  // Flags only take their allowed values.
+  ForEach<VarlenEntry>(lineitem, "l_returnflag", [&](auto flag) {
+    EXPECT_NE(std::string_view::npos, std::string_view("RAN").find(flag.GetStringView()));
+  });
+}
+
+TEST_F(TableGeneratorTest, GenerateSSBM) {
+  auto catalog = Catalog::Instance();
+  TableGenerator::GenerateSSBMTables(catalog, 0.01);
+
+  EXPECT_EQ(2000u, catalog->LookupTableByName("ssbm.part")->GetTupleCount());
+  EXPECT_EQ(20u, catalog->LookupTableByName("ssbm.supplier")->GetTupleCount());
+  EXPECT_EQ(300u, catalog->LookupTableByName("ssbm.customer")->GetTupleCount());
+  EXPECT_EQ(2557u, catalog->LookupTableByName("ssbm.date")->GetTupleCount());
+
+  // Every line order date references a date in the date dimension.
+  std::unordered_set<int32_t> date_keys;
+  ForEach<int32_t>(catalog->LookupTableByName("ssbm.date"), "d_datekey",
+                   [&](auto key) { date_keys.insert(key); });
+  ForEach<int32_t>(catalog->LookupTableByName("ssbm.lineorder"), "lo_orderdate",
+                   [&](auto key) { EXPECT_EQ(1u, date_keys.count(key)); });
+}
+
+}  // namespace tpl::sql::tablegen
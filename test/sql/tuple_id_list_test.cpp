@@ -1,3 +1,6 @@
+#include <random>
+#include <vector>
+
 #include "sql/tuple_id_list.h"
 #include "util/test_harness.h"
 
@@ -290,4 +293,158 @@ TEST_F(TupleIdListTest, ToString) {
   }
 }
 
+TEST_F(TupleIdListTest, AdaptiveRepresentation) {
+  using Repr = TupleIdList::Representation;
+
+  TupleIdList list(kDefaultVectorSize);
+  EXPECT_EQ(Repr::Range, list.GetRepresentation());
+
+  // Full and partial ranges.
+  list.AddAll();
+  EXPECT_EQ(Repr::Range, list.GetRepresentation());
+  EXPECT_TRUE(list.IsFull());
+  list.Clear();
+  list.AddRange(10, 20);
+  list.AddRange(20, 30);
+  EXPECT_EQ(Repr::Range, list.GetRepresentation());
+  EXPECT_EQ(20u, list.GetTupleCount());
+  EXPECT_EQ(15u, list[5]);
+
+  // Trimming either end of a range leaves a range.
+  TupleIdList other(kDefaultVectorSize);
+  other.AddRange(0, 15);
+  list.UnsetFrom(other);
+  EXPECT_EQ(Repr::Range, list.GetRepresentation());
+  EXPECT_EQ(15u, list.GetTupleCount());
+
+  // Removing NULLs from a vector without any keeps the range.
+  list.AddAll();
+  util::BitVector<uint64_t> no_nulls(kDefaultVectorSize);
+  list.UnsetFrom(no_nulls);
+  EXPECT_EQ(Repr::Range, list.GetRepresentation());
+  EXPECT_TRUE(list.IsFull());
+
+  // A dense filter produces a bitmap.
+  list.Filter([](auto tid) { return tid % 2 == 0; });
+  EXPECT_EQ(Repr::Bitmap, list.GetRepresentation());
+  EXPECT_EQ(kDefaultVectorSize / 2, list.GetTupleCount());
+
+  // Filtering a sparse list switches to a selection vector.
+  list.Filter([](auto tid) { return tid % 64 == 0; });
+  list.Filter([](auto tid) { return tid % 128 == 0; });
+  EXPECT_EQ(Repr::Selection, list.GetRepresentation());
+  EXPECT_EQ(kDefaultVectorSize / 128, list.GetTupleCount());
+  EXPECT_TRUE(list.Contains(128));
+  EXPECT_FALSE(list.Contains(64));
+  EXPECT_EQ(256u, list[2]);
+
+  sel_t sel[kDefaultVectorSize];
+  ASSERT_EQ(kDefaultVectorSize / 128, list.ToSelectionVector(sel));
+  for (uint32_t i = 0; i < kDefaultVectorSize / 128; i++) {
+    EXPECT_EQ(i * 128, sel[i]);
+  }
+
+  // Point updates switch to a bitmap.
+  list.Add(1);
+  EXPECT_EQ(Repr::Bitmap, list.GetRepresentation());
+  EXPECT_EQ(kDefaultVectorSize / 128 + 1, list.GetTupleCount());
+}
+
+TEST_F(TupleIdListTest, RepresentationsAgree) {
+  // Apply the same random operations to a list and to a plain bit vector, and check they agree.
+  constexpr uint32_t num_tids = 300;
+  std::mt19937 gen(17);
+  std::uniform_int_distribution<uint32_t> tid_dist(0, num_tids - 1), op_dist(0, 9);
+
+  // Build a random list, exercising a different representation depending on the seed.
+  const auto make_random = [&](TupleIdList *list, util::BitVector<uint64_t> *expected) {
+    list->Clear();
+    expected->Reset();
+    uint32_t a = tid_dist(gen), b = tid_dist(gen);
+    if (a > b) std::swap(a, b);
+    switch (op_dist(gen) % 4) {
+      case 0:
+        list->AddRange(a, b);
+        expected->SetRange(a, b);
+        break;
+      case 1:
+        list->AddAll();
+        expected->SetAll();
+        list->Filter([&](auto tid) { return tid % 37 == a % 37; });
+        expected->UpdateFull([&](auto tid) { return tid % 37 == a % 37; });
+        // The list is now sparse, so this switches it to a selection vector.
+        list->Filter([](auto tid) { return true; });
+        break;
+      case 2:
+        for (uint32_t i = 0; i < 20; i++) {
+          const auto tid = tid_dist(gen);
+          list->Add(tid);
+          expected->Set(tid);
+        }
+        break;
+      default:
+        list->AddAll();
+        expected->SetAll();
+        break;
+    }
+  };
+
+  const auto check = [](const TupleIdList &list, const util::BitVector<uint64_t> &expected) {
+    EXPECT_EQ(expected.CountOnes(), list.GetTupleCount());
+    EXPECT_EQ(expected.All(), list.IsFull());
+    EXPECT_EQ(expected.None(), list.IsEmpty());
+    for (uint32_t tid = 0; tid < num_tids; tid++) {
+      EXPECT_EQ(expected.Test(tid), list.Contains(tid));
+    }
+    std::vector<std::size_t> tids;
+    list.ForEach([&](std::size_t tid) { tids.push_back(tid); });
+    ASSERT_EQ(expected.CountOnes(), tids.size());
+    for (uint32_t i = 0; i < tids.size(); i++) {
+      EXPECT_EQ(expected.NthOne(i), tids[i]);
+      EXPECT_EQ(expected.NthOne(i), list[i]);
+    }
+  };
+
+  TupleIdList list(num_tids), other(num_tids);
+  util::BitVector<uint64_t> expected(num_tids), expected_other(num_tids);
+  for (uint32_t round = 0; round < 500; round++) {
+    make_random(&list, &expected);
+    make_random(&other, &expected_other);
+    switch (op_dist(gen)) {
+      case 0:
+        list.IntersectWith(other);
+        expected.Intersect(expected_other);
+        break;
+      case 1:
+        list.UnionWith(other);
+        expected.Union(expected_other);
+        break;
+      case 2:
+        list.UnsetFrom(other);
+        expected.Difference(expected_other);
+        break;
+      case 3:
+        list.AssignFrom(other);
+        expected.Copy(expected_other);
+        break;
+      case 4:
+        list.IntersectWith(expected_other);
+        expected.Intersect(expected_other);
+        break;
+      case 5:
+        list.UnsetFrom(expected_other);
+        expected.Difference(expected_other);
+        break;
+      case 6:
+        list.Filter([](auto tid) { return tid % 3 != 0; });
+        expected.UpdateFull([](auto tid) { return tid % 3 != 0; });
+        break;
+      default:
+        break;
+    }
+    check(list, expected);
+    check(other, expected_other);
+  }
+}
+
 }  // namespace tpl::sql
@@ -0,0 +1,75 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "sql/vector_calibration.h"
+#include "util/test_harness.h"
+
+namespace tpl::sql {
+
+class VectorCalibrationTest : public TplTest {
+ protected:
+  void SetUp() override {
+    TplTest::SetUp();
+    path_ = (std::filesystem::temp_directory_path() / "tpl_vector_calibration_test.conf").string();
+    std::filesystem::remove(path_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(path_);
+    TplTest::TearDown();
+  }
+
+  std::string path_;
+};
+
+TEST_F(VectorCalibrationTest, StoreAndLoadTest) {
+  EXPECT_FALSE(VectorCalibration::Load(path_, "CPU A").has_value());
+
+  VectorCalibration::Thresholds a = {{Settings::Name::FullSelectOptThreshold, 0.3},
+                                     {Settings::Name::FullHashOptThreshold, 0.45}};
+  VectorCalibration::Thresholds b = {{Settings::Name::FullSelectOptThreshold, 0.1}};
+  VectorCalibration::Store(path_, "CPU A", a);
+  VectorCalibration::Store(path_, "CPU B", b);
+
+  // Each model has its own entry.
+  EXPECT_EQ(a, VectorCalibration::Load(path_, "CPU A"));
+  EXPECT_EQ(b, VectorCalibration::Load(path_, "CPU B"));
+  EXPECT_FALSE(VectorCalibration::Load(path_, "CPU C").has_value());
+
+  // Storing replaces the model's entry, leaving others intact.
+  a[Settings::Name::FullSelectOptThreshold] = 0.5;
+  VectorCalibration::Store(path_, "CPU A", a);
+  EXPECT_EQ(a, VectorCalibration::Load(path_, "CPU A"));
+  EXPECT_EQ(b, VectorCalibration::Load(path_, "CPU B"));
+
+  // Unknown settings are ignored.
+  {
+    std::ofstream file(path_, std::ios::app);
+    file << "[CPU D]" << std::endl << "NoSuchSetting = 1.0" << std::endl;
+  }
+  EXPECT_EQ(VectorCalibration::Thresholds{}, VectorCalibration::Load(path_, "CPU D"));
+}
+
+TEST_F(VectorCalibrationTest, CalibrateTest) {
+  auto settings = Settings::Instance();
+
+  const auto thresholds = VectorCalibration::Calibrate();
+  EXPECT_EQ(5u, thresholds.size());
+
+  VectorCalibration::Thresholds original;
+  for (const auto &[name, value] : thresholds) {
+    EXPECT_GE(value, 0.0);
+    EXPECT_LE(value, 1.0);
+    original[name] = settings->GetDouble(name);
+  }
+
+  // Applying the thresholds updates the settings.
+  VectorCalibration::Apply(thresholds);
+  for (const auto &[name, value] : thresholds) {
+    EXPECT_EQ(value, settings->GetDouble(name));
+  }
+  VectorCalibration::Apply(original);
+}
+
+}  // namespace tpl::sql
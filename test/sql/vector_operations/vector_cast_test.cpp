@@ -166,6 +166,41 @@ TEST_F(VectorCastTest, CastStringToFloat) {
   EXPECT_EQ(GenericValue::CreateFloat(910), a->GetValue(5));
 }
 
+TEST_F(VectorCastTest, CastStringToInteger) {
+  // a = [NULL, "-123", "12345678901234", "0042"]
+  auto a = MakeVarcharVector({{}, "-123", "12345678901234", "0042"}, {true, false, false, false});
+
+  EXPECT_NO_THROW(a->Cast(TypeId::BigInt));
+
+  EXPECT_EQ(TypeId::BigInt, a->GetTypeId());
+  EXPECT_TRUE(a->IsNull(0));
+  EXPECT_EQ(GenericValue::CreateBigInt(-123), a->GetValue(1));
+  EXPECT_EQ(GenericValue::CreateBigInt(12345678901234), a->GetValue(2));
+  EXPECT_EQ(GenericValue::CreateBigInt(42), a->GetValue(3));
+
+  // Out-of-range and non-numeric strings.
+  EXPECT_THROW(MakeVarcharVector({"99999999999999999999"}, {false})->Cast(TypeId::BigInt),
+               ValueOutOfRangeException);
+  EXPECT_THROW(MakeVarcharVector({"40000"}, {false})->Cast(TypeId::SmallInt),
+               ValueOutOfRangeException);
+  EXPECT_THROW(MakeVarcharVector({"x"}, {false})->Cast(TypeId::Integer),
+               ValueOutOfRangeException);
+}
+
+TEST_F(VectorCastTest, CastStringToDate) {
+  // a = [NULL, "1992-01-02", "1998-12-1", " 2000-02-29 "]
+  auto a = MakeVarcharVector({{}, "1992-01-02", "1998-12-1", " 2000-02-29 "},
+                             {true, false, false, false});
+
+  EXPECT_NO_THROW(a->Cast(TypeId::Date));
+
+  EXPECT_EQ(TypeId::Date, a->GetTypeId());
+  EXPECT_TRUE(a->IsNull(0));
+  EXPECT_EQ(GenericValue::CreateDate(1992, 1, 2), a->GetValue(1));
+  EXPECT_EQ(GenericValue::CreateDate(1998, 12, 1), a->GetValue(2));
+  EXPECT_EQ(GenericValue::CreateDate(2000, 2, 29), a->GetValue(3));
+}
+
 TEST_F(VectorCastTest, CastNumericToString) {
   // int16 -> string
   {
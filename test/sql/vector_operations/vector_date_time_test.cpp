@@ -0,0 +1,152 @@
+#include <vector>
+
+#include "common/exception.h"
+#include "sql/constant_vector.h"
+#include "sql/tuple_id_list.h"
+#include "sql/vector.h"
+#include "sql/vector_operations/vector_operations.h"
+#include "util/sql_test_harness.h"
+#include "util/test_harness.h"
+
+namespace tpl::sql {
+
+class VectorDateTimeTest : public TplTest {};
+
+TEST_F(VectorDateTimeTest, InvalidInputs) {
+  auto dates = MakeDateVector(10);
+  auto ints = MakeIntegerVector(10);
+  auto bigints = MakeBigIntVector(10);
+  Vector int_result(TypeId::Integer, true, false);
+  Vector date_result(TypeId::Date, true, false);
+
+  EXPECT_THROW(VectorOps::DateExtract(*ints, DatePart::Year, &int_result), InvalidTypeException);
+  EXPECT_THROW(VectorOps::DateExtract(*dates, DatePart::Year, &date_result),
+               TypeMismatchException);
+  EXPECT_THROW(VectorOps::DateTrunc(*dates, DatePart::Year, &int_result), TypeMismatchException);
+  EXPECT_THROW(VectorOps::DateTrunc(*dates, DatePart::DayOfWeek, &date_result),
+               NotImplementedException);
+  EXPECT_THROW(VectorOps::DateAddDays(*dates, *bigints, &date_result), TypeMismatchException);
+  EXPECT_THROW(VectorOps::DateAddMonths(*ints, *ints, &date_result), TypeMismatchException);
+}
+
+TEST_F(VectorDateTimeTest, ExtractMatchesScalar) {
+  // Check every day from 1650 to 2350, which crosses both ends of the calendar lookup tables.
+  const int32_t first = Date::FromYMD(1650, 1, 1).ToNative();
+  const int32_t last = Date::FromYMD(2350, 12, 31).ToNative();
+
+  auto dates = MakeDateVector(kDefaultVectorSize);
+  auto timestamps = MakeTimestampVector(kDefaultVectorSize);
+  Vector result(TypeId::Integer, true, false);
+
+  for (int32_t start = first; start <= last; start += kDefaultVectorSize) {
+    const uint32_t n = std::min<int32_t>(kDefaultVectorSize, last - start + 1);
+    dates->Resize(n);
+    timestamps->Resize(n);
+    auto date_data = reinterpret_cast<Date *>(dates->GetData());
+    auto ts_data = reinterpret_cast<Timestamp *>(timestamps->GetData());
+    for (uint32_t i = 0; i < n; i++) {
+      date_data[i] = Date::FromNative(start + i);
+      // Noon, to check the time is dropped.
+      ts_data[i] = Timestamp::FromNative(date_data[i].ConvertToTimestamp().ToNative() +
+                                         12 * kMicroSecondsPerHour);
+    }
+
+    const auto check = [&](const Vector &input, DatePart part, auto expected) {
+      VectorOps::DateExtract(input, part, &result);
+      ASSERT_EQ(n, result.GetCount());
+      const auto data = reinterpret_cast<const int32_t *>(result.GetData());
+      for (uint32_t i = 0; i < n; i++) {
+        ASSERT_EQ(expected(ts_data[i]), data[i]) << date_data[i].ToString();
+      }
+    };
+
+    for (const Vector *input : {dates.get(), timestamps.get()}) {
+      check(*input, DatePart::Year, [](Timestamp t) { return t.ExtractYear(); });
+      check(*input, DatePart::Quarter, [](Timestamp t) { return (t.ExtractMonth() - 1) / 3 + 1; });
+      check(*input, DatePart::Month, [](Timestamp t) { return t.ExtractMonth(); });
+      check(*input, DatePart::Day, [](Timestamp t) { return t.ExtractDay(); });
+      check(*input, DatePart::DayOfWeek, [](Timestamp t) { return t.ExtractDayOfWeek(); });
+      check(*input, DatePart::DayOfYear, [](Timestamp t) { return t.ExtractDayOfYear(); });
+    }
+  }
+}
+
+TEST_F(VectorDateTimeTest, ExtractWithFilterAndNulls) {
+  auto dates = MakeDateVector(
+      {Date::FromYMD(1992, 1, 2), Date::FromYMD(1996, 2, 29), Date::FromYMD(1998, 12, 1),
+       Date::FromYMD(2000, 3, 1), Date::FromYMD(1500, 7, 4)},
+      {false, true, false, false, false});
+  TupleIdList tids(dates->GetSize());
+  tids = {0, 1, 2, 4};
+  dates->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+
+  Vector result(TypeId::Integer, true, false);
+  VectorOps::DateExtract(*dates, DatePart::Month, &result);
+  EXPECT_EQ(4u, result.GetCount());
+  EXPECT_EQ(GenericValue::CreateInteger(1), result.GetValue(0));
+  EXPECT_TRUE(result.IsNull(1));
+  EXPECT_EQ(GenericValue::CreateInteger(12), result.GetValue(2));
+  EXPECT_EQ(GenericValue::CreateInteger(7), result.GetValue(3));
+}
+
+TEST_F(VectorDateTimeTest, Trunc) {
+  auto dates = MakeDateVector({Date::FromYMD(1995, 8, 17), Date::FromYMD(2000, 12, 31),
+                               Date::FromYMD(1600, 5, 5)},
+                              {false, false, false});
+  Vector result(TypeId::Date, true, false);
+
+  VectorOps::DateTrunc(*dates, DatePart::Year, &result);
+  EXPECT_EQ(GenericValue::CreateDate(1995, 1, 1), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateDate(2000, 1, 1), result.GetValue(1));
+  EXPECT_EQ(GenericValue::CreateDate(1600, 1, 1), result.GetValue(2));
+
+  VectorOps::DateTrunc(*dates, DatePart::Quarter, &result);
+  EXPECT_EQ(GenericValue::CreateDate(1995, 7, 1), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateDate(2000, 10, 1), result.GetValue(1));
+  EXPECT_EQ(GenericValue::CreateDate(1600, 4, 1), result.GetValue(2));
+
+  VectorOps::DateTrunc(*dates, DatePart::Month, &result);
+  EXPECT_EQ(GenericValue::CreateDate(1995, 8, 1), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateDate(2000, 12, 1), result.GetValue(1));
+  EXPECT_EQ(GenericValue::CreateDate(1600, 5, 1), result.GetValue(2));
+
+  // Timestamps are truncated to midnight.
+  auto timestamps = MakeTimestampVector({Timestamp::FromYMDHMS(1995, 8, 17, 13, 45, 10)}, {false});
+  Vector ts_result(TypeId::Timestamp, true, false);
+  VectorOps::DateTrunc(*timestamps, DatePart::Day, &ts_result);
+  EXPECT_EQ(GenericValue::CreateTimestamp(Timestamp::FromYMDHMS(1995, 8, 17, 0, 0, 0)),
+            ts_result.GetValue(0));
+  VectorOps::DateTrunc(*timestamps, DatePart::Month, &ts_result);
+  EXPECT_EQ(GenericValue::CreateTimestamp(Timestamp::FromYMDHMS(1995, 8, 1, 0, 0, 0)),
+            ts_result.GetValue(0));
+}
+
+TEST_F(VectorDateTimeTest, AddDaysAndMonths) {
+  auto dates = MakeDateVector({Date::FromYMD(1994, 1, 1), Date::FromYMD(2020, 1, 31),
+                               Date::FromYMD(1999, 12, 31), Date::FromYMD(1998, 3, 31)},
+                              {false, false, false, true});
+  Vector result(TypeId::Date, true, false);
+
+  // dates + 90 days
+  VectorOps::DateAddDays(*dates, ConstantVector(GenericValue::CreateInteger(90)), &result);
+  EXPECT_EQ(GenericValue::CreateDate(1994, 4, 1), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateDate(2020, 4, 30), result.GetValue(1));
+  EXPECT_EQ(GenericValue::CreateDate(2000, 3, 30), result.GetValue(2));
+  EXPECT_TRUE(result.IsNull(3));
+
+  // dates + [3, 1, 2, 1] months. Days past the end of the month are clamped.
+  auto months = MakeIntegerVector({3, 1, 2, 1}, {false, false, false, false});
+  VectorOps::DateAddMonths(*dates, *months, &result);
+  EXPECT_EQ(GenericValue::CreateDate(1994, 4, 1), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateDate(2020, 2, 29), result.GetValue(1));
+  EXPECT_EQ(GenericValue::CreateDate(2000, 2, 29), result.GetValue(2));
+  EXPECT_TRUE(result.IsNull(3));
+
+  // Subtracting months crosses years backwards.
+  VectorOps::DateAddMonths(*dates, ConstantVector(GenericValue::CreateInteger(-13)), &result);
+  EXPECT_EQ(GenericValue::CreateDate(1992, 12, 1), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateDate(2018, 12, 31), result.GetValue(1));
+  EXPECT_EQ(GenericValue::CreateDate(1998, 11, 30), result.GetValue(2));
+}
+
+}  // namespace tpl::sql
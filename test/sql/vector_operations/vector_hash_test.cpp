@@ -1,6 +1,9 @@
 #include <random>
+#include <vector>
 
+#include "common/exception.h"
 #include "sql/operators/hash_operators.h"
+#include "sql/tuple_id_list.h"
 #include "sql/vector.h"
 #include "sql/vector_operations/vector_operations.h"
 #include "util/sql_test_harness.h"
@@ -91,4 +94,48 @@ TEST_F(VectorHashTest, StringHash) {
   EXPECT_EQ(Hash<VarlenEntry>{}(raw_input[3], input->IsNull(3)), raw_hash[3]);
 }
 
+TEST_F(VectorHashTest, MultiColumnHash) {
+  auto ints = MakeIntegerVector({1, 2, 3, 4, 5}, {false, true, false, false, false});
+  auto dbls = MakeDoubleVector({1.5, 2.5, 3.5, 4.5, 5.5}, {false, false, false, true, false});
+  auto strs = MakeVarcharVector({"a", "bb", "a much longer string, over the inline limit", "d", ""},
+                                {false, false, false, false, true});
+  const std::vector<const Vector *> inputs = {ints.get(), dbls.get(), strs.get()};
+
+  // The fused hash must match hashing the first column and combining the rest, one at a time.
+  const auto check = [&]() {
+    Vector fused(TypeId::Hash, true, false), expected(TypeId::Hash, true, false);
+    VectorOps::Hash(inputs, &fused);
+    VectorOps::Hash(*ints, &expected);
+    VectorOps::HashCombine(*dbls, &expected);
+    VectorOps::HashCombine(*strs, &expected);
+
+    EXPECT_EQ(expected.GetSize(), fused.GetSize());
+    EXPECT_EQ(expected.GetCount(), fused.GetCount());
+    EXPECT_EQ(ints->GetFilteredTupleIdList(), fused.GetFilteredTupleIdList());
+    auto raw_fused = reinterpret_cast<hash_t *>(fused.GetData());
+    auto raw_expected = reinterpret_cast<hash_t *>(expected.GetData());
+    VectorOps::Exec(fused, [&](uint64_t i, uint64_t k) {
+      EXPECT_EQ(raw_expected[i], raw_fused[i]);
+    });
+  };
+
+  // Unfiltered.
+  check();
+
+  // Filtered.
+  TupleIdList tids(ints->GetSize());
+  tids = {0, 1, 3};
+  for (const auto &vec : {ints.get(), dbls.get(), strs.get()}) {
+    vec->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+  }
+  check();
+
+  // Inputs with different filters are rejected.
+  TupleIdList other_tids(ints->GetSize());
+  other_tids = {0, 2};
+  strs->SetFilteredTupleIdList(&other_tids, other_tids.GetTupleCount());
+  Vector result(TypeId::Hash, true, false);
+  EXPECT_THROW(VectorOps::Hash(inputs, &result), Exception);
+}
+
 }  // namespace tpl::sql
@@ -1,5 +1,6 @@
 #include "common/exception.h"
 #include "sql/constant_vector.h"
+#include "sql/type.h"
 #include "sql/vector.h"
 #include "sql/vector_operations/vector_operations.h"
 #include "util/sql_test_harness.h"
@@ -194,4 +195,118 @@ TEST_F(VectorArithmeticTest, InPlaceAdditionFilteredWithNulls) {
   }
 }
 
+TEST_F(VectorArithmeticTest, DecimalArithmetic) {
+  // a = [1.25, -3.50, NULL, 100.00] as DECIMAL(10,2)
+  // b = [0.005, 2.000, 1.000, 0.000] as DECIMAL(8,3)
+  const auto a_type = Type::DecimalType(true, 10, 2), b_type = Type::DecimalType(true, 8, 3);
+  auto a = MakeBigIntVector({125, -350, 0, 10000}, {false, false, true, false});
+  auto b = MakeBigIntVector({5, 2000, 1000, 0}, {false, false, false, false});
+
+  {
+    // DECIMAL(12,3)
+    const auto type = Type::DecimalArithmeticResultType(KnownOperator::Add, a_type, b_type);
+    EXPECT_EQ(Type::DecimalType(true, 12, 3), type);
+    auto result = Vector(type.GetPrimitiveTypeId(), true, false);
+    VectorOps::DecimalAdd(*a, a_type, *b, b_type, &result);
+    EXPECT_EQ(4u, result.GetCount());
+    EXPECT_EQ(GenericValue::CreateBigInt(1255), result.GetValue(0));
+    EXPECT_EQ(GenericValue::CreateBigInt(-1500), result.GetValue(1));
+    EXPECT_TRUE(result.IsNull(2));
+    EXPECT_EQ(GenericValue::CreateBigInt(100000), result.GetValue(3));
+
+    VectorOps::DecimalSubtract(*a, a_type, *b, b_type, &result);
+    EXPECT_EQ(GenericValue::CreateBigInt(1245), result.GetValue(0));
+    EXPECT_EQ(GenericValue::CreateBigInt(-5500), result.GetValue(1));
+    EXPECT_TRUE(result.IsNull(2));
+    EXPECT_EQ(GenericValue::CreateBigInt(100000), result.GetValue(3));
+  }
+
+  {
+    // Constant input: a + 1.00 as DECIMAL(3,2)
+    const auto c_type = Type::DecimalType(false, 3, 2);
+    const auto type = Type::DecimalArithmeticResultType(KnownOperator::Add, a_type, c_type);
+    auto result = Vector(type.GetPrimitiveTypeId(), true, false);
+    VectorOps::DecimalAdd(*a, a_type, ConstantVector(GenericValue::CreateBigInt(100)), c_type,
+                          &result);
+    EXPECT_EQ(GenericValue::CreateBigInt(225), result.GetValue(0));
+    EXPECT_EQ(GenericValue::CreateBigInt(-250), result.GetValue(1));
+    EXPECT_TRUE(result.IsNull(2));
+    EXPECT_EQ(GenericValue::CreateBigInt(10100), result.GetValue(3));
+  }
+
+  {
+    // DECIMAL(19,5), which needs 128 bits.
+    const auto type = Type::DecimalArithmeticResultType(KnownOperator::Mul, a_type, b_type);
+    EXPECT_EQ(Type::DecimalType(true, 19, 5), type);
+    EXPECT_EQ(TypeId::HugeInt, type.GetPrimitiveTypeId());
+    auto result = Vector(type.GetPrimitiveTypeId(), true, false);
+    VectorOps::DecimalMultiply(*a, a_type, *b, b_type, &result);
+    const auto data = reinterpret_cast<const int128_t *>(result.GetData());
+    EXPECT_TRUE(data[0] == 625);
+    EXPECT_TRUE(data[1] == -700000);
+    EXPECT_TRUE(result.IsNull(2));
+    EXPECT_TRUE(data[3] == 0);
+
+    // The wrong result storage type.
+    auto bad_result = Vector(TypeId::BigInt, true, false);
+    EXPECT_THROW(VectorOps::DecimalMultiply(*a, a_type, *b, b_type, &bad_result),
+                 TypeMismatchException);
+  }
+
+  {
+    // DECIMAL(22,11). Division by zero is NULL.
+    const auto type = Type::DecimalArithmeticResultType(KnownOperator::Div, a_type, b_type);
+    EXPECT_EQ(Type::DecimalType(true, 22, 11), type);
+    auto result = Vector(type.GetPrimitiveTypeId(), true, false);
+    VectorOps::DecimalDivide(*a, a_type, *b, b_type, &result);
+    const auto data = reinterpret_cast<const int128_t *>(result.GetData());
+    EXPECT_TRUE(data[0] == 250 * Decimal128::PowerOfTen(11));
+    EXPECT_TRUE(data[1] == -175 * Decimal128::PowerOfTen(9));
+    EXPECT_TRUE(result.IsNull(2));
+    EXPECT_TRUE(result.IsNull(3));
+  }
+
+  {
+    // Quotients are rounded half away from zero: +/-2 / 3 = +/-0.666667 as DECIMAL(7,6).
+    const auto type = Type::DecimalType(false, 1, 0);
+    auto x = MakeBigIntVector({2, -2}, {false, false});
+    auto y = MakeBigIntVector({3, 3}, {false, false});
+    const auto result_type = Type::DecimalArithmeticResultType(KnownOperator::Div, type, type);
+    EXPECT_EQ(Type::DecimalType(false, 7, 6), result_type);
+    auto result = Vector(result_type.GetPrimitiveTypeId(), true, false);
+    VectorOps::DecimalDivide(*x, type, *y, type, &result);
+    EXPECT_EQ(GenericValue::CreateBigInt(666667), result.GetValue(0));
+    EXPECT_EQ(GenericValue::CreateBigInt(-666667), result.GetValue(1));
+  }
+}
+
+TEST_F(VectorArithmeticTest, DecimalOverflow) {
+  // 10^38 - 1, the largest DECIMAL(38,0).
+  const auto type = Type::DecimalType(false, 38, 0);
+  const int128_t max = Decimal128::PowerOfTen(38) - 1;
+  auto a = MakeVector(TypeId::HugeInt, 2);
+  auto b = MakeVector(TypeId::HugeInt, 2);
+  reinterpret_cast<int128_t *>(a->GetData())[0] = max;
+  reinterpret_cast<int128_t *>(a->GetData())[1] = 1;
+  reinterpret_cast<int128_t *>(b->GetData())[0] = 0;
+  reinterpret_cast<int128_t *>(b->GetData())[1] = 1;
+
+  auto result = Vector(TypeId::HugeInt, true, false);
+  VectorOps::DecimalAdd(*a, type, *b, type, &result);
+  EXPECT_TRUE(reinterpret_cast<const int128_t *>(result.GetData())[0] == max);
+
+  // max + 1 exceeds the precision, and max * max overflows 128 bits.
+  reinterpret_cast<int128_t *>(b->GetData())[0] = 1;
+  EXPECT_THROW(VectorOps::DecimalAdd(*a, type, *b, type, &result), Exception);
+  EXPECT_THROW(VectorOps::DecimalMultiply(*a, type, *a, type, &result), Exception);
+
+  // Overflowing elements that are filtered out, or NULL, are ignored.
+  auto tids = TupleIdList(a->GetSize());
+  tids = {1};
+  a->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+  b->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+  VectorOps::DecimalAdd(*a, type, *b, type, &result);
+  EXPECT_TRUE(reinterpret_cast<const int128_t *>(result.GetData())[1] == 2);
+}
+
 }  // namespace tpl::sql
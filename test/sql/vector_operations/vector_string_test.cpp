@@ -0,0 +1,152 @@
+#include <string>
+
+#include "common/exception.h"
+#include "sql/constant_vector.h"
+#include "sql/tuple_id_list.h"
+#include "sql/vector.h"
+#include "sql/vector_operations/vector_operations.h"
+#include "util/sql_test_harness.h"
+#include "util/test_harness.h"
+
+namespace tpl::sql {
+
+class VectorStringTest : public TplTest {};
+
+TEST_F(VectorStringTest, InputVerification) {
+  auto strings = MakeVarcharVector(10);
+  auto ints = MakeIntegerVector(10);
+  Vector string_result(TypeId::Varchar, true, false);
+  Vector int_result(TypeId::Integer, true, false);
+
+  EXPECT_THROW(VectorOps::Upper(*ints, &string_result), InvalidTypeException);
+  EXPECT_THROW(VectorOps::Lower(*strings, &int_result), TypeMismatchException);
+  EXPECT_THROW(VectorOps::Concat(*strings, *ints, &string_result), InvalidTypeException);
+  EXPECT_THROW(VectorOps::Concat(*strings, *MakeVarcharVector(5), &string_result), Exception);
+  // Characters to trim must be a constant.
+  EXPECT_THROW(VectorOps::Trim(*strings, *strings, &string_result), Exception);
+}
+
+TEST_F(VectorStringTest, UpperLower) {
+  // Mix inlined and out-of-line strings, and strings long enough to use the vectorized loop.
+  const std::string long_str = "The Quick Brown Fox Jumps Over The Lazy Dog @[`{ 0123456789";
+  const std::string utf8_str = "Stra\xc3\x9f" "e \xc3\x84pfel";
+  auto strings = MakeVarcharVector({"", "aBc", {}, long_str.c_str(), utf8_str.c_str()},
+                                   {false, false, true, false, false});
+  Vector result(TypeId::Varchar, true, false);
+
+  const auto expected = [](std::string s, int (*f)(int)) {
+    for (auto &c : s) c = static_cast<char>(f(static_cast<unsigned char>(c)));
+    return GenericValue::CreateVarchar(s);
+  };
+
+  VectorOps::Upper(*strings, &result);
+  EXPECT_EQ(5u, result.GetCount());
+  EXPECT_EQ(GenericValue::CreateVarchar(""), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateVarchar("ABC"), result.GetValue(1));
+  EXPECT_TRUE(result.IsNull(2));
+  EXPECT_EQ(expected(long_str, ::toupper), result.GetValue(3));
+  EXPECT_EQ(GenericValue::CreateVarchar("STRA\xc3\x9f" "E \xc3\x84PFEL"), result.GetValue(4));
+
+  VectorOps::Lower(*strings, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("abc"), result.GetValue(1));
+  EXPECT_TRUE(result.IsNull(2));
+  EXPECT_EQ(expected(long_str, ::tolower), result.GetValue(3));
+  EXPECT_EQ(GenericValue::CreateVarchar("stra\xc3\x9f" "e \xc3\x84pfel"), result.GetValue(4));
+
+  // Results are owned by the result vector and outlive the input.
+  strings.reset();
+  EXPECT_EQ(expected(long_str, ::tolower), result.GetValue(3));
+}
+
+TEST_F(VectorStringTest, Substring) {
+  auto strings = MakeVarcharVector({"abcdef", "a long string to slice", {}, ""},
+                                   {false, false, true, false});
+  Vector result(TypeId::Varchar, true, false);
+
+  VectorOps::Substring(*strings, 2, 3, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("bcd"), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateVarchar(" lo"), result.GetValue(1));
+  EXPECT_TRUE(result.IsNull(2));
+  EXPECT_EQ(GenericValue::CreateVarchar(""), result.GetValue(3));
+
+  // Ranges are clamped to the string.
+  VectorOps::Substring(*strings, -1, 4, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("ab"), result.GetValue(0));
+  VectorOps::Substring(*strings, 3, 100, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("cdef"), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateVarchar("long string to slice"), result.GetValue(1));
+  VectorOps::Substring(*strings, 10, 2, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar(""), result.GetValue(0));
+
+  // Negative lengths are an error.
+  VectorOps::Substring(*strings, 1, -1, &result);
+  EXPECT_TRUE(result.IsNull(0));
+  EXPECT_TRUE(result.IsNull(1));
+}
+
+TEST_F(VectorStringTest, Trim) {
+  auto strings =
+      MakeVarcharVector({"  padded  ", "xx-- a longer string with padding --xx", "   ", {}},
+                        {false, false, false, true});
+  Vector result(TypeId::Varchar, true, false);
+
+  const auto spaces = ConstantVector(GenericValue::CreateVarchar(" "));
+  VectorOps::Trim(*strings, spaces, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("padded"), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateVarchar(""), result.GetValue(2));
+  EXPECT_TRUE(result.IsNull(3));
+  VectorOps::Ltrim(*strings, spaces, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("padded  "), result.GetValue(0));
+  VectorOps::Rtrim(*strings, spaces, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("  padded"), result.GetValue(0));
+
+  const auto chars = ConstantVector(GenericValue::CreateVarchar("x- "));
+  VectorOps::Trim(*strings, chars, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("a longer string with padding"), result.GetValue(1));
+  VectorOps::Rtrim(*strings, chars, &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("xx-- a longer string with padding"), result.GetValue(1));
+
+  // Trimming NULL characters produces NULL.
+  VectorOps::Trim(*strings, ConstantVector(GenericValue::CreateNull(TypeId::Varchar)), &result);
+  EXPECT_TRUE(result.IsNull(0));
+  EXPECT_TRUE(result.IsNull(1));
+}
+
+TEST_F(VectorStringTest, Concat) {
+  auto a = MakeVarcharVector({"first", "second", {}, "a somewhat long"},
+                             {false, false, true, false});
+  auto b = MakeVarcharVector({"-1", {}, "-3", " concatenation"}, {false, true, false, false});
+  Vector result(TypeId::Varchar, true, false);
+
+  // NULLs concatenate as empty strings.
+  VectorOps::Concat(*a, *b, &result);
+  EXPECT_EQ(4u, result.GetCount());
+  EXPECT_EQ(GenericValue::CreateVarchar("first-1"), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateVarchar("second"), result.GetValue(1));
+  EXPECT_EQ(GenericValue::CreateVarchar("-3"), result.GetValue(2));
+  EXPECT_EQ(GenericValue::CreateVarchar("a somewhat long concatenation"), result.GetValue(3));
+
+  // Constant on either side.
+  VectorOps::Concat(ConstantVector(GenericValue::CreateVarchar(">")), *a, &result);
+  EXPECT_EQ(4u, result.GetCount());
+  EXPECT_EQ(GenericValue::CreateVarchar(">first"), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateVarchar(">"), result.GetValue(2));
+  VectorOps::Concat(*a, ConstantVector(GenericValue::CreateVarchar("!")), &result);
+  EXPECT_EQ(GenericValue::CreateVarchar("a somewhat long!"), result.GetValue(3));
+}
+
+TEST_F(VectorStringTest, FilteredInput) {
+  auto strings = MakeVarcharVector({"zero", "one", "two", "three is quite a bit longer"},
+                                   {false, false, false, false});
+  TupleIdList tids(strings->GetSize());
+  tids = {1, 3};
+  strings->SetFilteredTupleIdList(&tids, tids.GetTupleCount());
+
+  Vector result(TypeId::Varchar, true, false);
+  VectorOps::Upper(*strings, &result);
+  EXPECT_EQ(2u, result.GetCount());
+  EXPECT_EQ(GenericValue::CreateVarchar("ONE"), result.GetValue(0));
+  EXPECT_EQ(GenericValue::CreateVarchar("THREE IS QUITE A BIT LONGER"), result.GetValue(1));
+}
+
+}  // namespace tpl::sql
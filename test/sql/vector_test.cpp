@@ -125,6 +125,20 @@ TEST_F(VectorTest, GetAndSetString) {
   vec->CheckIntegrity();
 }
 
+TEST_F(VectorTest, GetAndSetDateTime) {
+  auto date_vec = MakeDateVector(1);
+  date_vec->SetValue(0, GenericValue::CreateDate(2020, 2, 29));
+  EXPECT_EQ(GenericValue::CreateDate(2020, 2, 29), date_vec->GetValue(0));
+  date_vec->CheckIntegrity();
+
+  auto ts_vec = MakeTimestampVector(1);
+  ts_vec->SetValue(0, GenericValue::CreateTimestamp(2020, 2, 29, 12, 30, 15));
+  EXPECT_EQ(GenericValue::CreateTimestamp(2020, 2, 29, 12, 30, 15), ts_vec->GetValue(0));
+  ts_vec->SetNull(0, true);
+  EXPECT_TRUE(ts_vec->GetValue(0).IsNull());
+  ts_vec->CheckIntegrity();
+}
+
 TEST_F(VectorTest, SetSelectionVector) {
   // vec = [0, 1, 2, 3, NULL, 5, 6, 7, 8, 9]
   auto vec = MakeTinyIntVector(10);
@@ -365,6 +379,61 @@ TEST_F(VectorTest, GetNonNullSelections) {
   }
 }
 
+TEST_F(VectorTest, NoNullsTracking) {
+  // Fresh vectors have no NULLs.
+  auto vec = MakeIntegerVector({1, 2, 3, 4}, {false, false, false, false});
+  EXPECT_TRUE(vec->HasNoNulls());
+
+  // Setting a NULL, or handing out the mutable mask, forgets it.
+  vec->SetNull(1, true);
+  EXPECT_FALSE(vec->HasNoNulls());
+  vec->SetNull(1, false);
+  EXPECT_FALSE(vec->HasNoNulls());
+
+  // Referencing raw data without a NULL bitmap has no NULLs. With a bitmap, it depends on the bits.
+  int32_t data[] = {1, 2, 3, 4};
+  uint32_t nulls[] = {0};
+  Vector ref(TypeId::Integer);
+  ref.Reference(reinterpret_cast<byte *>(data), nullptr, 4);
+  EXPECT_TRUE(ref.HasNoNulls());
+  ref.Reference(reinterpret_cast<byte *>(data), nulls, 4);
+  EXPECT_TRUE(ref.HasNoNulls());
+  util::BitUtil::Set(nulls, 2);
+  ref.Reference(reinterpret_cast<byte *>(data), nulls, 4);
+  EXPECT_FALSE(ref.HasNoNulls());
+  EXPECT_TRUE(ref.IsNull(2));
+
+  // Referencing another vector inherits its flag.
+  Vector ref2(TypeId::Integer);
+  ref2.Reference(&ref);
+  EXPECT_FALSE(ref2.HasNoNulls());
+}
+
+TEST_F(VectorTest, SetNullMaskFrom) {
+  auto a = MakeIntegerVector({1, 2, 3, 4}, {true, false, false, false});
+  auto b = MakeIntegerVector({1, 2, 3, 4}, {false, false, false, true});
+  auto none = MakeIntegerVector({1, 2, 3, 4}, {false, false, false, false});
+  auto result = MakeIntegerVector(4);
+
+  // Inputs without NULLs produce a result without NULLs.
+  result->SetNullMaskFrom({none.get()});
+  EXPECT_TRUE(result->HasNoNulls());
+  EXPECT_TRUE(result->GetNullMask().None());
+
+  // Otherwise, the result has the union of all NULLs.
+  result->SetNullMaskFrom({none.get(), a.get(), b.get()});
+  EXPECT_FALSE(result->HasNoNulls());
+  EXPECT_EQ(2u, result->GetNullMask().CountOnes());
+  EXPECT_TRUE(result->IsNull(0));
+  EXPECT_TRUE(result->IsNull(3));
+
+  // The result may be an input.
+  a->SetNullMaskFrom({b.get(), a.get()});
+  EXPECT_TRUE(a->IsNull(0));
+  EXPECT_TRUE(a->IsNull(3));
+  EXPECT_EQ(2u, a->GetNullMask().CountOnes());
+}
+
 TEST_F(VectorTest, Print) {
   {
     auto vec = MakeBooleanVector({false, true, true, false}, {false, false, false, false});
@@ -0,0 +1,86 @@
+#include <charconv>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "util/fast_integer_parser.h"
+#include "util/test_harness.h"
+
+namespace tpl::util {
+
+namespace {
+
+// Check the fast parser agrees with std::from_chars() on the given input.
+template <typename T>
+void CheckAgainstFromChars(std::string_view str) {
+  T expected = 0, actual = 0;
+  const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), expected);
+  const bool ok = FastIntegerParser::Parse(str.data(), str.data() + str.size(), &actual);
+  ASSERT_EQ(ec == std::errc(), ok) << str;
+  if (ok) {
+    ASSERT_EQ(expected, actual) << str;
+  }
+}
+
+}  // namespace
+
+TEST(FastIntegerParserTest, Simple) {
+  int64_t val = 0;
+  const auto parse = [&](std::string_view str) {
+    return FastIntegerParser::Parse(str.data(), str.data() + str.size(), &val);
+  };
+
+  EXPECT_TRUE(parse("0"));
+  EXPECT_EQ(0, val);
+  EXPECT_TRUE(parse("-42"));
+  EXPECT_EQ(-42, val);
+  EXPECT_TRUE(parse("1234567890123"));
+  EXPECT_EQ(1234567890123, val);
+  EXPECT_TRUE(parse("00000000000000000000000000012"));
+  EXPECT_EQ(12, val);
+  EXPECT_TRUE(parse("9223372036854775807"));
+  EXPECT_EQ(std::numeric_limits<int64_t>::max(), val);
+  EXPECT_TRUE(parse("-9223372036854775808"));
+  EXPECT_EQ(std::numeric_limits<int64_t>::min(), val);
+
+  // Parsing stops at the first non-digit.
+  EXPECT_TRUE(parse("12345678x9"));
+  EXPECT_EQ(12345678, val);
+
+  // Errors.
+  EXPECT_FALSE(parse(""));
+  EXPECT_FALSE(parse("-"));
+  EXPECT_FALSE(parse("+1"));
+  EXPECT_FALSE(parse(" 1"));
+  EXPECT_FALSE(parse("9223372036854775808"));
+  EXPECT_FALSE(parse("-9223372036854775809"));
+  EXPECT_FALSE(parse("123456789012345678901234567890"));
+
+  // Ranges of smaller types.
+  int8_t tiny = 0;
+  std::string_view s = "-128";
+  EXPECT_TRUE(FastIntegerParser::Parse(s.data(), s.data() + s.size(), &tiny));
+  EXPECT_EQ(-128, tiny);
+  s = "128";
+  EXPECT_FALSE(FastIntegerParser::Parse(s.data(), s.data() + s.size(), &tiny));
+}
+
+TEST(FastIntegerParserTest, MatchesFromChars) {
+  std::mt19937 gen(31);
+  std::uniform_int_distribution<uint32_t> num_digits(1, 22), digit(0, 9), other(0, 15);
+  for (uint32_t i = 0; i < 100000; i++) {
+    std::string str = other(gen) == 0 ? "-" : "";
+    for (uint32_t j = 0, n = num_digits(gen); j < n; j++) {
+      // Sprinkle in the occasional non-digit.
+      str += other(gen) == 0 ? static_cast<char>('0' - 1 + 11 * (j & 1)) : '0' + digit(gen);
+    }
+    CheckAgainstFromChars<int8_t>(str);
+    CheckAgainstFromChars<int16_t>(str);
+    CheckAgainstFromChars<int32_t>(str);
+    CheckAgainstFromChars<int64_t>(str);
+    CheckAgainstFromChars<uint32_t>(str);
+    CheckAgainstFromChars<uint64_t>(str);
+  }
+}
+
+}  // namespace tpl::util
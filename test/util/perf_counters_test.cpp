@@ -0,0 +1,61 @@
+#include "util/perf_counters.h"
+#include "util/test_harness.h"
+
+namespace tpl::util {
+
+class PerfCountersTest : public TplTest {};
+
+TEST_F(PerfCountersTest, SampleTest) {
+  using Event = PerfCounters::Event;
+
+  PerfCounters::Sample sample;
+  EXPECT_EQ(0.0, sample.GetIPC());
+  EXPECT_EQ(0.0, sample.GetPer(Event::LLCMisses, 0));
+
+  sample.Set(Event::Cycles, 200);
+  sample.Set(Event::Instructions, 300);
+  sample.Set(Event::LLCMisses, 50);
+  EXPECT_DOUBLE_EQ(1.5, sample.GetIPC());
+  EXPECT_DOUBLE_EQ(0.5, sample.GetPer(Event::LLCMisses, 100));
+  EXPECT_EQ(0.0, sample.GetPer(Event::LLCMisses, 0));
+
+  sample += sample;
+  EXPECT_EQ(400u, sample.Get(Event::Cycles));
+  EXPECT_EQ(600u, sample.Get(Event::Instructions));
+  EXPECT_EQ(100u, sample.Get(Event::LLCMisses));
+  EXPECT_EQ(0u, sample.Get(Event::DTLBMisses));
+}
+
+TEST_F(PerfCountersTest, CountTest) {
+  using Event = PerfCounters::Event;
+
+  PerfCounters counters;
+  counters.Start();
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < 1000000; i++) {
+    sum = sum + i;
+  }
+  counters.Stop();
+
+  const auto sample = counters.Read();
+  if (!counters.IsAvailable()) {
+    // Counters are permitted to be unavailable, but must then read as zero.
+    for (uint32_t i = 0; i < PerfCounters::kNumEvents; i++) {
+      EXPECT_EQ(0u, sample.Get(static_cast<Event>(i)));
+    }
+    return;
+  }
+
+  // Unsupported events may read zero, but cycles and instructions are universal.
+  EXPECT_LT(0u, sample.Get(Event::Cycles));
+  EXPECT_LT(1000000u, sample.Get(Event::Instructions));
+  EXPECT_LT(0.0, sample.GetIPC());
+
+  // Counting stopped.
+  for (uint64_t i = 0; i < 1000; i++) {
+    sum = sum + i;
+  }
+  EXPECT_EQ(sample.Get(Event::Instructions), counters.Read().Get(Event::Instructions));
+}
+
+}  // namespace tpl::util
@@ -0,0 +1,134 @@
+#include <sstream>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "util/test_harness.h"
+#include "util/trace_recorder.h"
+
+namespace tpl::util {
+
+class TraceRecorderTest : public TplTest {
+ protected:
+  void SetUp() override { TraceRecorder::Instance()->Clear(); }
+
+  void TearDown() override {
+    TraceRecorder::Instance()->Disable();
+    TraceRecorder::Instance()->Clear();
+  }
+
+  static uint64_t CountOccurrences(const std::string &str, const std::string &sub) {
+    uint64_t count = 0;
+    for (auto pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + 1)) {
+      count++;
+    }
+    return count;
+  }
+};
+
+TEST_F(TraceRecorderTest, DisabledTest) {
+  auto recorder = TraceRecorder::Instance();
+  EXPECT_FALSE(recorder->IsEnabled());
+  { TraceScope scope("test", "Disabled"); }
+  EXPECT_EQ(0u, recorder->GetEventCount());
+}
+
+TEST_F(TraceRecorderTest, MultiThreadedTest) {
+  constexpr uint32_t kNumThreads = 4;
+  constexpr uint32_t kEventsPerThread = 100;
+
+  auto recorder = TraceRecorder::Instance();
+  recorder->Enable();
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < kNumThreads; i++) {
+    threads.emplace_back([] {
+      for (uint32_t j = 0; j < kEventsPerThread; j++) {
+        TraceScope scope("test", "Task", "index", j);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  { TraceScope scope("test", "NoArgs"); }
+
+  EXPECT_EQ(kNumThreads * kEventsPerThread + 1, recorder->GetEventCount());
+
+  recorder->Disable();
+  std::stringstream ss;
+  recorder->WriteJson(ss);
+  const auto json = ss.str();
+  EXPECT_EQ(kNumThreads * kEventsPerThread, CountOccurrences(json, R"("name":"Task")"));
+  EXPECT_EQ(kNumThreads, CountOccurrences(json, R"("args":{"index":99})"));
+  EXPECT_NE(std::string::npos, json.find(R"({"name":"NoArgs","cat":"test","ph":"X")")) << json;
+
+  recorder->Clear();
+  EXPECT_EQ(0u, recorder->GetEventCount());
+}
+
+TEST_F(TraceRecorderTest, WrapAroundTest) {
+  constexpr uint32_t kNumEvents = TraceRecorder::kBufferCapacity + 10;
+
+  auto recorder = TraceRecorder::Instance();
+  recorder->Enable();
+
+  // Run in a fresh thread so it has a buffer of its own.
+  std::thread thread([] {
+    for (uint32_t i = 0; i < kNumEvents; i++) {
+      TraceScope scope("test", "Wrap", "index", i);
+    }
+  });
+  thread.join();
+
+  // Only the most recent events are retained.
+  EXPECT_EQ(TraceRecorder::kBufferCapacity, recorder->GetEventCount());
+  recorder->Disable();
+  std::stringstream ss;
+  recorder->WriteJson(ss);
+  const auto json = ss.str();
+  EXPECT_EQ(std::string::npos, json.find(R"("args":{"index":9})"));
+  EXPECT_NE(std::string::npos, json.find(R"("args":{"index":10})"));
+  EXPECT_NE(std::string::npos,
+            json.find(R"("args":{"index":)" + std::to_string(kNumEvents - 1) + "}"));
+}
+
+TEST_F(TraceRecorderTest, RecycledBufferTest) {
+  auto recorder = TraceRecorder::Instance();
+  recorder->Enable();
+
+  // The second thread may recycle the first's buffer once it exits and is cleared, while the
+  // third thread must not drop the second's events.
+  std::thread([] { TraceScope scope("test", "Cleared"); }).join();
+  recorder->Disable();
+  recorder->Clear();
+  recorder->Enable();
+  std::thread([] {
+    for (uint32_t i = 0; i < 5; i++) {
+      TraceScope scope("test", "Old");
+    }
+  }).join();
+  std::thread([] { TraceScope scope("test", "New"); }).join();
+
+  recorder->Disable();
+  std::stringstream ss;
+  recorder->WriteJson(ss);
+  const auto json = ss.str();
+
+  // The events of the two threads never share a thread ID.
+  const auto thread_of = [&](const std::string &name) {
+    const auto pos = json.find(R"("tid":)", json.find(R"({"name":")" + name + "\""));
+    return json.substr(pos, json.find(',', pos) + 1 - pos);
+  };
+  EXPECT_EQ(0u, CountOccurrences(json, R"("name":"Cleared")"));
+  EXPECT_EQ(5u, CountOccurrences(json, R"("name":"Old")"));
+  EXPECT_EQ(1u, CountOccurrences(json, R"("name":"New")"));
+  const auto new_thread = thread_of("New");
+  for (auto pos = json.find(R"({"name":"Old")"); pos != std::string::npos;
+       pos = json.find(R"({"name":"Old")", pos + 1)) {
+    EXPECT_EQ(std::string::npos, json.substr(pos, json.find('}', pos) - pos).find(new_thread))
+        << json;
+  }
+}
+
+}  // namespace tpl::util
@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <string>
 
+#include "common/settings.h"
 #include "logging/logger.h"
 #include "util/test_harness.h"
 #include "vm/module.h"
@@ -320,4 +322,122 @@ TEST_F(BytecodeGeneratorTest, FunctionTest) {
   EXPECT_EQ(20, s.b);
 }
 
+TEST_F(BytecodeGeneratorTest, ScopedLocalsTest) {
+  // Locals declared in sibling or nested blocks may reuse names. Each use must
+  // resolve to the innermost declaration in scope.
+  auto src = R"(
+    fun test(c: bool) -> int32 {
+      var x: int32 = 1
+      if (c) {
+        var y: int32 = 10
+        x = x + y
+      } else {
+        var y: int32 = 20
+        x = x + y
+      }
+      for (var i: int32 = 0; i < 2; i = i + 1) {
+        var x: int32 = 1000
+        x = x + 1
+      }
+      var y: int32 = 100
+      return x + y
+    })";
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(src);
+  ASSERT_TRUE(module != nullptr);
+
+  std::function<int32_t(bool)> f;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Interpret, f))
+      << "Function 'test' not found in module";
+
+  EXPECT_EQ(111, f(true));
+  EXPECT_EQ(121, f(false));
+}
+
+TEST_F(BytecodeGeneratorTest, FrameSlotReuseTest) {
+  // Locals in sibling scopes, and temporaries of consecutive statements, have
+  // disjoint lifetimes. Those of the same type should share frame slots.
+  auto src = R"(
+    fun test(c: int32) -> int32 {
+      var x: int32 = 0
+      for (var i: int32 = 0; i < c; i = i + 1) {
+        var a: int32 = i * 2
+        x = x + a
+      }
+      for (var j: int32 = 0; j < c; j = j + 1) {
+        var b: int32 = j * 3
+        x = x + b
+      }
+      var y: int64 = 7
+      return x
+    })";
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(src);
+  ASSERT_TRUE(module != nullptr);
+
+  const FunctionInfo *func_info = module->GetFuncInfoByName("test");
+  ASSERT_TRUE(func_info != nullptr);
+  const auto offset_of = [&](std::string_view name) {
+    const auto &locals = func_info->GetLocals();
+    auto iter = std::ranges::find_if(locals, [&](auto &local) { return local.GetName() == name; });
+    EXPECT_NE(locals.end(), iter) << "Local '" << name << "' not found";
+    return iter->GetOffset();
+  };
+  // The second loop's locals take over the first loop's slots, in some order.
+  EXPECT_EQ(std::minmax(offset_of("i"), offset_of("a")),
+            std::minmax(offset_of("j"), offset_of("b")));
+  EXPECT_NE(offset_of("x"), offset_of("i"));
+  EXPECT_NE(offset_of("i"), offset_of("a"));
+  EXPECT_NE(offset_of("y"), offset_of("i"));
+  EXPECT_NE(offset_of("y"), offset_of("a"));
+
+  std::function<int32_t(int32_t)> f;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Interpret, f))
+      << "Function 'test' not found in module";
+
+  EXPECT_EQ(0, f(0));
+  EXPECT_EQ(30, f(4));
+}
+
+TEST_F(BytecodeGeneratorTest, ThreadedInterpretationTest) {
+  // Direct-threaded code must compute the same results as plain bytecode. Use
+  // forward and backward jumps, and calls between functions.
+  auto src = R"(
+    fun collatz(n: int64) -> int64 {
+      var steps: int64 = 0
+      for (var x = n; x != 1; steps = steps + 1) {
+        if (x % 2 == 0) {
+          x = x / 2
+        } else {
+          x = 3 * x + 1
+        }
+      }
+      return steps
+    }
+    fun test(n: int64) -> int64 {
+      var total: int64 = 0
+      for (var i: int64 = 1; i <= n; i = i + 1) {
+        total = total + collatz(i)
+      }
+      return total
+    })";
+
+  int64_t results[2];
+  for (const bool threaded : {false, true}) {
+    Settings::Instance()->Set(Settings::Name::ThreadedInterpretation, threaded);
+    auto compiler = ModuleCompiler();
+    auto module = compiler.CompileToModule(src);
+    ASSERT_TRUE(module != nullptr);
+
+    std::function<int64_t(int64_t)> f;
+    EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Interpret, f))
+        << "Function 'test' not found in module";
+    results[threaded] = f(1000);
+  }
+  Settings::Instance()->Set(Settings::Name::ThreadedInterpretation, true);
+
+  EXPECT_EQ(59542, results[false]);
+  EXPECT_EQ(results[false], results[true]);
+}
+
 }  // namespace tpl::vm
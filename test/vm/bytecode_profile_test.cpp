@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "common/settings.h"
+#include "util/test_harness.h"
+#include "vm/bytecode_profile.h"
+#include "vm/llvm_engine.h"
+#include "vm/module.h"
+#include "vm/module_compiler.h"
+
+namespace tpl::vm {
+
+class BytecodeProfileTest : public TplTest {
+ protected:
+  static void SetUpTestSuite() { LLVMEngine::Initialize(); }
+
+  void TearDown() override {
+    Settings::Instance()->Set(Settings::Name::AdaptiveCompilationThreshold, int64_t{10000});
+  }
+
+  static constexpr const char *kSource = R"(
+    fun test(n: int32) -> int32 {
+      var count: int32 = 0
+      for (var i: int32 = 0; i < n; i = i + 1) {
+        if (i % 4 == 0) {
+          count = count + 1
+        }
+      }
+      return count
+    })";
+};
+
+TEST_F(BytecodeProfileTest, InterpreterRecordsBranchesAndCalls) {
+  ASSERT_TRUE(Settings::Instance()->GetBool(Settings::Name::ThreadedInterpretation));
+  ASSERT_TRUE(Settings::Instance()->GetBool(Settings::Name::ProfileGuidedCompilation));
+
+  // Profile without ever compiling.
+  Settings::Instance()->Set(Settings::Name::AdaptiveCompilationThreshold,
+                            std::numeric_limits<int64_t>::max());
+
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(kSource);
+  ASSERT_TRUE(module != nullptr);
+
+  std::function<int32_t(int32_t)> f;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Adaptive, f))
+      << "Function 'test' not found in module";
+  EXPECT_EQ(25, f(100));
+  EXPECT_EQ(25, f(100));
+
+  const BytecodeProfile *profile = module->GetProfile();
+  ASSERT_TRUE(profile != nullptr);
+
+  // Collect the outcomes of each conditional jump, ignoring their direction.
+  const FunctionInfo *func_info = module->GetFuncInfoByName("test");
+  std::vector<std::pair<uint64_t, uint64_t>> outcomes;
+  for (auto iter = module->GetBytecodeModule()->GetBytecodeForFunction(*func_info); !iter.Done();
+       iter.Advance()) {
+    const auto *counters = profile->GetBranchCounters(func_info->GetId(), iter.GetPosition());
+    EXPECT_EQ(Bytecodes::IsConditionalJump(iter.CurrentBytecode()), counters != nullptr);
+    if (counters != nullptr) {
+      outcomes.emplace_back(std::minmax(counters->GetTakenCount(), counters->GetNotTakenCount()));
+    }
+  }
+  std::sort(outcomes.begin(), outcomes.end());
+
+  // The loop exits once per call after 100 iterations, and one in four
+  // iterations passes the if-condition.
+  EXPECT_EQ(2u, profile->GetInvocationCount(func_info->GetId()));
+  const std::vector<std::pair<uint64_t, uint64_t>> expected = {{2, 200}, {50, 150}};
+  EXPECT_EQ(expected, outcomes);
+  EXPECT_EQ(2u + 2 + 200 + 50 + 150, profile->GetTotalCount());
+}
+
+TEST_F(BytecodeProfileTest, InterpretedModulesAreNotProfiled) {
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(kSource);
+  ASSERT_TRUE(module != nullptr);
+
+  // Nothing would consume the profile of a module that only ever runs in the
+  // interpreter.
+  std::function<int32_t(int32_t)> f;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Interpret, f))
+      << "Function 'test' not found in module";
+  EXPECT_EQ(25, f(100));
+  EXPECT_EQ(nullptr, module->GetProfile());
+}
+
+TEST_F(BytecodeProfileTest, AdaptiveCompilationUsesProfile) {
+  // The JIT needs the bytecode handlers' bitcode, built alongside the tests.
+  if (!std::filesystem::exists(LLVMEngine::CompilerOptions().GetBytecodeHandlersBcPath())) {
+    GTEST_SKIP() << "Bytecode handlers bitcode isn't available";
+  }
+
+  // Compile once the profile has seen a few calls.
+  Settings::Instance()->Set(Settings::Name::AdaptiveCompilationThreshold, int64_t{1000});
+
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(kSource);
+  ASSERT_TRUE(module != nullptr);
+
+  std::function<int32_t(int32_t)> f;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Adaptive, f))
+      << "Function 'test' not found in module";
+  for (uint32_t i = 0; i < 10; i++) {
+    EXPECT_EQ(25, f(100));
+  }
+  ASSERT_TRUE(module->GetProfile() != nullptr);
+  EXPECT_LE(1000u, module->GetProfile()->GetTotalCount());
+
+  // Wait for the background compilation. Both conditional jumps should have
+  // been weighted with the outcomes the interpreter observed.
+  module->CompileToMachineCode();
+  EXPECT_EQ(2u, module->GetCompileStats().weighted_branches);
+
+  std::function<int32_t(int32_t)> compiled;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Compiled, compiled));
+  EXPECT_EQ(25, compiled(100));
+}
+
+TEST_F(BytecodeProfileTest, DestroyWhileCompiling) {
+  if (!std::filesystem::exists(LLVMEngine::CompilerOptions().GetBytecodeHandlersBcPath())) {
+    GTEST_SKIP() << "Bytecode handlers bitcode isn't available";
+  }
+
+  // Compile after the first call.
+  Settings::Instance()->Set(Settings::Name::AdaptiveCompilationThreshold, int64_t{1});
+
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(kSource);
+  ASSERT_TRUE(module != nullptr);
+
+  std::function<int32_t(int32_t)> f;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Adaptive, f))
+      << "Function 'test' not found in module";
+  EXPECT_EQ(25, f(100));
+
+  // The module, and the bytecode it compiles, must outlive the pending compilation.
+  module.reset();
+}
+
+}  // namespace tpl::vm